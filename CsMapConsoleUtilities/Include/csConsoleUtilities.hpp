@@ -108,6 +108,13 @@ bool csGetNsrs2011EsriCodes (void);
 bool csFixNsrs2011 (const wchar_t* csDictDir,const wchar_t* csTempDir);
 bool PreProcessWktCatalog (const wchar_t* csDataTrgDir,const wchar_t* csDataSrcDir);
 
+bool csBulkConvert (const wchar_t* csDictDir,const wchar_t* srcCrsName,const wchar_t* trgCrsName,
+															   const wchar_t* inputPath,
+															   const wchar_t* outputPath,
+															   bool binary = false,
+															   bool threeD = false,
+															   unsigned long blockSize = 0UL);
+
 bool csAddInGCS (const wchar_t* trgDir,const wchar_t* dataDir,const wchar_t* dataName,
 															  const wchar_t* dictDir,
 															  const wchar_t* epsgDir);
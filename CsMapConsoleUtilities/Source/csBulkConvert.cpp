@@ -0,0 +1,393 @@
+//===========================================================================
+// $Header$
+//
+//    (C) Copyright 2007 by Autodesk, Inc.
+//
+// The information contained herein is confidential, proprietary
+// to Autodesk, Inc., and considered a trade secret as defined
+// in section 499C of the penal code of the State of California.
+// Use of this information by anyone other than authorized employees
+// of Autodesk, Inc. is granted only under a written non-disclosure
+// agreement, expressly prescribing the scope and manner of such use.
+//
+// CREATED BY:
+//      Norm Olsen
+//
+// DESCRIPTION:
+//
+
+#include "csConsoleUtilities.hpp"
+
+#include <time.h>
+
+extern "C" int cs_Error;
+
+// This utility converts a file of coordinates, of any size, from one
+// coordinate system to another.  Two input formats are supported:
+//
+//	binary:	a stream of IEEE double values (in native byte order), two or
+//			three values per point depending upon the threeD argument.
+//			The output file is of the same form.  The status of each point
+//			is written, as a 32 bit integer, to a companion file whose name
+//			is the output file name with ".sts" appended.
+//	text:	one point per line, the coordinate values separated by commas
+//			or tabs; or by spaces if the line contains neither.  Values are
+//			parsed with CS_atof, so anything
+//			CS_atof accepts (degrees/minutes/seconds, directional characters,
+//			etc.) is acceptable.  The output is written in the same form
+//			using CS_ftoa, and the status of each point is appended to each
+//			output line as an additional field.  Lines which do not parse are
+//			copied to the output, with a status of -1.
+//
+// The status value of each point is the same as would be returned by
+// CS_cnvrt (or CS_cnvrt3D) for that point; i.e. a bit map of the
+// cs_BASIC_xxxxx values, or a negative value for a hard error.
+//
+// Unlike CS_cnvrt, the coordinate systems and the datum conversion are set
+// up exactly once, and the file is processed in blocks of blockSize points.
+// Memory consumption is therefore a function of the block size only, not of
+// the size of the file.  At the end, the number of points processed, the
+// number of points in each status category, and the throughput achieved are
+// reported on standard output.
+//
+// The CS-MAP library maintains global state (e.g. cs_Error and the datum
+// conversion grid file buffers), so the conversion is performed by a single
+// thread.
+
+namespace
+{
+// Converts a block of points in place, and returns the status of each in
+// the status array.
+void csBulkConvertBlock (double* coords,long32_t* status,size_t count,size_t dimension,
+																	 struct cs_Csprm_* srcCrs,
+																	 struct cs_Csprm_* trgCrs,
+																	 struct cs_Dtcprm_* dtcPrm)
+{
+	int st;
+	int dtSt;
+	size_t idx;
+	double* xyz;
+	double xy [3];
+	double ll [3];
+
+	for (idx = 0;idx < count;idx += 1)
+	{
+		xyz = coords + (idx * dimension);
+		xy [0] = xyz [0];
+		xy [1] = xyz [1];
+		xy [2] = (dimension > 2) ? xyz [2] : 0.0;
+		status [idx] = 0;
+
+		if (dimension > 2)
+		{
+			st = CS_cs3ll (srcCrs,ll,xy);
+		}
+		else
+		{
+			st = CS_cs2ll (srcCrs,ll,xy);
+		}
+		if (st != cs_CNVRT_NRML)
+		{
+			status [idx] |= cs_BASIC_SRCRNG;
+		}
+
+		if (dimension > 2)
+		{
+			dtSt = CS_dtcvt3D (dtcPrm,ll,ll);
+		}
+		else
+		{
+			dtSt = CS_dtcvt (dtcPrm,ll,ll);
+		}
+		if (dtSt != 0)
+		{
+			if (dtSt < 0)
+			{
+				status [idx] = -cs_Error;
+				continue;
+			}
+			status [idx] |= cs_BASIC_DTCWRN;
+		}
+
+		if (dimension > 2)
+		{
+			st = CS_ll3cs (trgCrs,xy,ll);
+		}
+		else
+		{
+			st = CS_ll2cs (trgCrs,xy,ll);
+		}
+		if (st != cs_CNVRT_NRML)
+		{
+			status [idx] |= cs_BASIC_DSTRNG;
+		}
+		xyz [0] = xy [0];
+		xyz [1] = xy [1];
+		if (dimension > 2)
+		{
+			xyz [2] = xy [2];
+		}
+	}
+}
+// Parses a text line into up to three coordinate values.  Returns the number
+// of values extracted, zero if the line is not a valid point.  The line
+// itself is not modified.
+size_t csBulkParseLine (double* values,size_t dimension,const char* line)
+{
+	size_t count (0);
+	size_t length;
+	long32_t format;
+	const char* cp;
+	const char* separators;
+	char token [128];
+
+	separators = (strpbrk (line,",\t") != 0) ? ",\t\r\n" : " \t\r\n";
+	cp = line;
+	while (count < dimension)
+	{
+		// Skip leading separators and white space.
+		while (*cp != '\0' && (strchr (separators,*cp) != 0 || *cp == ' ')) cp += 1;
+		if (*cp == '\0') break;
+		length = strcspn (cp,separators);
+		if (length >= sizeof (token))
+		{
+			return 0;
+		}
+		memcpy (token,cp,length);
+		token [length] = '\0';
+		cp += length;
+		format = CS_atof (&values [count],token);
+		if ((format & cs_ATOF_ERRFLG) != 0)
+		{
+			return 0;
+		}
+		count += 1;
+	}
+	return (count >= 2) ? count : 0;
+}
+}		// end of anonymous namespace
+
+bool csBulkConvert (const wchar_t* csDictDir,const wchar_t* srcCrsName,const wchar_t* trgCrsName,
+															   const wchar_t* inputPath,
+															   const wchar_t* outputPath,
+															   bool binary,
+															   bool threeD,
+															   unsigned long blockSize)
+{
+	bool ok (false);
+	int status;
+	size_t idx;
+	size_t readCnt;
+	size_t dimension;
+	unsigned long long pointCount (0ULL);
+	unsigned long long okCount (0ULL);
+	unsigned long long rangeCount (0ULL);
+	unsigned long long dtcWrnCount (0ULL);
+	unsigned long long errorCount (0ULL);
+	long32_t xyFormat;
+	long32_t zzFormat;
+	clock_t startClock;
+	clock_t doneClock;
+	double elapsed;
+
+	struct cs_Csprm_* srcCrs (0);
+	struct cs_Csprm_* trgCrs (0);
+	struct cs_Dtcprm_* dtcPrm (0);
+	FILE* inFile (0);
+	FILE* outFile (0);
+	FILE* stsFile (0);
+	double* coords (0);
+	long32_t* statusArray (0);
+	size_t* valueCounts (0);
+
+	char csDictDirC [MAXPATH];
+	char srcNameC [cs_KEYNM_DEF];
+	char trgNameC [cs_KEYNM_DEF];
+	char pathC [MAXPATH + 8];
+	char lineBufr [512];
+	char fmtBufr [64];
+
+	dimension = threeD ? 3 : 2;
+	if (blockSize == 0UL)
+	{
+		blockSize = 65536UL;
+	}
+
+	wcstombs (csDictDirC,csDictDir,sizeof (csDictDirC));
+	status = CS_altdr (csDictDirC);
+	if (status != 0)
+	{
+		return ok;
+	}
+
+	// Set up the conversion, once.
+	wcstombs (srcNameC,srcCrsName,sizeof (srcNameC));
+	wcstombs (trgNameC,trgCrsName,sizeof (trgNameC));
+	srcCrs = CS_csloc (srcNameC);
+	trgCrs = CS_csloc (trgNameC);
+	if (srcCrs != 0 && trgCrs != 0)
+	{
+		dtcPrm = CS_dtcsu (srcCrs,trgCrs,cs_DTCFLG_DAT_F,cs_DTCFLG_BLK_I);
+	}
+	if (dtcPrm == 0)
+	{
+		CS_errmsg (lineBufr,sizeof (lineBufr));
+		std::wcout << L"Conversion setup failed: " << lineBufr << std::endl;
+		goto error;
+	}
+
+	// Decimal degrees to 9 places, everything else to the millimeter.  Note,
+	// no comma digit separators as the comma is a field separator here.
+	xyFormat = (trgCrs->prj_code == cs_PRJCOD_UNITY) ? 10L : 4L;
+	zzFormat = 4L;
+
+	// Open the files.
+	wcstombs (pathC,inputPath,MAXPATH);
+	inFile = fopen (pathC,binary ? "rb" : "rt");
+	wcstombs (pathC,outputPath,MAXPATH);
+	outFile = fopen (pathC,binary ? "wb" : "wt");
+	if (binary)
+	{
+		strcat (pathC,".sts");
+		stsFile = fopen (pathC,"wb");
+	}
+	if (inFile == 0 || outFile == 0 || (binary && stsFile == 0))
+	{
+		std::wcout << L"Open of input or output file failed." << std::endl;
+		goto error;
+	}
+	setvbuf (inFile,0,_IOFBF,1024 * 1024);
+	setvbuf (outFile,0,_IOFBF,1024 * 1024);
+
+	coords = new double [blockSize * dimension];
+	statusArray = new long32_t [blockSize];
+	valueCounts = new size_t [blockSize];
+
+	startClock = clock ();
+	if (binary)
+	{
+		// Binary; read a block, convert a block, write a block.
+		for (;;)
+		{
+			readCnt = fread (coords,sizeof (double) * dimension,blockSize,inFile);
+			if (readCnt == 0)
+			{
+				break;
+			}
+			csBulkConvertBlock (coords,statusArray,readCnt,dimension,srcCrs,trgCrs,dtcPrm);
+			if (fwrite (coords,sizeof (double) * dimension,readCnt,outFile) != readCnt ||
+				fwrite (statusArray,sizeof (long32_t),readCnt,stsFile) != readCnt)
+			{
+				std::wcout << L"Write to output file failed." << std::endl;
+				goto error;
+			}
+			for (idx = 0;idx < readCnt;idx += 1)
+			{
+				if (statusArray [idx] < 0) errorCount += 1;
+				else if (statusArray [idx] == 0) okCount += 1;
+				else if ((statusArray [idx] & cs_BASIC_DTCWRN) != 0) dtcWrnCount += 1;
+				else rangeCount += 1;
+			}
+			pointCount += readCnt;
+		}
+	}
+	else
+	{
+		// Text; parse a block of lines, convert the block, format the block.
+		// Lines which fail to parse are output as is, so we can't hold them
+		// back in the block; we flush the block before each such line.
+		bool eof (false);
+		while (!eof)
+		{
+			readCnt = 0;
+			while (readCnt < blockSize)
+			{
+				size_t valueCnt;
+				double* xyz = coords + (readCnt * dimension);
+
+				if (fgets (lineBufr,sizeof (lineBufr),inFile) == 0)
+				{
+					eof = true;
+					break;
+				}
+				if (dimension > 2)
+				{
+					xyz [2] = 0.0;
+				}
+				valueCnt = csBulkParseLine (xyz,dimension,lineBufr);
+				if (valueCnt == 0)
+				{
+					// Not a point.  Convert and write what we have so far,
+					// then copy the line to the output.
+					break;
+				}
+				valueCounts [readCnt] = valueCnt;
+				readCnt += 1;
+			}
+
+			csBulkConvertBlock (coords,statusArray,readCnt,dimension,srcCrs,trgCrs,dtcPrm);
+			for (idx = 0;idx < readCnt;idx += 1)
+			{
+				double* xyz = coords + (idx * dimension);
+
+				CS_ftoa (fmtBufr,sizeof (fmtBufr),xyz [0],xyFormat);
+				fputs (fmtBufr,outFile);
+				fputc (',',outFile);
+				CS_ftoa (fmtBufr,sizeof (fmtBufr),xyz [1],xyFormat);
+				fputs (fmtBufr,outFile);
+				if (valueCounts [idx] > 2)
+				{
+					fputc (',',outFile);
+					CS_ftoa (fmtBufr,sizeof (fmtBufr),xyz [2],zzFormat);
+					fputs (fmtBufr,outFile);
+				}
+				fprintf (outFile,",%d\n",statusArray [idx]);
+
+				if (statusArray [idx] < 0) errorCount += 1;
+				else if (statusArray [idx] == 0) okCount += 1;
+				else if ((statusArray [idx] & cs_BASIC_DTCWRN) != 0) dtcWrnCount += 1;
+				else rangeCount += 1;
+			}
+			pointCount += readCnt;
+
+			if (!eof && readCnt < blockSize)
+			{
+				// The line which terminated the block did not parse.
+				size_t len = strlen (lineBufr);
+				while (len > 0 && (lineBufr [len - 1] == '\n' || lineBufr [len - 1] == '\r'))
+				{
+					lineBufr [--len] = '\0';
+				}
+				fprintf (outFile,"%s,-1\n",lineBufr);
+			}
+		}
+	}
+	doneClock = clock ();
+	ok = (ferror (inFile) == 0) && (ferror (outFile) == 0);
+
+	elapsed = (double)(doneClock - startClock) / (double)CLOCKS_PER_SEC;
+	std::wcout << L"Converted "      << pointCount  << L" points from "
+			   << srcCrsName         << L" to "     << trgCrsName << L"." << std::endl;
+	std::wcout << L"    Normal: "    << okCount     << std::endl;
+	std::wcout << L"    Range: "     << rangeCount  << std::endl;
+	std::wcout << L"    Datum warning: " << dtcWrnCount << std::endl;
+	std::wcout << L"    Error: "     << errorCount  << std::endl;
+	std::wcout << L"Elapsed time " << std::fixed << std::setprecision (3) << elapsed << L" seconds";
+	if (elapsed > 0.0)
+	{
+		std::wcout << L", " << std::setprecision (0) << ((double)pointCount / elapsed) << L" points per second";
+	}
+	std::wcout << L"." << std::endl;
+
+error:
+	delete [] valueCounts;
+	delete [] statusArray;
+	delete [] coords;
+	if (stsFile != 0) fclose (stsFile);
+	if (outFile != 0) fclose (outFile);
+	if (inFile != 0) fclose (inFile);
+	if (dtcPrm != 0) CS_dtcls (dtcPrm);
+	if (trgCrs != 0) CS_free (trgCrs);
+	if (srcCrs != 0) CS_free (srcCrs);
+	return ok;
+}
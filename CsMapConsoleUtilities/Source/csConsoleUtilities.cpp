@@ -73,6 +73,51 @@ int main (int argc,char* argv [])
 		envStatus = CS_envsubWc (csTempDir,wcCount (csTempDir));
 	}
 
+	// The bulk file converter is the one utility which is driven from the
+	// command line, as it is used on data rather than on the dictionaries:
+	//
+	//	BulkConvert srcCrs trgCrs inputPath outputPath [/b] [/3] [/n<blockSize>]
+	//
+	// /b selects binary files, /3 three dimensional points, and /n the
+	// number of points converted per block.
+	if (argc >= 6 && CS_stricmp (argv [1],"BulkConvert") == 0)
+	{
+		bool binary (false);
+		bool threeD (false);
+		int argIdx;
+		unsigned long blockSize (0UL);
+		wchar_t srcCrsName [cs_KEYNM_DEF];
+		wchar_t trgCrsName [cs_KEYNM_DEF];
+		wchar_t inputPath [MAXPATH];
+		wchar_t outputPath [MAXPATH];
+
+		mbstowcs (srcCrsName,argv [2],wcCount (srcCrsName));
+		mbstowcs (trgCrsName,argv [3],wcCount (trgCrsName));
+		mbstowcs (inputPath,argv [4],wcCount (inputPath));
+		mbstowcs (outputPath,argv [5],wcCount (outputPath));
+		srcCrsName [wcCount (srcCrsName) - 1] = L'\0';
+		trgCrsName [wcCount (trgCrsName) - 1] = L'\0';
+		inputPath [wcCount (inputPath) - 1] = L'\0';
+		outputPath [wcCount (outputPath) - 1] = L'\0';
+		for (argIdx = 6;argIdx < argc;argIdx += 1)
+		{
+			if (CS_stricmp (argv [argIdx],"/b") == 0)
+			{
+				binary = true;
+			}
+			else if (CS_stricmp (argv [argIdx],"/3") == 0)
+			{
+				threeD = true;
+			}
+			else if (CS_strnicmp (argv [argIdx],"/n",2) == 0)
+			{
+				blockSize = strtoul (argv [argIdx] + 2,0,10);
+			}
+		}
+		ok = csBulkConvert (csDictDir,srcCrsName,trgCrsName,inputPath,outputPath,binary,threeD,blockSize);
+		return ok?0:-1;
+	}
+
 #ifdef __SKIP__
 	// The following untility is a frequently used one.  We leave here,
 	// but comment out so it can be used with ease.
@@ -39,9 +39,29 @@
 unsigned _stklen = 16384;		/* was once required, probably not anymore  */
 #endif 
 
+/* The incremental mode (the i option) uses a manifest, written to the result
+   directory, which carries a content hash for each of the dictionaries
+   compiled.  The hash covers the source file, the options which affect the
+   result, and the hashes of the dictionaries it depends upon.  Thus, a
+   change to the datum dictionary, for example, causes the coordinate system
+   dictionary to be recompiled as well. */
+#define csCOMP_MFTCNT 6
+struct csCompMft_
+{
+	char name [32];				/* name of the result file */
+	ulong32_t prvHash;			/* as read from the manifest, zero if none */
+	ulong32_t hash;				/* current hash, zero if not computable */
+};
+static char csCompMftName [] = "CS_Comp.mft";
+
 void usage (void);
 void acknowledge (void);
 int err_disp (char *mesg);
+ulong32_t CScompHash (Const char *path,ulong32_t seed);
+ulong32_t CScompHashMix (ulong32_t hash,ulong32_t value);
+int CScompCurrent (Const struct csCompMft_ *mftPtr,Const char *rsltPath);
+void CScompMftRd (struct csCompMft_ *mft,Const char *mftPath);
+int CScompMftWr (Const struct csCompMft_ *mft,Const char *mftPath);
 int cs_Batch;
 
 int main (int argc,char *argv [])
@@ -68,10 +88,12 @@ int main (int argc,char *argv [])
 	int crypt;
 	int demo;
 	int extents;
+	int incremental;
 	int test;
 	int warn;
 	int flags;
 	int err_cnt;
+	ulong32_t flgHash;
 
 	char *cp;
 
@@ -85,6 +107,9 @@ int main (int argc,char *argv [])
 	char mr_path [MAXPATH];
 	char gp_path [MAXPATH];
 	char gx_path [MAXPATH];
+	char mft_path [MAXPATH];
+
+	struct csCompMft_ mft [csCOMP_MFTCNT];
 
 #if _MEM_MODEL == _mm_VIRTUAL
 	cs_Sortbs = (128 * 1024);
@@ -108,6 +133,7 @@ int main (int argc,char *argv [])
 	demo = FALSE;
 	extents = TRUE;			/* Extents are normally on, option turns
 							   them off. */
+	incremental = FALSE;
 	warn = FALSE;
 	src_dir [0] = '\0';
 	dst_dir [0] = '\0';
@@ -137,6 +163,10 @@ int main (int argc,char *argv [])
 			{
 				extents = FALSE;
 			}
+			else if (*cp == 'i' || *cp == 'I')
+			{
+				incremental = TRUE;
+			}
 			else if (*cp == 's' || *cp == 'S')
 			{
 				/* Force CS_bswap to think that it is running
@@ -237,79 +267,149 @@ int main (int argc,char *argv [])
 	strcpy (gx_path,cs_Dir);
 	strcpy (cs_DirP,cs_Gpname);
 	strcpy (gp_path,cs_Dir);
+	strcpy (cs_DirP,csCompMftName);
+	strcpy (mft_path,cs_Dir);
 	*cs_DirP = '\0';
 	strcpy (mr_path,cs_Dir);
 
+	/* Prepare the manifest.  The order of the entries is the order in which
+	   the dictionaries are compiled below. */
+	CS_stncp (mft [0].name,cs_Elname,sizeof (mft [0].name));
+	CS_stncp (mft [1].name,cs_Dtname,sizeof (mft [1].name));
+	CS_stncp (mft [2].name,cs_Csname,sizeof (mft [2].name));
+	CS_stncp (mft [3].name,cs_Ctname,sizeof (mft [3].name));
+	CS_stncp (mft [4].name,cs_Gxname,sizeof (mft [4].name));
+	CS_stncp (mft [5].name,cs_Gpname,sizeof (mft [5].name));
+	CScompMftRd (mft,mft_path);
+	flgHash = CScompHashMix (0x811C9DC5UL,(ulong32_t)flags);
+	flgHash = CScompHashMix (flgHash,(ulong32_t)cs_BswapU.cccc [0]);
+
 	/* Compile the Ellipsoid Dictionary. */
 	strcpy (src_name,src_dir);
 	strcat (src_name,"elipsoid.asc");
-	printf ("Compiling %s to %s.\n",src_name,el_path);
-	err_cnt = CSelcomp (src_name,el_path,flags,err_disp);
-	if (err_cnt != 0)
+	mft [0].hash = CScompHash (src_name,flgHash);
+	if (incremental && CScompCurrent (&mft [0],el_path))
 	{
-		printf ("Compilation of %s failed, %s removed.\n",src_name,el_path);
-		if (!batch) acknowledge ();
-		return (1);
+		printf ("%s is up to date.\n",el_path);
+	}
+	else
+	{
+		printf ("Compiling %s to %s.\n",src_name,el_path);
+		err_cnt = CSelcomp (src_name,el_path,flags,err_disp);
+		if (err_cnt != 0)
+		{
+			printf ("Compilation of %s failed, %s removed.\n",src_name,el_path);
+			if (!batch) acknowledge ();
+			return (1);
+		}
 	}
 
 	/* Compile the Datum Dictionary. */
 	strcpy (src_name,src_dir);
 	strcat (src_name,"datums.asc");
-	printf ("Compiling %s to %s.\n",src_name,dt_path);
-	err_cnt = CSdtcomp (src_name,dt_path,flags,el_path,err_disp);
-	if (err_cnt != 0)
+	mft [1].hash = CScompHash (src_name,CScompHashMix (flgHash,mft [0].hash));
+	if (incremental && CScompCurrent (&mft [1],dt_path))
 	{
-		printf ("Compilation of %s failed, %s removed.\n",src_name,dt_path);
-		if (!batch) acknowledge ();
-		return (1);
+		printf ("%s is up to date.\n",dt_path);
+	}
+	else
+	{
+		printf ("Compiling %s to %s.\n",src_name,dt_path);
+		err_cnt = CSdtcomp (src_name,dt_path,flags,el_path,err_disp);
+		if (err_cnt != 0)
+		{
+			printf ("Compilation of %s failed, %s removed.\n",src_name,dt_path);
+			if (!batch) acknowledge ();
+			return (1);
+		}
 	}
 
 	/* Compile the Coordinate System Dictionary. */
 	strcpy (src_name,src_dir);
 	strcat (src_name,"coordsys.asc");
-	printf ("Compiling %s to %s.\n",src_name,cs_path);
-	err_cnt = CScscomp (src_name,cs_path,flags,el_path,dt_path,err_disp);
-	if (err_cnt != 0)
+	mft [2].hash = CScompHash (src_name,CScompHashMix (CScompHashMix (flgHash,mft [0].hash),mft [1].hash));
+	if (incremental && CScompCurrent (&mft [2],cs_path))
+	{
+		printf ("%s is up to date.\n",cs_path);
+	}
+	else
 	{
-		printf ("Compilation of %s failed, %s removed.\n",src_name,cs_path);
-		if (!batch) acknowledge ();
-		return (1);
+		printf ("Compiling %s to %s.\n",src_name,cs_path);
+		err_cnt = CScscomp (src_name,cs_path,flags,el_path,dt_path,err_disp);
+		if (err_cnt != 0)
+		{
+			printf ("Compilation of %s failed, %s removed.\n",src_name,cs_path);
+			if (!batch) acknowledge ();
+			return (1);
+		}
 	}
 
 	/* Compile the Category Dictionary. */
 	strcpy (src_name,src_dir);
 	strcat (src_name,"category.asc");
-	printf ("Compiling %s to %s.\n",src_name,ct_path);
-	err_cnt = CSctcomp (src_name,ct_path,flags,cs_path,err_disp);
-	if (err_cnt != 0)
+	mft [3].hash = CScompHash (src_name,CScompHashMix (flgHash,mft [2].hash));
+	if (incremental && CScompCurrent (&mft [3],ct_path))
+	{
+		printf ("%s is up to date.\n",ct_path);
+	}
+	else
 	{
-		printf ("Compilation of %s failed, %s removed.\n",src_name,ct_path);
-		if (!batch) acknowledge ();
-		return (1);
+		printf ("Compiling %s to %s.\n",src_name,ct_path);
+		err_cnt = CSctcomp (src_name,ct_path,flags,cs_path,err_disp);
+		if (err_cnt != 0)
+		{
+			printf ("Compilation of %s failed, %s removed.\n",src_name,ct_path);
+			if (!batch) acknowledge ();
+			return (1);
+		}
 	}
 
 	/* Compile the Geodetic Transformation Dictionary. */
 	strcpy (src_name,src_dir);
 	strcat (src_name,"GeodeticTransformation.asc");
-	printf ("Compiling %s to %s.\n",src_name,gx_path);
-	err_cnt = CSgxcomp (src_name,gx_path,flags,dt_path,err_disp);
-	if (err_cnt != 0)
+	mft [4].hash = CScompHash (src_name,CScompHashMix (flgHash,mft [1].hash));
+	if (incremental && CScompCurrent (&mft [4],gx_path))
 	{
-		printf ("Compilation of %s failed, %s removed.\n",src_name,gp_path);
-		if (!batch) acknowledge ();
-		return (1);
+		printf ("%s is up to date.\n",gx_path);
+	}
+	else
+	{
+		printf ("Compiling %s to %s.\n",src_name,gx_path);
+		err_cnt = CSgxcomp (src_name,gx_path,flags,dt_path,err_disp);
+		if (err_cnt != 0)
+		{
+			printf ("Compilation of %s failed, %s removed.\n",src_name,gp_path);
+			if (!batch) acknowledge ();
+			return (1);
+		}
 	}
 
 	/* Compile the Geodetic Path Dictionary. */
 	strcpy (src_name,src_dir);
 	strcat (src_name,"GeodeticPath.asc");
-	printf ("Compiling %s to %s.\n",src_name,gp_path);
-	err_cnt = CSgpcomp (src_name,gp_path,flags,dt_path,gx_path,err_disp);
-	if (err_cnt != 0)
+	mft [5].hash = CScompHash (src_name,CScompHashMix (CScompHashMix (flgHash,mft [1].hash),mft [4].hash));
+	if (incremental && CScompCurrent (&mft [5],gp_path))
 	{
-		printf ("Compilation of %s failed, %s removed.\n",src_name,gp_path);
-		if (!batch) acknowledge ();
-		return (1);
+		printf ("%s is up to date.\n",gp_path);
+	}
+	else
+	{
+		printf ("Compiling %s to %s.\n",src_name,gp_path);
+		err_cnt = CSgpcomp (src_name,gp_path,flags,dt_path,gx_path,err_disp);
+		if (err_cnt != 0)
+		{
+			printf ("Compilation of %s failed, %s removed.\n",src_name,gp_path);
+			if (!batch) acknowledge ();
+			return (1);
+		}
+	}
+
+	/* Record what we compiled for the benefit of the next incremental
+	   compilation.  Failure to do so simply means the next incremental
+	   compilation will be a full one. */
+	if (CScompMftWr (mft,mft_path) != 0)
+	{
+		printf ("Warning: couldn't write %s.\n",mft_path);
 	}
 
 
@@ -389,6 +489,108 @@ void usage (void)
 {
 	extern char cs_OptchrC;
 
-	(void)printf ("Usage: CS_COMP [%cc] [%cb] [%cd] [%ct] [source_dir [result_dir]]\n",cs_OptchrC,cs_OptchrC,cs_OptchrC,cs_OptchrC);
+	(void)printf ("Usage: CS_COMP [%cc] [%cb] [%cd] [%ci] [%ct] [source_dir [result_dir]]\n",cs_OptchrC,cs_OptchrC,cs_OptchrC,cs_OptchrC,cs_OptchrC);
 	return;
 }
+
+/* 32 bit FNV-1a hash of a value, added to an existing hash. */
+ulong32_t CScompHashMix (ulong32_t hash,ulong32_t value)
+{
+	int ii;
+
+	for (ii = 0;ii < 4;ii += 1)
+	{
+		hash ^= (value >> (ii * 8)) & 0xFFUL;
+		hash = (hash * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	return hash;
+}
+
+/* 32 bit FNV-1a hash of the contents of a file, started with the provided
+   seed value.  Returns zero if the file can't be read; zero is never
+   considered to be a valid hash. */
+ulong32_t CScompHash (Const char *path,ulong32_t seed)
+{
+	size_t ii;
+	size_t rdCnt;
+	ulong32_t hash;
+	csFILE *strm;
+	unsigned char bufr [4096];
+
+	strm = CS_fopen (path,_STRM_BINRD);
+	if (strm == NULL) return 0UL;
+	hash = seed;
+	while ((rdCnt = CS_fread (bufr,1,sizeof (bufr),strm)) > 0)
+	{
+		for (ii = 0;ii < rdCnt;ii += 1)
+		{
+			hash ^= (ulong32_t)bufr [ii];
+			hash = (hash * 16777619UL) & 0xFFFFFFFFUL;
+		}
+	}
+	if (ferror (strm)) hash = 0UL;
+	CS_fclose (strm);
+	if (hash == 0UL) hash = 1UL;
+	return hash;
+}
+
+/* Returns TRUE if the result file exists and was produced from exactly the
+   same input as we have now. */
+int CScompCurrent (Const struct csCompMft_ *mftPtr,Const char *rsltPath)
+{
+	if (mftPtr->hash == 0UL || mftPtr->hash != mftPtr->prvHash) return FALSE;
+	return (CS_access (rsltPath,0) == 0);
+}
+
+/* Reads the manifest, if any.  Each line consists of a result file name and
+   the hash, in hex, of the input from which it was produced. */
+void CScompMftRd (struct csCompMft_ *mft,Const char *mftPath)
+{
+	int ii;
+	char *cp;
+	csFILE *strm;
+	unsigned long hash;
+	char lineBufr [128];
+
+	for (ii = 0;ii < csCOMP_MFTCNT;ii += 1)
+	{
+		mft [ii].prvHash = 0UL;
+		mft [ii].hash = 0UL;
+	}
+	strm = CS_fopen (mftPath,_STRM_TXTRD);
+	if (strm == NULL) return;
+	while (CS_fgets (lineBufr,sizeof (lineBufr),strm) != NULL)
+	{
+		cp = strchr (lineBufr,' ');
+		if (cp == NULL) continue;
+		*cp++ = '\0';
+		hash = strtoul (cp,NULL,16);
+		for (ii = 0;ii < csCOMP_MFTCNT;ii += 1)
+		{
+			if (!CS_stricmp (mft [ii].name,lineBufr))
+			{
+				mft [ii].prvHash = (ulong32_t)hash;
+			}
+		}
+	}
+	CS_fclose (strm);
+	return;
+}
+
+/* Writes the manifest.  Returns zero on success. */
+int CScompMftWr (Const struct csCompMft_ *mft,Const char *mftPath)
+{
+	int ii;
+	int st;
+	csFILE *strm;
+
+	strm = CS_fopen (mftPath,_STRM_TXTWR);
+	if (strm == NULL) return -1;
+	st = 0;
+	for (ii = 0;ii < csCOMP_MFTCNT;ii += 1)
+	{
+		if (fprintf (strm,"%s %08lX\n",mft [ii].name,(unsigned long)mft [ii].hash) < 0) st = -1;
+	}
+	if (CS_fclose (strm) != 0) st = -1;
+	return st;
+}
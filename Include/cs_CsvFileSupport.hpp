@@ -97,6 +97,8 @@ std::wstring csQuoteCsvField (const std::wstring& csvField,bool forceIt = false,
 const char* CS_ccPad (int length);
 const wchar_t* CS_wcPad (int length);
 
+class TcsCsvReader;
+
 //newPage//
 //=============================================================================
 // TcsCsvStatus Object -- Encapsulates the functionality of a Comma Separated
@@ -178,6 +180,7 @@ public:
 	short FindField (const std::wstring& fieldId,TcsCsvStatus& status) const;
 	EcsCsvStatus ReplaceRecord (const std::wstring& newRecord,TcsCsvStatus& status,const wchar_t* delimiters = 0);
 	EcsCsvStatus ReplaceRecord (std::wistream& iStrm,TcsCsvStatus& status,const wchar_t* delimiters = 0);
+	EcsCsvStatus ReplaceRecord (TcsCsvReader& csvReader,TcsCsvStatus& status);
 	bool ReturnAsRecord (std::wstring& record,TcsCsvStatus& status,const wchar_t* delimiters = 0) const;
 	bool WriteToStream (std::wostream& oStrm,TcsCsvStatus& status,const wchar_t* delimiters = 0) const;
 private:
@@ -187,6 +190,81 @@ private:
 };
 //newPage//
 //=============================================================================
+// TcsCsvReader Object -- Buffered extraction and parsing of CSV records.
+//
+// Reads the source stream in large blocks (or uses a block of text supplied
+// by the caller, e.g. a memory mapped file which has already been converted
+// to wide characters) and locates records and fields in place.  The result
+// of a parse is a list of field spans which point into the reader's buffer;
+// no std::wstring is constructed for a field until it is actually asked for
+// via GetField, or a TcsCsvRecord is populated from the reader.
+//
+// Record isolation follows exactly the rules of csGetCsvRecord, and field
+// parsing follows exactly the rules of csCsvFieldParse; the status values
+// returned are the same as those functions would return for the same text.
+//
+// Field spans remain valid only until the next call to NextRecord.
+//
+// When reading from a stream, the reader extracts whole blocks, so the stream
+// is consumed beyond the last record returned by NextRecord; it is left at
+// the end of the last block read, not at a record boundary.  Any text which
+// follows the records wanted must be read through the same reader, not from
+// the stream directly.
+//=============================================================================
+struct TcsCsvFieldSpan
+{
+	const wchar_t* FieldPtr;	// first character of the field, quote excluded
+	size_t FieldLength;			// characters in the buffer, quotes excluded
+	bool Quoted;				// field was quoted in the source text
+	bool Cooked;				// escapes and/or carriage returns need removal
+};
+class TcsCsvReader
+{
+public:
+	static const size_t DefaultBlockSize;
+	//=========================================================================
+	// Construction, Destruction, Assignment
+	TcsCsvReader (std::wistream& iStrm,const wchar_t* delimiters = 0,size_t blockSize = 0);
+	TcsCsvReader (const wchar_t* csvText,size_t csvLength,const wchar_t* delimiters = 0);
+	~TcsCsvReader (void);
+	//=========================================================================
+	// Public Named Member Functions
+	bool AtEof (void) const;
+	EcsCsvStatus NextRecord (void);
+	EcsCsvStatus ParseFields (void);
+	short FieldCount (void) const;
+	const TcsCsvFieldSpan* GetFieldSpan (short fieldNbr) const;
+	bool GetField (std::wstring& field,short fieldNbr) const;
+private:
+	// Not implemented; spans point into the buffer owned by this object.
+	TcsCsvReader (const TcsCsvReader& source);
+	TcsCsvReader& operator= (const TcsCsvReader& rhs);
+	//=========================================================================
+	// Private Named Member Functions
+	void SetDelimiters (const wchar_t* delimiters);
+	bool Refill (void);
+	size_t SkipReturns (size_t position) const;
+	//=========================================================================
+	// Private Data Members
+	std::wistream* IStrm;
+	bool StrmDone;
+	bool EofSeen;
+	bool FieldsParsed;
+	wchar_t Separator;
+	wchar_t Quote;
+	wchar_t Escape;
+	wchar_t Comment;
+	const wchar_t* Data;
+	size_t DataEnd;
+	size_t RecBeg;
+	size_t RecEnd;
+	size_t NextPos;
+	EcsCsvStatus ParseStatus;
+	std::vector<wchar_t> Buffer;
+	std::vector<TcsCsvFieldSpan> Spans;
+};
+//newPage//
+//=============================================================================
 // CSV File Sort Function Object
 //
 // Create an object of this type to specify the fields which are to be used in
@@ -286,6 +364,9 @@ public:
 	bool LocateNext (unsigned& recordNumber,const wchar_t* fieldId,const wchar_t* srchString,bool honorCase = false) const;
 	bool StableSort (const TcsCsvSortFunctor& functor);
 	unsigned LowerBound (const TcsCsvRecord& searchRec,const TcsCsvSortFunctor& functor);
+	// Reads records until end of file.  Since the stream is read in blocks
+	// (see TcsCsvReader), on an error the stream will have been consumed
+	// beyond the record in error.
 	bool ReadFromStream (std::wistream& iStrm,bool firstIsLabels,TcsCsvStatus& status);
 	bool AppendRecord (const TcsCsvRecord& newRecord,TcsCsvStatus& status);
 	// Frequent use of RemoveRecord will be very painful performance wise.
@@ -319,6 +319,28 @@ void CSinitGridCell (struct csGridCell_* thisPtr);
 double CScalcGridCell (struct csGridCell_* thisPtr,Const double *sourceLL);
 const char *CSsourceGridCell (struct csGridCell_* thisPtr);
 
+/* Shift Cell Object -->  Used by the iterative inverse of the grid
+   interpolation techniques.  Describes the bilinear shift, in degrees,
+   which the forward function applies within a single grid cell, in east
+   positive terms regardless of the file format:
+
+	   target = source + AA + BB * xx + CC * yy + DD * xx * yy
+	   where xx = (source [LNG] - origin [LNG]) / delta [LNG]
+	   and   yy = (source [LAT] - origin [LAT]) / delta [LAT]
+
+   with separate coefficients for longitude and latitude.  The forward
+   function has this information in hand once it has interpolated a point,
+   so each inverse builds one of these from the cell(s) left behind by the
+   forward and solves for the source point with Newton's method, without
+   further reference to the grid file. */
+struct csGridShiftCell_
+{
+	double origin [2];
+	double delta [2];
+	double lngCoef [4];					/* AA, BB, CC, DD */
+	double latCoef [4];
+};
+
 
 
 
@@ -726,6 +748,14 @@ values for the results.*/
 /* TODO!!!  Needs a flalback provision here. */
 #define cs_MULRG_MAXDEG 13
 #define cs_MULRG_MAXCOEF 105	 /* ((MAXDEG + 1) * (MAXDEG + 2) / 2) */
+#define cs_MULRG_MAXPWR 10		/* Powers actually evaluated are 0 thru 9. */
+#define cs_MULRG_MAXTERMS 100	/* cs_MULRG_MAXPWR squared */
+struct csMulrgTerm_
+{
+	unsigned char idx;		/* Index of the non-zero coefficient. */
+	unsigned char uu;
+	unsigned char vv;		/* Power of the uu and vv terms. */
+};
 struct csMulrg_
 {
 	short max_uu;
@@ -734,11 +764,6 @@ struct csMulrg_
 	ulong32_t fill01;		/* Force alignment on an 8
 							   byte boundary for all
 							   compilers. */
-	ulong32_t phiMap [4];
-	ulong32_t lambdaMap [4];
-	ulong32_t heightMap [4];/* A bit map of the coefficients which
-							   are present (i.e. non-zero) for the
-							   longitude calculation. */
 	double normalizationScale;
 							/* The normalizing scale factor for the
 							   multiple regression. */
@@ -757,6 +782,19 @@ struct csMulrg_
 	double lambdaCoefs [cs_MULRG_MAXCOEF];
 	double heightCoefs [cs_MULRG_MAXCOEF];
 
+	/* The non-zero terms of the three expansions, compiled by CSmulrgS
+	   in the order in which the original double loop visits them.
+	   Evaluation simply walks these lists, skipping the zero terms,
+	   producing bit for bit the same sums.  The terms refer to the
+	   coefficient arrays above, keeping the lists small. */
+	short phiCnt;
+	short lambdaCnt;
+	short heightCnt;
+	short fill02;
+	struct csMulrgTerm_ phiTerms [cs_MULRG_MAXTERMS];
+	struct csMulrgTerm_ lambdaTerms [cs_MULRG_MAXTERMS];
+	struct csMulrgTerm_ heightTerms [cs_MULRG_MAXTERMS];
+
 	double errorValue;
 	double cnvrgValue;
 	short maxIterations;
@@ -1183,14 +1221,9 @@ struct cs_GeodeticPath_
    in the Geodetic Transformation definition should end up here. */
 struct cs_GxXform_
 {
-	struct cs_GeodeticTransform_ gxDef;		/* a copy of the original definition. */
-
-	/* Thie following stuff is common to (most) all datum transformation
-	   types. */
-	struct cs_Datum_ srcDatum;				/* supplies the source ellipsoid */			
-	struct cs_Datum_ trgDatum;				/* supplies the target ellipsoid */	
-	struct csGridCoverage_ xfrmCoverage;	/* Useful extent of the transformation */
-
+	/* The members referenced by the conversion functions come first;
+	   the definitions from which they were computed, and the descriptive
+	   stuff, follow the parameter union. */
 	short methodCode;
 	short isNullXfrm;
 	short maxItr;
@@ -1237,6 +1270,14 @@ struct cs_GxXform_
 		struct csParm3_   parm3;		/* Obsolete, used for legacy purposes only. */
 	} xforms;
 
+	struct cs_GeodeticTransform_ gxDef;		/* a copy of the original definition. */
+
+	/* The following stuff is common to (most) all datum transformation
+	   types, but is not referenced by the conversion functions. */
+	struct cs_Datum_ srcDatum;				/* supplies the source ellipsoid */			
+	struct cs_Datum_ trgDatum;				/* supplies the target ellipsoid */	
+	struct csGridCoverage_ xfrmCoverage;	/* Useful extent of the transformation */
+
 	/* The following is common to all transformation types, but are
 	   not involved with the actual mathemagics of the process. */
 	char xfrmName [64];
@@ -1400,6 +1441,7 @@ int EXP_LVL5 CS_locateGxFromDatum (int* direction,Const char* srcDtmName);
 int EXP_LVL5 CS_locateGxToDatum (int* direction,Const char* trgDtmName);
 int EXP_LVL5 CS_locateGxByDatum2 (int* direction,Const char* srcDtmName,Const char* trgDtmName);
 void EXP_LVL9 CSgenerateGxIndex (void);
+int EXP_LVL9 CSinvertShiftCell (Const struct csGridShiftCell_* thisPtr,double result [2],Const double target [2],double cnvrgValue);
 
 struct cs_GxXform_ EXP_LVL5 *CS_gxloc (Const char* gxDefName,short userDirection);
 struct cs_GxXform_ EXP_LVL5 *CS_gxloc1 (Const struct cs_GeodeticTransform_ *gxXform,short userDirection);
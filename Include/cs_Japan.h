@@ -88,6 +88,18 @@ struct cs_Japan_
 	long32_t bufferSize;		/* Size of the I/O buffer in use. */
 	void *dataBuffer;			/* not allocated until required, i.e.
 								   file is actually opened. */
+	struct csJgd2kGridRecord_ *meshHash;
+								/* If bufferSize is at least the size of
+								   the binary file, the entire file is
+								   loaded into this open addressed hash
+								   table, keyed by mesh code, the first
+								   time it is needed.  Zero mesh code
+								   marks an empty slot.  NULL otherwise. */
+	ulong32_t hashMask;			/* Number of slots in meshHash less one. */
+	ulong32_t cellHits;			/* Number of points which were in the
+								   last grid cell used. */
+	ulong32_t cellMisses;		/* Number of points which required a new
+								   grid cell to be extracted. */
 	struct csGridCell_ lngCell;	/* Last longitude cell actually used. */
 	struct csGridCell_ latCell;	/* Last latitude cwll actaully used. */
 	char filePath [MAXPATH];	/* Full path to data source file. */
@@ -96,6 +108,10 @@ struct cs_Japan_
 	short maxIterations;
 };
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 ulong32_t			EXP_LVL9	CSjpnLlToMeshCode (const double ll [2]);
 void				EXP_LVL9	CSjpnMeshCodeToLl (double ll [2],ulong32_t meshCode);
 int					EXP_LVL9	CScompareJgd2kGridRecord (const struct csJgd2kGridRecord_ *elem1,const struct csJgd2kGridRecord_ *elem2);
@@ -105,3 +121,7 @@ void				EXP_LVL7	CSdeleteJgd2kGridFile (struct cs_Japan_ *__This);
 int					EXP_LVL9	CSextractJgd2kGridFile (struct cs_Japan_ *__This,Const double* sourceLL);
 int					EXP_LVL9	CScalcJgd2kGridFile (struct cs_Japan_* __This,double result [2],Const double* sourceLL);
 int					EXP_LVL9	CSmakeBinaryJgd2kFile (struct cs_Japan_* __This);
+
+#ifdef __cplusplus
+}
+#endif
@@ -5379,53 +5379,13 @@ struct cs_Gauss_
 
 struct cs_Csprm_
 {
-	struct cs_Csdef_ csdef;	/* The coordinate system definition
-							   as obtained from the coordinate
-							   system dictionary. */
-	struct cs_Datum_ datum;	/* The datum definition as obtained
-							   from the datum dictionary. */
+	/* The members referenced on every conversion (i.e. the function
+	   pointers and the projection parameters) come first.  The useful
+	   range and the definitions from which all of this was computed
+	   follow, so that when many of these structures are in use the
+	   frequently referenced data of each occupies as few cache lines
+	   as possible. */
 
-	/* Information for the following is supplied by the
-	   setup function.  If the coordinate system definition
-	   carries values for the useful range of the coordinate
-	   system, the supplied values are placed here without
-	   checking or limitation.  All checks (i.e. CS_xychk
-	   and CS_llchk) always check the mathematical domain
-	   which is independent of this check.  Therefore,
-	   specifying large values can essentially disable this
-	   checking feature on a coordinate system by
-	   coordinate system basis.
-
-	   If the coordinate system definition does not carry
-	   values for these limits, the setup function will
-	   calculate some values appropriate for the coordinate
-	   system and its underlying projection.
-
-	   The lat/long values are in degrees, and longitude
-	   values are relative to the cent_mer element.  The
-	   cent_mer element is required to solve the -180
-	   degree longitude crack problem. */
-
-	double cent_mer;		/* The longitude upon which the min and
-							   max longitudes are based; in degrees. */
-	double min_ll [2];		/* The delta longitude and absolute latitude
-							   of the southwestern extent of the useful
-							   range of this coordinate system; in
-							   degrees. */
-	double max_ll [2];		/* The delta longitude and absolute latitude
-							   of the north eastern extent of the useful
-							   range of this coordinate system; in
-							   degrees. */
-	double min_xy [2];		/* The minimum X and Y coordinates of the
-							   useful range of this coordinate system.
-							   Values and units are per coordinate
-							   system definition and include the false
-							   origin.  For a coordinate system in a
-							   quadrant other than the first quad,
-							   these values may not be the southwestern
-							   extent as would normally be expected. */
-	double max_xy [2];		/* The minimum X and Y coordinates of the
-							   useful range of this coordinate system. */
 	unsigned short prj_code;
 							/* The projection code extracted from the
 							   projection table for the active
@@ -5467,6 +5427,13 @@ struct cs_Csprm_
 							   returns the scale of the
 							   coordinate system at the
 							   referenced lat/long point. */
+	void (*cs_dstrt)(Const void *prj_prms,Const double *ll,double *khc);
+							/* Optional, NULL if not provided.
+							   Pointer to a function which
+							   returns the K and H scale factors
+							   and the convergence ([0], [1] and
+							   [2]) in one go, for use by
+							   CS_csDistortion. */
 	int (*llchk)(Const void *prj_prms,int cnt,Const double pnts [][3]);
 							/* Pointer to the function which
 							   checks if the geographic domain
@@ -5525,6 +5492,53 @@ struct cs_Csprm_
 		struct cs_Sys34_ sys34;
 		struct cs_Winkl_ winkl;
 	} proj_prms;
+
+	/* Information for the following is supplied by the
+	   setup function.  If the coordinate system definition
+	   carries values for the useful range of the coordinate
+	   system, the supplied values are placed here without
+	   checking or limitation.  All checks (i.e. CS_xychk
+	   and CS_llchk) always check the mathematical domain
+	   which is independent of this check.  Therefore,
+	   specifying large values can essentially disable this
+	   checking feature on a coordinate system by
+	   coordinate system basis.
+
+	   If the coordinate system definition does not carry
+	   values for these limits, the setup function will
+	   calculate some values appropriate for the coordinate
+	   system and its underlying projection.
+
+	   The lat/long values are in degrees, and longitude
+	   values are relative to the cent_mer element.  The
+	   cent_mer element is required to solve the -180
+	   degree longitude crack problem. */
+
+	double cent_mer;		/* The longitude upon which the min and
+							   max longitudes are based; in degrees. */
+	double min_ll [2];		/* The delta longitude and absolute latitude
+							   of the southwestern extent of the useful
+							   range of this coordinate system; in
+							   degrees. */
+	double max_ll [2];		/* The delta longitude and absolute latitude
+							   of the north eastern extent of the useful
+							   range of this coordinate system; in
+							   degrees. */
+	double min_xy [2];		/* The minimum X and Y coordinates of the
+							   useful range of this coordinate system.
+							   Values and units are per coordinate
+							   system definition and include the false
+							   origin.  For a coordinate system in a
+							   quadrant other than the first quad,
+							   these values may not be the southwestern
+							   extent as would normally be expected. */
+	double max_xy [2];		/* The minimum X and Y coordinates of the
+							   useful range of this coordinate system. */
+	struct cs_Csdef_ csdef;	/* The coordinate system definition
+							   as obtained from the coordinate
+							   system dictionary. */
+	struct cs_Datum_ datum;	/* The datum definition as obtained
+							   from the datum dictionary. */
 };
 
 /*
@@ -5712,6 +5726,23 @@ struct cs_Csgrplst_
 	char unit [16];
 };
 
+/* An element of the array returned by CS_csEnumAll. */
+struct cs_Csenum_
+{
+	char key_nm [24];
+	char group [24];
+	char descr [64];
+};
+
+/* An element of the array returned by CS_csDistortion. */
+struct cs_Distortion_
+{
+	double k;			/* As returned by CS_cssck. */
+	double h;			/* As returned by CS_cssch. */
+	double scale;		/* As returned by CS_csscl. */
+	double cnvrg;		/* As returned by CS_cscnv, degrees. */
+};
+
 #define cs_GRPTBL_ACTIVE    0x01
 #define cs_GRPTBL_END	    0x80
 
@@ -5762,6 +5793,63 @@ struct csDtcach_
 	char dst_cs [24];
 };
 
+/*
+	CS_dtloc keeps the most recently located cs_Datum_
+	structures in the following cache, so that setting up
+	many coordinate systems referenced to a handful of datums
+	does not read the datum and ellipsoid dictionaries over
+	and over again.  The cache is released whenever either
+	dictionary is modified or a different dictionary is
+	selected; it is bypassed entirely while any of the datum
+	or ellipsoid hooks are active.  Set csDtmcachI to zero
+	(before CS_dtloc is first called) to disable the cache.
+*/
+
+#define cs_DTMCACH_MAX 16
+struct csDtmcach_
+{
+	ulong32_t hash;				/* CSkeyHash of dt_nam */
+	ulong32_t lastUse;
+	char dt_nam [24];
+	struct cs_Datum_ datum;
+};
+
+/*
+	The following is an in memory index of the useful range of every
+	coordinate system in the dictionary; used by CS_csRangeEnumSetup
+	and CS_csRangeEnumSetupEx.  It is built, in dictionary order, the
+	first time it is needed and released whenever the coordinate system
+	dictionary is modified (or by CS_recvr).
+
+	The geographic domain is divided into a grid of cells.  For each
+	cell, cellList contains (in ascending order) the index of every entry
+	whose useful range overlaps the cell; cellStart gives the location
+	of each cell's sub-list in cellList.  Entries whose useful range
+	extends beyond +/- 180 longitude or +/- 90 latitude are listed in
+	wideList and are always tested.  Entries with an empty range (min
+	greater than max) can never be selected and are not listed at all.
+*/
+#define cs_RNGIDX_CELL   10.0
+#define cs_RNGIDX_LNGCNT 36
+#define cs_RNGIDX_LATCNT 18
+struct csCsRngEntry_
+{
+	char key_nm [24];
+	char group [24];
+	char dat_knm [24];
+	double ll_min [2];
+	double ll_max [2];
+};
+struct csCsRngIdx_
+{
+	int entryCount;
+	int wideCount;
+	struct csCsRngEntry_ *entries;
+	int *wideList;
+	int *cellList;
+	int cellStart [cs_RNGIDX_LNGCNT * cs_RNGIDX_LATCNT + 1];
+};
+
 /* MGRS object definition.  (Military Grid Reference System) */
 struct cs_Mgrs_
 {
@@ -5772,6 +5860,9 @@ struct cs_Mgrs_
 	struct cs_Trmer_ SouthHemi;		/* TM parameters, southern hemisphere */
 	struct cs_Pstro_ NorthPole;		/* UPS parameters, north pole */
 	struct cs_Pstro_ SouthPole;		/* UPS parameters, south pole */
+	double BandNorthing [20];		/* TM northing, on the central meridian, of
+									   the southern edge of each 8 degree
+									   latitude band; C thru X. */
 };
 
 /* The following enumerates the various possibilities of coodinate
@@ -5829,6 +5920,9 @@ int CScalcMgrsFromLlUtm (struct cs_Mgrs_ *__This,char *result,int size,double la
 int CScalcLlFromMgrs (struct cs_Mgrs_ *__This,double ll [2],Const char *mgrsString);
 int CScalcLlFromMgrsEx (struct cs_Mgrs_ *__This,double ll [2],Const char *mgrsString,short grdSqrPos);
 int CScalcRegnFromMgrs (struct cs_Mgrs_ *_This,double sw [2],double ne [2],Const char *mgrs);
+int CScalcMgrsFromLlArray (struct cs_Mgrs_ *__This,char *results,int size,Const double latLng [][2],int cnt,int prec,int status []);
+int CScalcUtmUpsArray (struct cs_Mgrs_ *__This,double utmUps [][2],Const double latLng [][2],int cnt,int utmZones []);
+int CScalcLlFromMgrsArray (struct cs_Mgrs_ *__This,double latLng [][2],Const char *mgrsStrings [],int cnt,short grdSqrPos,int status []);
 #ifdef __cplusplus
 }
 #endif
@@ -6509,6 +6603,145 @@ int CScalcRegnFromMgrs (struct cs_Mgrs_ *_This,double sw [2],double ne [2],Const
 
 #define cs_ERROR_MAX	  cs_SELF_TEST
 
+/*
+	Error reporting modes, see CS_errorMode.  In the cs_ERRMODE_FORMAT mode,
+	the default, CS_erpt formats the message text into csErrmsg immediately.
+	In the cs_ERRMODE_LAZY mode, CS_erpt records only the error code and its
+	parameters; the text is not produced until CS_errmsg is called.  In the
+	cs_ERRMODE_COUNT mode, CS_erpt only sets cs_Error and counts the error;
+	this is intended for bulk jobs which expect millions of warnings.  The
+	per code counters are maintained in all modes.  Note that code which
+	reads csErrmsg directly, rather than calling CS_errmsg, will see stale
+	text in the lazy and count modes.
+*/
+#define cs_ERRMODE_FORMAT	0
+#define cs_ERRMODE_LAZY		1
+#define cs_ERRMODE_COUNT	2
+
+/* The following record a reported error in a ring of recent errors.  The
+   name insert is truncated to the size of an error message, which is as
+   long as it could ever be used. */
+#define cs_ERRRING_SIZE 8
+struct csErrRec_
+{
+	int errNum;
+	int errNo;
+	int errLng;
+	int errLat;
+	char errNam [cs_ERRMSG_SIZE];
+};
+struct csErrRing_
+{
+	ulong32_t count;				/* total number of errors recorded; the next
+									   one goes in slot count % cs_ERRRING_SIZE */
+	int pending;					/* TRUE if csErrmsg does not reflect the
+									   most recently recorded error yet. */
+	struct csErrRec_ recs [cs_ERRRING_SIZE];
+};
+
+/*
+	Memory allocation hooks, see CS_setAllocator.  All memory obtained
+	through CS_malc, CS_calc and CS_ralc, and released through CS_free,
+	is directed to the allocator installed at run time; the compile time
+	_csMalloc etc. macros remain the default.  The size function is
+	optional; when provided, CS_malc and CS_free maintain the live and
+	peak byte counts of the allocation statistics.  The counters are
+	otherwise maintained regardless of the allocator in use.
+*/
+struct cs_Allocator_
+{
+	void *(*malcFunc)(void *context,size_t blkSize);
+	void *(*ralcFunc)(void *context,void *ptr,size_t newSize);
+	void (*freeFunc)(void *context,void *ptr);
+	size_t (*sizeFunc)(void *context,void *ptr);
+	void *context;
+};
+struct cs_AllocStats_
+{
+	ulong32_t malcCount;			/* CS_malc and CS_calc calls */
+	ulong32_t ralcCount;			/* CS_ralc calls */
+	ulong32_t freeCount;			/* CS_free calls with a non-NULL pointer */
+	ulong32_t failCount;			/* allocations which returned NULL */
+	size_t totalBytes;				/* total bytes requested */
+	size_t liveBytes;				/* bytes currently allocated (sized only) */
+	size_t peakBytes;				/* maximum value of liveBytes */
+};
+struct cs_Arena_;
+
+/*
+	Conversion metrics, see CS_getMetrics.  The counters are maintained
+	for the process as a whole, as is all other state in this library.
+	Transformation methods are counted in the slot given by
+	cs_METRICS_SLOT; CS_metricsExport reports them by method name.
+	Iterative inverse datum calculations report the value of their
+	iteration counter on exit; values of cs_METRICS_ITRBKT - 1 and more
+	are counted in the last bucket, loops which reached their limit
+	(i.e. failed to converge) are counted in itrLimit instead.
+*/
+#define cs_METRICS_ITRBKT   16
+#define cs_METRICS_MTHSLOT  128
+#define cs_METRICS_SLOT(mth) ((((mth) & 0x8FF0) != 0) ? 0 : ((((mth) & 0x7000) >> 8) | ((mth) & 0x000F)))
+#define cs_METRICS_TEXT     0
+#define cs_METRICS_JSON     1
+struct cs_Metrics_
+{
+	size_t cs2llPnts;				/* CS_cs2ll calls */
+	size_t ll2csPnts;				/* CS_ll2cs calls */
+	size_t dtcvtPnts;				/* CSdtcvt calls */
+	size_t xfrmPnts [cs_METRICS_MTHSLOT];
+									/* CSdtcvt transformations applied, by method */
+	size_t itrHist [cs_METRICS_ITRBKT];
+	size_t itrLimit;				/* iterative inverses which hit the limit */
+	size_t fallbackOk;				/* CSgridi fallbacks which succeeded */
+	size_t fallbackFail;			/* CSgridi fallbacks which failed */
+	size_t blkErrPnts;				/* CSdtcvt points with a soft (block) error */
+	size_t blkErrNew;				/* new blocks recorded in cs_Dtcprm_::errLngLat */
+	size_t gridLookups;				/* grid file cell/record lookups */
+	size_t gridMisses;				/* lookups which required reading the file */
+	size_t gridReads;				/* grid data reads */
+	size_t gridBytes;				/* grid data bytes read */
+	size_t csdefCount;				/* CS_csdef calls */
+	size_t dtdefCount;				/* CS_dtdef calls */
+	size_t eldefCount;				/* CS_eldef calls */
+	size_t gxdefCount;				/* CS_gxdef calls */
+	size_t csCacheHits;
+	size_t csCacheMisses;			/* CSbcclu, the CS_cnvrt coordinate system cache */
+	size_t dtcCacheHits;
+	size_t dtcCacheMisses;			/* CSbdclu, the CS_cnvrt datum conversion cache */
+	size_t dtmCacheHits;
+	size_t dtmCacheMisses;			/* CS_dtloc datum cache */
+};
+
+/*
+	Tracing hooks, see CS_setTraceHooks.  When installed, bgnFunc is
+	called on entry to, and endFunc on exit from, each of the stages
+	listed below; every begin is matched by an end with the same stage
+	and name.  The name is that of the coordinate system for CSLOC, of
+	the source and target datums ("SRC->TRG") for DTCSU and its phases,
+	the path of the file for the grid stages, and that of the function
+	for BATCH.  The status is the stage's return value; zero or -1 for
+	CSLOC and DTCSU, the cs_DTCBRG_XXXX value for the phases, zero or -1
+	for the grid stages, and the function's return value for BATCH.
+	Hooks are called from whichever thread is doing the work; when
+	none are installed, the cost is a call and a pointer test at each
+	end of a stage.
+*/
+#define cs_TRACE_CSLOC      1		/* CS_csloc */
+#define cs_TRACE_DTCSU      2		/* CS_dtcsu */
+#define cs_TRACE_DTCPH1     3		/* CSdtcsuPhaseOne, geodetic path */
+#define cs_TRACE_DTCPH2     4		/* CSdtcsuPhaseTwo, direct transformation */
+#define cs_TRACE_DTCPH3     5		/* CSdtcsuPhaseThree, pivot datums */
+#define cs_TRACE_DTCPH4     6		/* CSdtcsuPhaseFour, unique transformations */
+#define cs_TRACE_GRIDOPEN   7		/* opening a grid data file */
+#define cs_TRACE_GRIDREAD   8		/* reading grid data from the file */
+#define cs_TRACE_BATCH      9		/* CS_cnvrtExtent, CS_cnvrtLine, CS_cnvrtTile, CS_csDistortion */
+struct cs_TraceHooks_
+{
+	void (*bgnFunc)(void *context,int stage,Const char *name);
+	void (*endFunc)(void *context,int stage,Const char *name,int status);
+	void *context;
+};
+
 /*
 	The following casts are used to eliminate warnings from
 	ANSI compilers.  I don't understand why they are necessary,
@@ -6525,6 +6758,7 @@ int CScalcRegnFromMgrs (struct cs_Mgrs_ *_This,double sw [2],double ne [2],Const
 #define cs_LL2CS_CAST int(*)(Const void *,double *,Const double *)
 #define cs_SCALE_CAST double(*)(Const void *,Const double *)
 #define cs_CNVRG_CAST double(*)(Const void *,Const double *)
+#define cs_DSTRT_CAST void(*)(Const void *,Const double *,double *)
 #define cs_SCALK_CAST double(*)(Const void *,Const double *)
 #define cs_SCALH_CAST double(*)(Const void *,Const double *)
 #define cs_LLCHK_CAST int(*)(Const void *,int,Const double [][3])
@@ -6560,8 +6794,10 @@ int			EXP_LVL1	CS_altdr (Const char *alt_dir);
 double		EXP_LVL1	CS_ansiAtof (Const char *string);
 void		EXP_LVL1	CS_ats77Name (Const char *newName);
 long32_t	EXP_LVL1	CS_atof (double *result,Const char *value);
+int			EXP_LVL1	CS_atofArray (double results [],Const char *values [],int count,long32_t flags []);
 char*		EXP_LVL3	CS_audflt (Const char *dflt_au);
 int			EXP_LVL1	CS_azddll (double e_rad,double e_sq,Const double from_ll [2],double az,double dd,double to_ll [2]);
+int			EXP_LVL1	CS_azddllArray (double e_rad,double e_sq,Const double ll_from [][2],Const double az [],Const double dist [],int cnt,double ll_to [][2],int status []);
 double		EXP_LVL1	CS_azsphr (Const double ll0 [2],Const double ll1 [2]);
 
 int			EXP_LVL7	CS_bins (csFILE *strm,long32_t start,long32_t eof,int rs,Const void *rec,int (*comp)(const void *elem1,const void *elem2));
@@ -6571,6 +6807,9 @@ int			EXP_LVL5	CS_bswap (void *rec,Const char *frmt);
 double		EXP_LVL1	CS_cnvrg (Const char *cs_nam,Const double ll [3]);
 int			EXP_LVL1	CS_cnvrt (Const char *src_cs,Const char *dst_cs,double coord [3]);
 int			EXP_LVL1	CS_cnvrt3D (Const char *src_cs,Const char *dst_cs,double coord [3]);
+int			EXP_LVL1	CS_cnvrtExtent (Const char *src_cs,Const char *dst_cs,Const double srcMin [2],Const double srcMax [2],double tolerance,double dstMin [2],double dstMax [2]);
+int			EXP_LVL1	CS_cnvrtTile (Const char *tile_cs,Const char *src_cs,int zoom,long32_t tileX,long32_t tileY,int tileSize,double tolerance,double grid [][2]);
+int			EXP_LVL1	CS_cnvrtLine (Const char *src_cs,Const char *dst_cs,int cnt,Const double srcPnts [][3],int closed,double tolerance,double (**dstPnts)[3],int *dstAlloc,int *dstCnt);
 const char*	EXP_LVL3	CS_countyEnum (int stateFips,int index);
 unsigned short EXP_LVL9 CS_crc16 (unsigned short crc16,unsigned char *cp,int count);
 
@@ -6586,9 +6825,12 @@ int			EXP_LVL3	CS_csdefAll (struct cs_Csdef_ **pDefArray[]);
 int			EXP_LVL3	CS_csDefCmp (Const struct cs_Csdef_ *original,Const struct cs_Csdef_ *revised,char* message,size_t messageSize);
 int			EXP_LVL3	CS_csDefCmpEx (double* qValuePtr,Const struct cs_Csdef_ *original,Const struct cs_Csdef_ *revised,char* message,size_t msgSize);
 int			EXP_LVL3	CS_csdel (struct cs_Csdef_ *csdef);
+int			EXP_LVL3	CS_csDistortion (Const struct cs_Csprm_ *csprm,Const double ll [][3],int cnt,struct cs_Distortion_ rslt []);
 int			EXP_LVL5	CS_csDiff (FILE *rptStrm,struct cs_Csdef_ *was,struct cs_Csdef_ *is);
 int			EXP_LVL1	CS_csEnum (int index,char *key_name,int size);
+int			EXP_LVL3	CS_csEnumAll (struct cs_Csenum_ **enumArray);
 int 		EXP_LVL2	CS_csEnumByGroup (int index,Const char *grp_name,struct cs_Csgrplst_ *cs_descr);
+int			EXP_LVL1	CS_csEnumNext (int *cursor,char *key_name,int size);
 void		EXP_LVL1	CS_csfnm (Const char *new_name);
 int			EXP_LVL1	CS_csGrpEnum (int index,char *grp_name,int name_sz,char *grp_dscr,int dscr_sz);
 void		EXP_LVL3	CS_csgrpf (struct cs_Csgrplst_ *grp_list);
@@ -6600,6 +6842,7 @@ struct cs_Csprm_* EXP_LVL3	CS_csloc (Const char *cs_nam);
 csFILE *	EXP_LVL5	CS_csopn (Const char *mode);
 int			EXP_LVL1	CS_csRangeEnum (int index,char *key_name,int size);
 int			EXP_LVL1	CS_csRangeEnumSetup (double longitude,double latitude);
+int			EXP_LVL1	CS_csRangeEnumSetupEx (Const double ll_min [2],Const double ll_max [2],Const char *group,Const char *datum);
 int			EXP_LVL5	CS_csrd (csFILE *strm,struct cs_Csdef_ *cs_def,int *crypt);
 int			EXP_LVL5	CS_csrup (Const char *distrb,Const char *bkupnm);
 double		EXP_LVL3	CS_cssch (Const struct cs_Csprm_ *csprm,Const double ll [2]);
@@ -6662,13 +6905,29 @@ int			EXP_LVL3	CS_envsub (char* stringBufr,size_t bufrSize);
 int			EXP_LVL3	CS_envsubWc (wchar_t* stringBufr,size_t bufrSize);	/* bufrSize === # of characters */
 void		EXP_LVL3	CS_erpt (int err_num);
 void		EXP_LVL1	CS_errmsg (char *user_bufr,int buf_size);
+ulong32_t	EXP_LVL1	CS_errorCount (int err_num);
+void		EXP_LVL1	CS_errorCountReset (void);
+int			EXP_LVL1	CS_errorMode (int mode);
+int			EXP_LVL1	CS_errorRecent (int index,int *err_num,char *mesg,int size);
 
 void		EXP_LVL1	CS_fast (int fast);
 void		EXP_LVL3	CS_fillIn (struct cs_Csdef_ *cs_def);
 cs_Time_	EXP_LVL7	CS_fileModTime (Const char *filePath);
 void		EXP_LVL5	CS_free (void *ptr);
 void		EXP_LVL3	CS_dllFree (void *ptr);
+void		EXP_LVL3	CS_allocStats (struct cs_AllocStats_ *stats);
+void		EXP_LVL3	CS_allocStatsReset (void);
+void		EXP_LVL3	CS_arenaAllocator (struct cs_Arena_ *arena,struct cs_Allocator_ *allocator);
+void		EXP_LVL3	CS_arenaDelete (struct cs_Arena_ *arena);
+struct cs_Arena_* EXP_LVL3	CS_arenaNew (size_t chunkSize);
+void		EXP_LVL3	CS_arenaReset (struct cs_Arena_ *arena);
+int			EXP_LVL3	CS_setAllocator (Const struct cs_Allocator_ *newAlloc,struct cs_Allocator_ *oldAlloc);
+void		EXP_LVL1	CS_getMetrics (struct cs_Metrics_ *metrics);
+int			EXP_LVL1	CS_metricsExport (char *bufr,int bufrSize,int format);
+void		EXP_LVL1	CS_resetMetrics (void);
+void		EXP_LVL1	CS_setTraceHooks (Const struct cs_TraceHooks_ *newHooks,struct cs_TraceHooks_ *oldHooks);
 long32_t	EXP_LVL1	CS_ftoa (char *bufr,int size,double value,long32_t frmt);
+int			EXP_LVL1	CS_ftoaArray (char *bufr,int size,Const double values [],int count,long32_t frmt,long32_t actual []);
 
 int			EXP_LVL3	CS_gdcDisable (enum cs_GdcCatalogs ident);
 Const char*	EXP_LVL3	CS_gdcEnum (int index,int *ident);
@@ -6781,7 +7040,9 @@ char*		EXP_LVL7	CS_lget (char *str,Const char *fld,int size,char fill);
 int			EXP_LVL3	CS_ll2cs (Const struct cs_Csprm_ *csprm,double xy [3],Const double ll [3]);
 int			EXP_LVL3	CS_ll3cs (Const struct cs_Csprm_ *csprm,double xy [3],Const double ll [3]);
 double		EXP_LVL1	CS_llazdd (double e_rad,double e_sq,Const double ll_from [2],Const double ll_to [2],double *dist);
+int			EXP_LVL1	CS_llazddArray (double e_rad,double e_sq,Const double ll_from [][2],Const double ll_to [][2],int cnt,double az [],double dist []);
 int			EXP_LVL3	CS_llchk (Const struct cs_Csprm_ *csprm,int cnt,Const double pnts [][3]);
+int			EXP_LVL3	CS_llchkArray (Const struct cs_Csprm_ *csprm,int cnt,Const double pnts [][3],unsigned char status []);
 int			EXP_LVL1	CS_llFromMgrs (double latLng [2],const char* mgrsString);
 double		EXP_LVL7	CS_lngEpsilon (double baseLL,double calcLL);
 void		EXP_LVL7	CS_lput (char *fld,Const char *str,int size,char fill);
@@ -6869,6 +7130,7 @@ int			EXP_LVL9	CS_wktDtDefFunc (struct cs_Dtdef_* dtDefPtr,Const char* dtKeyName
 int			EXP_LVL9	CS_wktElDefFunc (struct cs_Eldef_* elDefPtr,Const char* elKeyName);
 
 int			EXP_LVL3	CS_xychk (Const struct cs_Csprm_ *csprm,int cnt,Const double pnts [][3]);
+int			EXP_LVL3	CS_xychkArray (Const struct cs_Csprm_ *csprm,int cnt,Const double pnts [][3],unsigned char status []);
 
 Const struct cs_Zone_* EXP_LVL9	CS_znlocF (Const struct cs_Zone_ zones [8],
 										   int zone_cnt,
@@ -6971,6 +7233,9 @@ int			EXP_LVL9	CScsiniQ (Const struct cs_Csdef_ *csdef,unsigned short prj_code,i
 void		EXP_LVL9	CScsiniS (struct cs_Csprm_ *csprm);
 int			EXP_LVL9	CScsiniX (Const struct cs_Csini_ *csini,int cnt,Const double pnts [][3]);
 char*		EXP_LVL9	CScsKeyNames (void);
+struct csCsRngIdx_* EXP_LVL9	CScsRangeIdx (void);
+void		EXP_LVL9	CScsRangeIdxRls (void);
+void		EXP_LVL9	CSrlsNameIdx (void);
 struct cs_Csprm_* EXP_LVL3	CScsloc (struct cs_Csdef_ *cs_ptr,struct cs_Datum_ *dt_ptr);
 struct cs_Csprm_* EXP_LVL3	CScsloc1 (struct cs_Csdef_ *cs_ptr);
 struct cs_Csprm_* EXP_LVL3	CScsloc2 (struct cs_Csdef_ *cs_ptr,
@@ -6992,6 +7257,7 @@ struct cs_Dtcprm_* EXP_LVL3	CSdtcsu2 (Const struct cs_GeodeticTransform_ *xfrmDe
 char*		EXP_LVL9	CSdtKeyNames (void);
 struct cs_Datum_* EXP_LVL5	CSdtloc1 (Const struct cs_Dtdef_ *dtdef_p);
 struct cs_Datum_* EXP_LVL5	CSdtloc2 (Const struct cs_Dtdef_ *dtdef_p,Const struct cs_Eldef_ *eldef_p);
+void		EXP_LVL9	CSdtlocRls (void);
 
 double		EXP_LVL9	CSedcncC (Const struct cs_Edcnc_ *edcnc,Const double ll [2]);
 int			EXP_LVL9	CSedcncF (Const struct cs_Edcnc_ *edcnc,double xy [2],Const double ll [2]);
@@ -7038,6 +7304,7 @@ int			EXP_LVL9	CSelcomp (Const char *inpt,Const char *outp,
 												   int (*err_func)(char *mesg));
 char*		EXP_LVL9	CSelKeyNames (void);
 unsigned short	EXP_LVL7	CSerpt (char *mesg,int size,int err_num);
+void		EXP_LVL7	CSerptRecord (int err_num);
 int			EXP_LVL5	CSextractDbl (csFILE *aStrm,double* result);
 
 const char*	EXP_LVL3	CSfips2a (int state,int county);
@@ -7076,6 +7343,8 @@ int			EXP_LVL9	CShmlsnQ (Const struct cs_Csdef_ *csdef,unsigned short prj_code,i
 void		EXP_LVL9	CShmlsnS (struct cs_Csprm_ *csprm);
 int			EXP_LVL9	CShmlsnX (Const struct cs_Hmlsn_ *hmlsn,int cnt,Const double pnts [][3]);
 
+ulong32_t	EXP_LVL9	CSkeyHash (Const char *keyName);
+
 double		EXP_LVL9	CSkrovkC (Const struct cs_Krovk_ *krovk,Const double ll [2]);
 double		EXP_LVL9	CSkrovkCsMapParam (double e_rad,double e_sq,double orgLng,double stdLat,double epsgParm);
 double		EXP_LVL9	CSkrovkEpsgParam (double e_rad,double e_sq,double orgLng,double stdLat,double csMapParm);
@@ -7110,6 +7379,8 @@ int			EXP_LVL9	CSlmtanQ (Const struct cs_Csdef_ *csdef,unsigned short prj_code,i
 void		EXP_LVL9	CSlmtanS (struct cs_Csprm_ *csprm);
 int			EXP_LVL9	CSlmtanX (Const struct cs_Lmtan_ *lmtan,int cnt,Const double pnts [][3]);
 
+void		EXP_LVL9	CSmetricsItr (int itrCount,int itrLimit);
+
 double		EXP_LVL9	CSmillrC (Const struct cs_Millr_ *millr,Const double ll [2]);
 int			EXP_LVL9	CSmillrF (Const struct cs_Millr_ *millr,double xy [2],Const double ll [2]);
 double		EXP_LVL9	CSmillrH (Const struct cs_Millr_ *millr,Const double ll [2]);
@@ -7246,6 +7517,7 @@ int			EXP_LVL9	CSplycnQ (Const struct cs_Csdef_ *csdef,unsigned short prj_code,i
 void		EXP_LVL9	CSplycnS (struct cs_Csprm_ *csprm);
 int			EXP_LVL9	CSplycnX (Const struct cs_Plycn_ *plycn,int cnt,Const double pnts [][3]);
 
+struct cs_Prjtab_* EXP_LVL9	CSprjtabLu (Const char *prjKeyName);
 int			EXP_LVL3	CSprjPrmCmp (double* qValue,short prmNbr,Const struct cs_Csdef_* original,
 																 Const struct cs_Csdef_* revised,
 																 char* message,
@@ -7261,6 +7533,7 @@ void		EXP_LVL9	CSpstroS (struct cs_Csprm_ *csprm);
 int			EXP_LVL9	CSpstroX (Const struct cs_Pstro_ *pstro,int cnt,Const double pnts [][3]);
 
 double		EXP_LVL9	CSrobinC (Const struct cs_Robin_ *robin,Const double ll [2]);
+void		EXP_LVL9	CSrobinD (Const struct cs_Robin_ *robin,Const double ll [2],double khc [3]);
 int			EXP_LVL9	CSrobinF (Const struct cs_Robin_ *robin,double xy [2],Const double ll [2]);
 int			EXP_LVL9	CSrobinI (Const struct cs_Robin_ *robin,double ll [2],Const double xy [2]);
 double		EXP_LVL9	CSrobinH (Const struct cs_Robin_ *robin,Const double ll [2]);
@@ -7319,7 +7592,12 @@ int			EXP_LVL9	CStacylQ (Const struct cs_Csdef_ *csdef,unsigned short prj_code,i
 void		EXP_LVL9	CStacylS (struct cs_Csprm_ *csprm);
 int			EXP_LVL9	CStacylX (Const struct cs_Tacyl_ *tacyl,int cnt,Const double pnts [][3]);
 
+int			EXP_LVL9	CStraceActive (void);
+void		EXP_LVL9	CStraceBgn (int stage,Const char *name);
+void		EXP_LVL9	CStraceEnd (int stage,Const char *name,int status);
+
 double		EXP_LVL9	CStrmerC (Const struct cs_Trmer_ *trmer,Const double ll [2]);
+void		EXP_LVL9	CStrmerD (Const struct cs_Trmer_ *trmer,Const double ll [2],double khc [3]);
 int			EXP_LVL9	CStrmerF (Const struct cs_Trmer_ *trmer,double xy [2],Const double ll [2]);
 int			EXP_LVL9	CStrmerI (Const struct cs_Trmer_ *trmer,double ll [2],Const double xy [2]);
 double		EXP_LVL9	CStrmerK (Const struct cs_Trmer_ *trmer,Const double ll [2]);
@@ -8024,6 +8302,8 @@ double CSdebugEgm96 (struct cs_Egm96_ *__This);
 
 void EXP_LVL5 CS_llhToXyz (double xyz [3],Const double llh [3],double e_rad,double e_sq);
 int EXP_LVL5 CS_xyzToLlh (double llh [3],Const double xyz [3],double e_rad,double e_sq);
+void EXP_LVL5 CS_llhNormal (double nrm [3],Const double llh [3]);
+int EXP_LVL5 CS_xyzLineToLlh (double llh [3],Const double xyz [3],Const double dir [3],double e_rad,double e_sq);
 
 #if _FILE_SYSTEM == _fs_UNIX
 csFILE *CS_fopen (const char *filename,const char *mode);
@@ -1441,11 +1441,13 @@ double			EXP_LVL1	CS_cnvrg (Const char *cs_nam,double ll [2]);
 int				EXP_LVL1	CS_cnvrt (Const char *src_cs,Const char *dst_cs,double coord [3]);
 int				EXP_LVL1	CS_cnvrt3D (Const char *src_cs,Const char *dst_cs,double coord [3]);
 int				EXP_LVL1	CS_csEnum (int index,char *key_name,int size);
+int				EXP_LVL1	CS_csEnumNext (int *cursor,char *key_name,int size);
 void			EXP_LVL1	CS_csfnm (Const char *new_name);
 int				EXP_LVL1	CS_csGrpEnum (int index,char *grp_name,int name_sz,char *grp_dscr,int dscr_sz);
 int				EXP_LVL1	CS_csIsValid (Const char *key_name);
 int				EXP_LVL1	CS_csRangeEnum (int index,char *key_name,int size);
 int				EXP_LVL1	CS_csRangeEnumSetup (double longitude,double latitude);
+int				EXP_LVL1	CS_csRangeEnumSetupEx (Const double ll_min [2],Const double ll_max [2],Const char *group,Const char *datum);
 int				EXP_LVL1	CS_dtEnum (int index,char *key_name,int size);
 void			EXP_LVL1	CS_dtfnm (Const char *new_name);
 int				EXP_LVL1	CS_dtIsValid (Const char *key_name);
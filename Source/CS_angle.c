@@ -26,6 +26,7 @@
 */
 
 #include "cs_map.h"
+#include <float.h>
 
 /**********************************************************************
 **	angl_out = CS_adj2pi (angl_in);
@@ -950,6 +951,1121 @@ static double CSllazdd (	double e_rad,
 	return (faz * cs_Radian);
 }
 
+/**********************************************************************
+	Series solution of the geodesic problems, used by the array
+	functions CS_llazddArray and CS_azddllArray below.  This follows
+	C. F. F. Karney, "Algorithms for geodesics", Journal of Geodesy
+	87 (2013), pp. 43-55, with the series carried to sixth order in
+	the third flattening, n.
+
+	The direct problem is solved without iteration.  The inverse
+	problem is solved by Newton's method on the series, started from
+	the solution of the astroid problem near anti-podal points, and
+	safeguarded by bisection; it converges for all pairs of points,
+	including nearly anti-podal ones, where the Vincenty solution used
+	by CS_llazdd and CS_azddll does not.
+
+	For terrestrial ellipsoids (flattening not more than 1/150) the
+	truncation error of the series is less than 15 nanometers in
+	distance, and correspondingly small in azimuth; the results are
+	accurate to round off.  For flattening up to 1/50 the error remains
+	well below a millimeter.  Oblate, prolate (e_sq < 0) and spherical
+	figures are all supported.
+
+	The values which depend only upon the ellipsoid are computed once
+	by CSkrnySu, and are kept in a csKarney_ structure.
+
+	The functions in this section are adapted from the C implementation
+	of GeographicLib (geodesic.c), which carries the following notice:
+
+		The MIT License (MIT).
+
+		Copyright (c) 2012-2025, Charles Karney
+
+		Permission is hereby granted, free of charge, to any person
+		obtaining a copy of this software and associated documentation
+		files (the "Software"), to deal in the Software without
+		restriction, including without limitation the rights to use,
+		copy, modify, merge, publish, distribute, sublicense, and/or
+		sell copies of the Software, and to permit persons to whom the
+		Software is furnished to do so, subject to the following
+		conditions:
+
+		The above copyright notice and this permission notice shall be
+		included in all copies or substantial portions of the Software.
+
+		THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+		EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+		OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+		NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+		HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+		WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+		FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+		OTHER DEALINGS IN THE SOFTWARE.
+**********************************************************************/
+
+#define csKRNY_ORD  6							/* order of the series */
+#define csKRNY_NC3X ((csKRNY_ORD * (csKRNY_ORD - 1)) / 2)
+#define csKRNY_MAXIT1 20						/* Newton iterations */
+#define csKRNY_MAXIT2 (csKRNY_MAXIT1 + DBL_MANT_DIG + 10)	/* plus bisection */
+
+struct csKarney_
+{
+	double e_rad;				/* equatorial radius */
+	double flat;				/* flattening */
+	double f1;					/* one minus the flattening */
+	double ep2;					/* second eccentricity squared */
+	double nn;					/* third flattening */
+	double b_rad;				/* polar radius */
+	double etol2;				/* short line threshold */
+	double tiny;				/* sqrt (DBL_MIN) */
+	double tol0;				/* DBL_EPSILON */
+	double tol1;
+	double tol2;
+	double xthresh;
+	double A3x [csKRNY_ORD];	/* coefficients of A3, in eps */
+	double C3x [csKRNY_NC3X];	/* coefficients of C3, in eps */
+};
+
+/* Evaluates a polynomial of degree nn, coefficients highest order first. */
+static double CSkrnyPoly (int nn,Const double *pp,double xx)
+{
+	double yy;
+
+	yy = (nn < 0) ? 0.0 : *pp++;
+	while (--nn >= 0) yy = yy * xx + *pp++;
+	return yy;
+}
+
+/* Normalizes the sine and cosine pair of an angle. */
+static void CSkrnyNorm (double *sinx,double *cosx)
+{
+	double rr;
+
+	rr = sqrt (*sinx * *sinx + *cosx * *cosx);
+	*sinx /= rr;
+	*cosx /= rr;
+}
+
+/* Error free transformation of a sum; returns the sum, the round off
+   in *tt. */
+static double CSkrnySum (double uu,double vv,double *tt)
+{
+	volatile double ss;
+	volatile double up;
+	volatile double vpp;
+
+	ss = uu + vv;
+	up = ss - vv;
+	vpp = ss - up;
+	up -= uu;
+	vpp -= vv;
+	*tt = -(up + vpp);
+	return ss;
+}
+
+/* Rounds an angle so that tiny values underflow to zero; this avoids
+   having to deal with nearly singular cases. */
+static double CSkrnyAngRound (double xx)
+{
+	volatile double yy;
+	double zz;
+
+	zz = 1.0 / 16.0;
+	yy = fabs (xx);
+	if (yy < zz) yy = zz - (zz - yy);
+	return (xx < 0.0) ? -yy : yy;
+}
+
+/* Reduces an angle, in degrees, to the range (-180, 180]. */
+static double CSkrnyAngNrml (double xx)
+{
+	xx = fmod (xx,360.0);
+	return (xx <= -180.0) ? xx + 360.0 : ((xx <= 180.0) ? xx : xx - 360.0);
+}
+
+/* Returns yy - xx, reduced to (-180, 180], with the round off in *ee. */
+static double CSkrnyAngDiff (double xx,double yy,double *ee)
+{
+	double tt;
+	double dd;
+
+	dd = CSkrnyAngNrml (CSkrnySum (CSkrnyAngNrml (-xx),CSkrnyAngNrml (yy),&tt));
+	return CSkrnySum ((dd == 180.0 && tt > 0.0) ? -180.0 : dd,tt,ee);
+}
+
+/* Sine and cosine of an angle in degrees, exact for multiples of 90. */
+static void CSkrnySinCos (double xx,double *sinx,double *cosx)
+{
+	extern double cs_Degree;		/* 1.0 / 57.29577... */
+
+	int qq;
+	double rr;
+	double ss;
+	double cc;
+
+	rr = fmod (xx,360.0);
+	qq = (int)floor (rr / 90.0 + 0.5);
+	rr -= 90.0 * qq;
+	rr *= cs_Degree;
+	ss = sin (rr);
+	cc = cos (rr);
+	switch ((unsigned)qq & 3U) {
+	case 0U:  *sinx =  ss; *cosx =  cc; break;
+	case 1U:  *sinx =  cc; *cosx = -ss; break;
+	case 2U:  *sinx = -ss; *cosx = -cc; break;
+	default:  *sinx = -cc; *cosx =  ss; break;
+	}
+	if (xx != 0.0)
+	{
+		*sinx += 0.0;
+		*cosx += 0.0;
+	}
+}
+
+/* atan2 with the result in degrees, exact for multiples of 90. */
+static double CSkrnyAtan2 (double yy,double xx)
+{
+	extern double cs_Radian;		/* 57.29577... */
+
+	int qq;
+	double tmp;
+	double ang;
+
+	qq = 0;
+	if (fabs (yy) > fabs (xx))
+	{
+		tmp = xx; xx = yy; yy = tmp;
+		qq = 2;
+	}
+	if (xx < 0.0)
+	{
+		xx = -xx;
+		qq += 1;
+	}
+	ang = atan2 (yy,xx) * cs_Radian;
+	switch (qq) {
+	case 1:  ang = ((yy >= 0.0) ? 180.0 : -180.0) - ang; break;
+	case 2:  ang =  90.0 - ang; break;
+	case 3:  ang = -90.0 + ang; break;
+	default: break;
+	}
+	return ang;
+}
+
+/* Evaluates sum (c [l] * sin (2 * l * x), l = 1 .. nn) when sinp is
+   TRUE, sum (c [l] * cos ((2 * l + 1) * x), l = 0 .. nn - 1) otherwise,
+   by Clenshaw summation. */
+static double CSkrnySinCosSeries (int sinp,double sinx,double cosx,Const double cc [],int nn)
+{
+	double ar;
+	double y0;
+	double y1;
+
+	cc += (nn + sinp);
+	ar = 2.0 * (cosx - sinx) * (cosx + sinx);
+	y0 = (nn & 1) ? *--cc : 0.0;
+	y1 = 0.0;
+	nn /= 2;
+	while (nn-- > 0)
+	{
+		y1 = ar * y0 - y1 + *--cc;
+		y0 = ar * y1 - y0 + *--cc;
+	}
+	return (sinp) ? 2.0 * sinx * cosx * y0 : cosx * (y0 - y1);
+}
+
+/* Solves k^4 + 2 k^3 - (x^2 + y^2 - 1) k^2 - 2 y^2 k - y^2 = 0 for its
+   positive root. */
+static double CSkrnyAstroid (double xx,double yy)
+{
+	double kk;
+	double pp, qq, rr;
+	double S, r2, r3, disc;
+	double uu, vv, uv, ww;
+	double T3, T, ang;
+
+	pp = xx * xx;
+	qq = yy * yy;
+	rr = (pp + qq - 1.0) / 6.0;
+	if (!(qq == 0.0 && rr <= 0.0))
+	{
+		S = pp * qq / 4.0;
+		r2 = rr * rr;
+		r3 = rr * r2;
+		disc = S * (S + 2.0 * r3);
+		uu = rr;
+		if (disc >= 0.0)
+		{
+			T3 = S + r3;
+			T3 += (T3 < 0.0) ? -sqrt (disc) : sqrt (disc);
+			T = (T3 < 0.0) ? -pow (-T3,1.0 / 3.0) : pow (T3,1.0 / 3.0);
+			uu += T + ((T != 0.0) ? r2 / T : 0.0);
+		}
+		else
+		{
+			ang = atan2 (sqrt (-disc),-(S + r3));
+			uu += 2.0 * rr * cos (ang / 3.0);
+		}
+		vv = sqrt (uu * uu + qq);
+		uv = (uu < 0.0) ? qq / (vv - uu) : uu + vv;
+		ww = (uv - qq) / (2.0 * vv);
+		kk = uv / (sqrt (uv + ww * ww) + ww);
+	}
+	else
+	{
+		kk = 0.0;
+	}
+	return kk;
+}
+
+/* A1 - 1, and the C1 and C1' coefficients. */
+static double CSkrnyA1m1 (double eps)
+{
+	static Const double coeff [] = { 1.0, 4.0, 64.0, 0.0, 256.0 };
+	double tt;
+
+	tt = CSkrnyPoly (csKRNY_ORD / 2,coeff,eps * eps) / coeff [csKRNY_ORD / 2 + 1];
+	return (tt + eps) / (1.0 - eps);
+}
+static void CSkrnyCoefs (Const double coeff [],double eps,double cc [])
+{
+	int ll, mm, oo;
+	double eps2;
+	double dd;
+
+	eps2 = eps * eps;
+	dd = eps;
+	oo = 0;
+	for (ll = 1;ll <= csKRNY_ORD;ll += 1)
+	{
+		mm = (csKRNY_ORD - ll) / 2;
+		cc [ll] = dd * CSkrnyPoly (mm,coeff + oo,eps2) / coeff [oo + mm + 1];
+		oo += mm + 2;
+		dd *= eps;
+	}
+}
+static void CSkrnyC1 (double eps,double cc [])
+{
+	static Const double coeff [] =
+	{
+		-1.0, 6.0, -16.0, 32.0,
+		-9.0, 64.0, -128.0, 2048.0,
+		9.0, -16.0, 768.0,
+		3.0, -5.0, 512.0,
+		-7.0, 1280.0,
+		-7.0, 2048.0
+	};
+	CSkrnyCoefs (coeff,eps,cc);
+}
+static void CSkrnyC1p (double eps,double cc [])
+{
+	static Const double coeff [] =
+	{
+		205.0, -432.0, 768.0, 1536.0,
+		4005.0, -4736.0, 3840.0, 12288.0,
+		-225.0, 116.0, 384.0,
+		-7173.0, 2695.0, 7680.0,
+		3467.0, 7680.0,
+		38081.0, 61440.0
+	};
+	CSkrnyCoefs (coeff,eps,cc);
+}
+
+/* A2 - 1, and the C2 coefficients. */
+static double CSkrnyA2m1 (double eps)
+{
+	static Const double coeff [] = { -11.0, -28.0, -192.0, 0.0, 256.0 };
+	double tt;
+
+	tt = CSkrnyPoly (csKRNY_ORD / 2,coeff,eps * eps) / coeff [csKRNY_ORD / 2 + 1];
+	return (tt - eps) / (1.0 + eps);
+}
+static void CSkrnyC2 (double eps,double cc [])
+{
+	static Const double coeff [] =
+	{
+		1.0, 2.0, 16.0, 32.0,
+		35.0, 64.0, 384.0, 2048.0,
+		15.0, 80.0, 768.0,
+		7.0, 35.0, 512.0,
+		63.0, 1280.0,
+		77.0, 2048.0
+	};
+	CSkrnyCoefs (coeff,eps,cc);
+}
+
+/* A3 and the C3 coefficients, from the polynomials in eps which
+   CSkrnySu has computed. */
+static double CSkrnyA3 (Const struct csKarney_ *krny,double eps)
+{
+	return CSkrnyPoly (csKRNY_ORD - 1,krny->A3x,eps);
+}
+static void CSkrnyC3 (Const struct csKarney_ *krny,double eps,double cc [])
+{
+	int ll, mm, oo;
+	double mult;
+
+	mult = 1.0;
+	oo = 0;
+	for (ll = 1;ll < csKRNY_ORD;ll += 1)
+	{
+		mm = csKRNY_ORD - ll - 1;
+		mult *= eps;
+		cc [ll] = mult * CSkrnyPoly (mm,krny->C3x + oo,eps);
+		oo += mm + 1;
+	}
+}
+
+static void CSkrnySu (struct csKarney_ *krny,double e_rad,double e_sq)
+{
+	static Const double A3coeff [] =
+	{
+		-3.0, 128.0,
+		-2.0, -3.0, 64.0,
+		-1.0, -3.0, -1.0, 16.0,
+		3.0, -1.0, -2.0, 8.0,
+		1.0, -1.0, 2.0,
+		1.0, 1.0
+	};
+	static Const double C3coeff [] =
+	{
+		3.0, 128.0,
+		2.0, 5.0, 128.0,
+		-1.0, 3.0, 3.0, 64.0,
+		-1.0, 0.0, 1.0, 8.0,
+		-1.0, 1.0, 4.0,
+		5.0, 256.0,
+		1.0, 3.0, 128.0,
+		-3.0, -2.0, 3.0, 64.0,
+		1.0, -3.0, 2.0, 32.0,
+		7.0, 512.0,
+		-10.0, 9.0, 384.0,
+		5.0, -9.0, 5.0, 192.0,
+		7.0, 512.0,
+		-14.0, 7.0, 512.0,
+		21.0, 2560.0
+	};
+
+	int jj, kk, ll, mm, oo;
+	double tmp1;
+	double tmp2;
+
+	krny->e_rad = e_rad;
+	krny->flat = 1.0 - sqrt (1.0 - e_sq);
+	krny->f1 = 1.0 - krny->flat;
+	krny->ep2 = e_sq / (krny->f1 * krny->f1);
+	krny->nn = krny->flat / (2.0 - krny->flat);
+	krny->b_rad = e_rad * krny->f1;
+
+	krny->tiny = sqrt (DBL_MIN);
+	krny->tol0 = DBL_EPSILON;
+	krny->tol1 = 200.0 * krny->tol0;
+	krny->tol2 = sqrt (krny->tol0);
+	krny->xthresh = 1000.0 * krny->tol2;
+	tmp1 = fabs (krny->flat);
+	if (tmp1 < 0.001) tmp1 = 0.001;
+	tmp2 = 1.0 - krny->flat / 2.0;
+	if (tmp2 > 1.0) tmp2 = 1.0;
+	krny->etol2 = 0.1 * krny->tol2 / sqrt (tmp1 * tmp2 / 2.0);
+
+	oo = kk = 0;
+	for (jj = csKRNY_ORD - 1;jj >= 0;jj -= 1)
+	{
+		mm = (csKRNY_ORD - jj - 1 < jj) ? csKRNY_ORD - jj - 1 : jj;
+		krny->A3x [kk++] = CSkrnyPoly (mm,A3coeff + oo,krny->nn) / A3coeff [oo + mm + 1];
+		oo += mm + 2;
+	}
+	oo = kk = 0;
+	for (ll = 1;ll < csKRNY_ORD;ll += 1)
+	{
+		for (jj = csKRNY_ORD - 1;jj >= ll;jj -= 1)
+		{
+			mm = (csKRNY_ORD - jj - 1 < jj) ? csKRNY_ORD - jj - 1 : jj;
+			krny->C3x [kk++] = CSkrnyPoly (mm,C3coeff + oo,krny->nn) / C3coeff [oo + mm + 1];
+			oo += mm + 2;
+		}
+	}
+}
+
+/* Distance, s12b, and reduced length, m12b, both divided by the polar
+   radius, and the coefficient of the secular term of the reduced
+   length, m0.  Any of the results may be NULL if not required. */
+static void CSkrnyLengths (double eps,double sig12,
+						   double ssig1,double csig1,double dn1,
+						   double ssig2,double csig2,double dn2,
+						   double *s12b,double *m12b,double *m0)
+{
+	int ll;
+	int redlp;
+	double A1, A2, B1, B2;
+	double J12, m0x;
+	double Ca [csKRNY_ORD + 1];
+	double Cb [csKRNY_ORD + 1];
+
+	m0x = J12 = A1 = A2 = 0.0;
+	redlp = (m12b != NULL || m0 != NULL);
+	if (s12b != NULL || redlp)
+	{
+		A1 = CSkrnyA1m1 (eps);
+		CSkrnyC1 (eps,Ca);
+		if (redlp)
+		{
+			A2 = CSkrnyA2m1 (eps);
+			CSkrnyC2 (eps,Cb);
+			m0x = A1 - A2;
+			A2 = 1.0 + A2;
+		}
+		A1 = 1.0 + A1;
+	}
+	if (s12b != NULL)
+	{
+		B1 = CSkrnySinCosSeries (TRUE,ssig2,csig2,Ca,csKRNY_ORD) -
+			 CSkrnySinCosSeries (TRUE,ssig1,csig1,Ca,csKRNY_ORD);
+		*s12b = A1 * (sig12 + B1);
+		if (redlp)
+		{
+			B2 = CSkrnySinCosSeries (TRUE,ssig2,csig2,Cb,csKRNY_ORD) -
+				 CSkrnySinCosSeries (TRUE,ssig1,csig1,Cb,csKRNY_ORD);
+			J12 = m0x * sig12 + (A1 * B1 - A2 * B2);
+		}
+	}
+	else if (redlp)
+	{
+		for (ll = 1;ll <= csKRNY_ORD;ll += 1)
+		{
+			Cb [ll] = A1 * Ca [ll] - A2 * Cb [ll];
+		}
+		J12 = m0x * sig12 + (CSkrnySinCosSeries (TRUE,ssig2,csig2,Cb,csKRNY_ORD) -
+							 CSkrnySinCosSeries (TRUE,ssig1,csig1,Cb,csKRNY_ORD));
+	}
+	if (m0 != NULL) *m0 = m0x;
+	if (m12b != NULL)
+	{
+		*m12b = dn2 * (csig1 * ssig2) - dn1 * (ssig1 * csig2) - csig1 * csig2 * J12;
+	}
+}
+
+/* Starting value of the azimuth at the first point for Newton's method.
+   Returns sig12 (and the azimuths at both points) if the problem can
+   be solved directly as a short line, a negative value otherwise. */
+static double CSkrnyInvStart (Const struct csKarney_ *krny,
+							  double sbet1,double cbet1,double dn1,
+							  double sbet2,double cbet2,double dn2,
+							  double lam12,double slam12,double clam12,
+							  double *psalp1,double *pcalp1,
+							  double *psalp2,double *pcalp2,double *pdnm)
+{
+	extern double cs_Pi;			/* 3.14159.... */
+
+	int shortline;
+	double sig12;
+	double salp1, calp1;
+	double salp2, calp2;
+	double sbet12, cbet12, sbet12a, cbet12a;
+	double sbetm2, dnm;
+	double omg12, somg12, comg12;
+	double ssig12, csig12;
+	double lam12x, bet12a;
+	double k2, eps;
+	double lamscale, betscale;
+	double xx, yy, kk;
+	double m12b, m0;
+	double omg12a;
+
+	sig12 = -1.0;
+	salp2 = calp2 = dnm = 0.0;
+
+	sbet12 = sbet2 * cbet1 - cbet2 * sbet1;
+	cbet12 = cbet2 * cbet1 + sbet2 * sbet1;
+	sbet12a = sbet2 * cbet1 + cbet2 * sbet1;
+	shortline = (cbet12 >= 0.0 && sbet12 < 0.5 && cbet2 * lam12 < 0.5);
+	if (shortline)
+	{
+		sbetm2 = (sbet1 + sbet2) * (sbet1 + sbet2);
+		sbetm2 /= sbetm2 + (cbet1 + cbet2) * (cbet1 + cbet2);
+		dnm = sqrt (1.0 + krny->ep2 * sbetm2);
+		omg12 = lam12 / (krny->f1 * dnm);
+		somg12 = sin (omg12);
+		comg12 = cos (omg12);
+	}
+	else
+	{
+		somg12 = slam12;
+		comg12 = clam12;
+	}
+
+	salp1 = cbet2 * somg12;
+	if (comg12 >= 0.0)
+	{
+		calp1 = sbet12 + cbet2 * sbet1 * somg12 * somg12 / (1.0 + comg12);
+	}
+	else
+	{
+		calp1 = sbet12a - cbet2 * sbet1 * somg12 * somg12 / (1.0 - comg12);
+	}
+	ssig12 = sqrt (salp1 * salp1 + calp1 * calp1);
+	csig12 = sbet1 * sbet2 + cbet1 * cbet2 * comg12;
+
+	if (shortline && ssig12 < krny->etol2)
+	{
+		/* Really short lines. */
+		salp2 = cbet1 * somg12;
+		calp2 = sbet12 - cbet1 * sbet2 * ((comg12 >= 0.0) ? somg12 * somg12 / (1.0 + comg12) : 1.0 - comg12);
+		CSkrnyNorm (&salp2,&calp2);
+		sig12 = atan2 (ssig12,csig12);
+	}
+	else if (fabs (krny->nn) > 0.1 || csig12 >= 0.0 ||
+			 ssig12 >= 6.0 * fabs (krny->nn) * cs_Pi * cbet1 * cbet1)
+	{
+		/* Nothing to do, the zeroth order spherical approximation is
+		   good enough. */
+	}
+	else
+	{
+		/* Nearly anti-podal; scale to the astroid problem. */
+		lam12x = atan2 (-slam12,-clam12);
+		if (krny->flat >= 0.0)
+		{
+			k2 = sbet1 * sbet1 * krny->ep2;
+			eps = k2 / (2.0 * (1.0 + sqrt (1.0 + k2)) + k2);
+			lamscale = krny->flat * cbet1 * CSkrnyA3 (krny,eps) * cs_Pi;
+			betscale = lamscale * cbet1;
+			xx = lam12x / lamscale;
+			yy = sbet12a / betscale;
+		}
+		else
+		{
+			cbet12a = cbet2 * cbet1 - sbet2 * sbet1;
+			bet12a = atan2 (sbet12a,cbet12a);
+			CSkrnyLengths (krny->nn,cs_Pi + bet12a,sbet1,-cbet1,dn1,sbet2,cbet2,dn2,NULL,&m12b,&m0);
+			xx = -1.0 + m12b / (cbet1 * cbet2 * m0 * cs_Pi);
+			betscale = (xx < -0.01) ? sbet12a / xx : -krny->flat * cbet1 * cbet1 * cs_Pi;
+			lamscale = betscale / cbet1;
+			yy = lam12x / lamscale;
+		}
+
+		if (yy > -krny->tol1 && xx > -1.0 - krny->xthresh)
+		{
+			if (krny->flat >= 0.0)
+			{
+				salp1 = (-xx < 1.0) ? -xx : 1.0;
+				calp1 = -sqrt (1.0 - salp1 * salp1);
+			}
+			else
+			{
+				calp1 = (xx > -krny->tol1) ? 0.0 : -1.0;
+				if (xx > calp1) calp1 = xx;
+				salp1 = sqrt (1.0 - calp1 * calp1);
+			}
+		}
+		else
+		{
+			kk = CSkrnyAstroid (xx,yy);
+			omg12a = lamscale * ((krny->flat >= 0.0) ? -xx * kk / (1.0 + kk) : -yy * (1.0 + kk) / kk);
+			somg12 = sin (omg12a);
+			comg12 = -cos (omg12a);
+			salp1 = cbet2 * somg12;
+			calp1 = sbet12a - cbet2 * sbet1 * somg12 * somg12 / (1.0 - comg12);
+		}
+	}
+
+	if (!(salp1 <= 0.0))
+	{
+		CSkrnyNorm (&salp1,&calp1);
+	}
+	else
+	{
+		salp1 = 1.0;
+		calp1 = 0.0;
+	}
+	*psalp1 = salp1;
+	*pcalp1 = calp1;
+	*psalp2 = salp2;
+	*pcalp2 = calp2;
+	*pdnm = dnm;
+	return sig12;
+}
+
+/* The longitude difference, lam12, of the geodesic leaving the first
+   point at the given azimuth and reaching the latitude of the second;
+   also its derivative with respect to that azimuth when dlam12 is not
+   NULL. */
+static double CSkrnyLambda12 (Const struct csKarney_ *krny,
+							  double sbet1,double cbet1,double dn1,
+							  double sbet2,double cbet2,double dn2,
+							  double salp1,double calp1,
+							  double slam120,double clam120,
+							  double *psalp2,double *pcalp2,double *psig12,
+							  double *pssig1,double *pcsig1,
+							  double *pssig2,double *pcsig2,
+							  double *peps,double *dlam12)
+{
+	double salp2, calp2;
+	double sig12;
+	double ssig1, csig1, ssig2, csig2;
+	double salp0, calp0;
+	double somg1, comg1, somg2, comg2;
+	double somg12, comg12;
+	double eta, k2, eps;
+	double B312, domg12, lam12;
+	double m12b;
+	double C3a [csKRNY_ORD];
+
+	if (sbet1 == 0.0 && calp1 == 0.0)
+	{
+		/* Break the degeneracy of the equatorial line. */
+		calp1 = -krny->tiny;
+	}
+
+	salp0 = salp1 * cbet1;
+	calp0 = sqrt (calp1 * calp1 + (salp1 * sbet1) * (salp1 * sbet1));
+
+	ssig1 = sbet1;
+	somg1 = salp0 * sbet1;
+	csig1 = comg1 = calp1 * cbet1;
+	CSkrnyNorm (&ssig1,&csig1);
+
+	salp2 = (cbet2 != cbet1) ? salp0 / cbet2 : salp1;
+	if (cbet2 != cbet1 || fabs (sbet2) != -sbet1)
+	{
+		calp2 = sqrt (calp1 * cbet1 * calp1 * cbet1 +
+					  ((cbet1 < -sbet1) ? (cbet2 - cbet1) * (cbet1 + cbet2)
+										: (sbet1 - sbet2) * (sbet1 + sbet2))) / cbet2;
+	}
+	else
+	{
+		calp2 = fabs (calp1);
+	}
+
+	ssig2 = sbet2;
+	somg2 = salp0 * sbet2;
+	csig2 = comg2 = calp2 * cbet2;
+	CSkrnyNorm (&ssig2,&csig2);
+
+	sig12 = csig1 * ssig2 - ssig1 * csig2;
+	sig12 = atan2 ((sig12 > 0.0) ? sig12 : 0.0,csig1 * csig2 + ssig1 * ssig2);
+	somg12 = comg1 * somg2 - somg1 * comg2;
+	if (somg12 < 0.0) somg12 = 0.0;
+	comg12 = comg1 * comg2 + somg1 * somg2;
+	eta = atan2 (somg12 * clam120 - comg12 * slam120,
+				 comg12 * clam120 + somg12 * slam120);
+
+	k2 = calp0 * calp0 * krny->ep2;
+	eps = k2 / (2.0 * (1.0 + sqrt (1.0 + k2)) + k2);
+	CSkrnyC3 (krny,eps,C3a);
+	B312 = CSkrnySinCosSeries (TRUE,ssig2,csig2,C3a,csKRNY_ORD - 1) -
+		   CSkrnySinCosSeries (TRUE,ssig1,csig1,C3a,csKRNY_ORD - 1);
+	domg12 = -krny->flat * CSkrnyA3 (krny,eps) * salp0 * (sig12 + B312);
+	lam12 = eta + domg12;
+
+	if (dlam12 != NULL)
+	{
+		if (calp2 == 0.0)
+		{
+			*dlam12 = -2.0 * krny->f1 * dn1 / sbet1;
+		}
+		else
+		{
+			CSkrnyLengths (eps,sig12,ssig1,csig1,dn1,ssig2,csig2,dn2,NULL,&m12b,NULL);
+			*dlam12 = m12b * krny->f1 / (calp2 * cbet2);
+		}
+	}
+
+	*psalp2 = salp2;
+	*pcalp2 = calp2;
+	*psig12 = sig12;
+	*pssig1 = ssig1;
+	*pcsig1 = csig1;
+	*pssig2 = ssig2;
+	*pcsig2 = csig2;
+	*peps = eps;
+	return lam12;
+}
+
+/* The inverse problem: ll_from and ll_to are longitude and latitude in
+   degrees.  Returns the azimuth at the first point in degrees east of
+   north, and the distance in *dist. */
+static double CSkrnyInverse (Const struct csKarney_ *krny,Const double ll_from [2],Const double ll_to [2],double *dist)
+{
+	extern double cs_Degree;		/* 1.0 / 57.29577... */
+	extern double cs_Pi;			/* 3.14159.... */
+
+	int meridian;
+	int swapp;
+	int numit;
+	int tripn, tripb;
+	double lat1, lat2;
+	double lon12, lon12s;
+	double lonsign, latsign;
+	double lam12, slam12, clam12;
+	double sbet1, cbet1, sbet2, cbet2;
+	double dn1, dn2;
+	double salp1, calp1, salp2, calp2;
+	double ssig1, csig1, ssig2, csig2;
+	double sig12, s12x, m12x;
+	double dnm, eps;
+	double salp1a, calp1a, salp1b, calp1b;
+	double vv, dv, dalp1, sdalp1, cdalp1, nsalp1;
+	double tmp;
+
+	lat1 = ll_from [LAT];
+	lat2 = ll_to [LAT];
+	s12x = m12x = 0.0;
+	eps = 0.0;
+	salp2 = calp2 = 0.0;
+
+	/* Make the longitude difference positive. */
+	lon12 = CSkrnyAngDiff (ll_from [LNG],ll_to [LNG],&lon12s);
+	lonsign = (lon12 >= 0.0) ? 1.0 : -1.0;
+	lon12 = lonsign * CSkrnyAngRound (lon12);
+	lon12s = CSkrnyAngRound ((180.0 - lon12) - lonsign * lon12s);
+	lam12 = lon12 * cs_Degree;
+	if (lon12 > 90.0)
+	{
+		CSkrnySinCos (lon12s,&slam12,&clam12);
+		clam12 = -clam12;
+	}
+	else
+	{
+		CSkrnySinCos (lon12,&slam12,&clam12);
+	}
+
+	/* Swap the points so that |lat1| >= |lat2|, and make lat1 <= 0. */
+	lat1 = CSkrnyAngRound (lat1);
+	lat2 = CSkrnyAngRound (lat2);
+	swapp = (fabs (lat1) < fabs (lat2)) ? -1 : 1;
+	if (swapp < 0)
+	{
+		lonsign *= -1.0;
+		tmp = lat1; lat1 = lat2; lat2 = tmp;
+	}
+	latsign = (lat1 < 0.0) ? 1.0 : -1.0;
+	lat1 *= latsign;
+	lat2 *= latsign;
+
+	/* Reduced latitudes. */
+	CSkrnySinCos (lat1,&sbet1,&cbet1);
+	sbet1 *= krny->f1;
+	CSkrnyNorm (&sbet1,&cbet1);
+	if (cbet1 < krny->tiny) cbet1 = krny->tiny;
+	CSkrnySinCos (lat2,&sbet2,&cbet2);
+	sbet2 *= krny->f1;
+	CSkrnyNorm (&sbet2,&cbet2);
+	if (cbet2 < krny->tiny) cbet2 = krny->tiny;
+
+	/* Ensure cbet1 == cbet2 exactly when the latitudes are equal, or
+	   opposite. */
+	if (cbet1 < -sbet1)
+	{
+		if (cbet2 == cbet1) sbet2 = (sbet2 < 0.0) ? sbet1 : -sbet1;
+	}
+	else
+	{
+		if (fabs (sbet2) == -sbet1) cbet2 = cbet1;
+	}
+
+	dn1 = sqrt (1.0 + krny->ep2 * sbet1 * sbet1);
+	dn2 = sqrt (1.0 + krny->ep2 * sbet2 * sbet2);
+
+	meridian = (lat1 == -90.0 || slam12 == 0.0);
+	if (meridian)
+	{
+		/* Along a meridian, or from a pole. */
+		calp1 = clam12;
+		salp1 = slam12;
+		calp2 = 1.0;
+		salp2 = 0.0;
+		ssig1 = sbet1;
+		csig1 = calp1 * cbet1;
+		ssig2 = sbet2;
+		csig2 = calp2 * cbet2;
+		sig12 = csig1 * ssig2 - ssig1 * csig2;
+		sig12 = atan2 ((sig12 > 0.0) ? sig12 : 0.0,csig1 * csig2 + ssig1 * ssig2);
+		CSkrnyLengths (krny->nn,sig12,ssig1,csig1,dn1,ssig2,csig2,dn2,&s12x,&m12x,NULL);
+		if (sig12 < krny->tol2 || m12x >= 0.0)
+		{
+			if (sig12 < 3.0 * krny->tiny || (sig12 < krny->tol0 && (s12x < 0.0 || m12x < 0.0)))
+			{
+				sig12 = m12x = s12x = 0.0;
+			}
+			s12x *= krny->b_rad;
+		}
+		else
+		{
+			/* m12 < 0, i.e. prolate and too close to anti-podal. */
+			meridian = FALSE;
+		}
+	}
+
+	if (!meridian && sbet1 == 0.0 && (krny->flat <= 0.0 || lon12s >= krny->flat * 180.0))
+	{
+		/* Along the equator. */
+		calp1 = calp2 = 0.0;
+		salp1 = salp2 = 1.0;
+		s12x = krny->e_rad * lam12;
+	}
+	else if (!meridian)
+	{
+		sig12 = CSkrnyInvStart (krny,sbet1,cbet1,dn1,sbet2,cbet2,dn2,lam12,slam12,clam12,
+								&salp1,&calp1,&salp2,&calp2,&dnm);
+		if (sig12 >= 0.0)
+		{
+			/* Short line, solved directly. */
+			s12x = sig12 * krny->b_rad * dnm;
+		}
+		else
+		{
+			/* Newton's method, with bisection as a safeguard. */
+			numit = 0;
+			tripn = tripb = FALSE;
+			salp1a = krny->tiny; calp1a = 1.0;
+			salp1b = krny->tiny; calp1b = -1.0;
+			for (;;)
+			{
+				vv = CSkrnyLambda12 (krny,sbet1,cbet1,dn1,sbet2,cbet2,dn2,salp1,calp1,slam12,clam12,
+									 &salp2,&calp2,&sig12,&ssig1,&csig1,&ssig2,&csig2,&eps,
+									 (numit < csKRNY_MAXIT1) ? &dv : NULL);
+				if (tripb || !(fabs (vv) >= (tripn ? 8.0 : 1.0) * krny->tol0) || numit == csKRNY_MAXIT2)
+				{
+					break;
+				}
+				if (vv > 0.0 && (numit > csKRNY_MAXIT1 || calp1 / salp1 > calp1b / salp1b))
+				{
+					salp1b = salp1; calp1b = calp1;
+				}
+				else if (vv < 0.0 && (numit > csKRNY_MAXIT1 || calp1 / salp1 < calp1a / salp1a))
+				{
+					salp1a = salp1; calp1a = calp1;
+				}
+				numit += 1;
+				if (numit < csKRNY_MAXIT1 && dv > 0.0)
+				{
+					dalp1 = -vv / dv;
+					if (fabs (dalp1) < cs_Pi)
+					{
+						sdalp1 = sin (dalp1);
+						cdalp1 = cos (dalp1);
+						nsalp1 = salp1 * cdalp1 + calp1 * sdalp1;
+						if (nsalp1 > 0.0)
+						{
+							calp1 = calp1 * cdalp1 - salp1 * sdalp1;
+							salp1 = nsalp1;
+							CSkrnyNorm (&salp1,&calp1);
+							tripn = (fabs (vv) <= 16.0 * krny->tol0);
+							continue;
+						}
+					}
+				}
+				salp1 = (salp1a + salp1b) / 2.0;
+				calp1 = (calp1a + calp1b) / 2.0;
+				CSkrnyNorm (&salp1,&calp1);
+				tripn = FALSE;
+				tripb = (fabs (salp1a - salp1) + (calp1a - calp1) < krny->tol0 ||
+						 fabs (salp1 - salp1b) + (calp1 - calp1b) < krny->tol0);
+			}
+			CSkrnyLengths (eps,sig12,ssig1,csig1,dn1,ssig2,csig2,dn2,&s12x,NULL,NULL);
+			s12x *= krny->b_rad;
+		}
+	}
+
+	*dist = 0.0 + s12x;
+
+	/* Undo the swap and the sign changes. */
+	if (swapp < 0)
+	{
+		salp1 = salp2;
+		calp1 = calp2;
+	}
+	salp1 *= swapp * lonsign;
+	calp1 *= swapp * latsign;
+	return CSkrnyAtan2 (salp1,calp1);
+}
+
+/* The direct problem: ll_from is longitude and latitude in degrees,
+   az in degrees east of north.  The longitude and latitude of the end
+   point are returned in ll_to, the longitude in the range -180 to
+   +180. */
+static void CSkrnyDirect (Const struct csKarney_ *krny,Const double ll_from [2],double az,double dist,double ll_to [2])
+{
+	extern double cs_Radian;		/* 57.29577... */
+
+	double salp1, calp1;
+	double sbet1, cbet1, sbet2, cbet2;
+	double salp0, calp0;
+	double ssig1, csig1, ssig2, csig2;
+	double somg1, comg1, somg2, comg2;
+	double k2, eps;
+	double A1m1, B11, B12;
+	double stau1, ctau1, tau12;
+	double sig12, ssig12, csig12;
+	double omg12, lam12, A3c, B31;
+	double ss, cc, serr;
+	double C1a [csKRNY_ORD + 1];
+	double C1pa [csKRNY_ORD + 1];
+	double C3a [csKRNY_ORD];
+
+	CSkrnySinCos (CSkrnyAngRound (az),&salp1,&calp1);
+	CSkrnySinCos (CSkrnyAngRound (ll_from [LAT]),&sbet1,&cbet1);
+	sbet1 *= krny->f1;
+	CSkrnyNorm (&sbet1,&cbet1);
+	if (cbet1 < krny->tiny) cbet1 = krny->tiny;
+
+	/* The equatorial azimuth, alp0, and the arc from the equator
+	   crossing, sig1. */
+	salp0 = salp1 * cbet1;
+	calp0 = sqrt (calp1 * calp1 + (salp1 * sbet1) * (salp1 * sbet1));
+	ssig1 = sbet1;
+	somg1 = salp0 * sbet1;
+	csig1 = comg1 = (sbet1 != 0.0 || calp1 != 0.0) ? cbet1 * calp1 : 1.0;
+	CSkrnyNorm (&ssig1,&csig1);
+
+	k2 = calp0 * calp0 * krny->ep2;
+	eps = k2 / (2.0 * (1.0 + sqrt (1.0 + k2)) + k2);
+
+	A1m1 = CSkrnyA1m1 (eps);
+	CSkrnyC1 (eps,C1a);
+	CSkrnyC1p (eps,C1pa);
+	B11 = CSkrnySinCosSeries (TRUE,ssig1,csig1,C1a,csKRNY_ORD);
+	ss = sin (B11);
+	cc = cos (B11);
+	stau1 = ssig1 * cc + csig1 * ss;
+	ctau1 = csig1 * cc - ssig1 * ss;
+
+	CSkrnyC3 (krny,eps,C3a);
+	A3c = -krny->flat * salp0 * CSkrnyA3 (krny,eps);
+	B31 = CSkrnySinCosSeries (TRUE,ssig1,csig1,C3a,csKRNY_ORD - 1);
+
+	/* Distance to arc length, by the reverted series. */
+	tau12 = dist / (krny->b_rad * (1.0 + A1m1));
+	ss = sin (tau12);
+	cc = cos (tau12);
+	B12 = -CSkrnySinCosSeries (TRUE,stau1 * cc + ctau1 * ss,ctau1 * cc - stau1 * ss,C1pa,csKRNY_ORD);
+	sig12 = tau12 - (B12 - B11);
+	ssig12 = sin (sig12);
+	csig12 = cos (sig12);
+	if (fabs (krny->flat) > 0.01)
+	{
+		/* The reverted series is not accurate enough for such a large
+		   flattening; one Newton step cleans it up. */
+		ssig2 = ssig1 * csig12 + csig1 * ssig12;
+		csig2 = csig1 * csig12 - ssig1 * ssig12;
+		B12 = CSkrnySinCosSeries (TRUE,ssig2,csig2,C1a,csKRNY_ORD);
+		serr = (1.0 + A1m1) * (sig12 + (B12 - B11)) - dist / krny->b_rad;
+		sig12 = sig12 - serr / sqrt (1.0 + k2 * ssig2 * ssig2);
+		ssig12 = sin (sig12);
+		csig12 = cos (sig12);
+	}
+
+	ssig2 = ssig1 * csig12 + csig1 * ssig12;
+	csig2 = csig1 * csig12 - ssig1 * ssig12;
+	sbet2 = calp0 * ssig2;
+	cbet2 = sqrt (salp0 * salp0 + (calp0 * csig2) * (calp0 * csig2));
+	if (cbet2 == 0.0) cbet2 = csig2 = krny->tiny;
+
+	somg2 = salp0 * ssig2;
+	comg2 = csig2;
+	omg12 = atan2 (somg2 * comg1 - comg2 * somg1,comg2 * comg1 + somg2 * somg1);
+	lam12 = omg12 + A3c * (sig12 + (CSkrnySinCosSeries (TRUE,ssig2,csig2,C3a,csKRNY_ORD - 1) - B31));
+
+	ll_to [LAT] = CSkrnyAtan2 (sbet2,krny->f1 * cbet2);
+	ll_to [LNG] = CSkrnyAngNrml (CSkrnyAngNrml (ll_from [LNG]) + CSkrnyAngNrml (lam12 * cs_Radian));
+}
+
+/**********************************************************************
+**	count = CS_llazddArray (e_rad,e_sq,ll_from,ll_to,cnt,az,dist);
+**	count = CS_azddllArray (e_rad,e_sq,ll_from,az,dist,cnt,ll_to,status);
+**
+**	double e_rad;		equatorial radius of the ellipsoid which
+**						is to be used.
+**	double e_sq;		ellipsoid eccentricity, squared.
+**	double ll_from [][2];	array of from points, longitude and latitude
+**						in degrees.
+**	double ll_to [][2];	array of to points; input to CS_llazddArray,
+**						output of CS_azddllArray.
+**	int cnt;			the number of entries in each of the arrays.
+**	double az [];		array of azimuths, in degrees east of north;
+**						output of CS_llazddArray, input to CS_azddllArray.
+**	double dist [];		array of distances, in the same units as e_rad;
+**						output of CS_llazddArray, input to CS_azddllArray.
+**	int status [];		CS_azddllArray returns the status of each point
+**						here, zero for success or -1 for invalid
+**						input; may be NULL.
+**	int count;			CS_llazddArray returns cnt; CS_azddllArray
+**						returns the number of points which failed.
+**
+**	Array versions of CS_llazdd and CS_azddll, intended for computing
+**	large numbers of distances and azimuths.  The values which depend
+**	only upon the ellipsoid are computed once per array, and each
+**	point is solved with the series solution above rather than the
+**	Vincenty solution of the single point functions.  The two agree to
+**	well within a millimeter wherever the Vincenty solution converges;
+**	the series solution is also correct for nearly anti-podal points,
+**	and the direct solution does not iterate.  A point fails only if
+**	its latitude is outside the range -90 to +90, or its longitude,
+**	azimuth or distance is not a finite number; the from point is then
+**	returned unchanged as the to point.  As with CS_llazdd, azimuths
+**	are in the range -180 to +180, and the azimuth of a zero length
+**	line is zero.  Input and output arrays may not overlap.
+**********************************************************************/
+
+int EXP_LVL1 CS_llazddArray (double e_rad,
+							 double e_sq,
+							 Const double ll_from [][2],
+							 Const double ll_to [][2],
+							 int cnt,
+							 double az [],
+							 double dist [])
+{
+	int idx;
+	struct csKarney_ krny;
+
+	CSkrnySu (&krny,e_rad,e_sq);
+	for (idx = 0;idx < cnt;idx += 1)
+	{
+		az [idx] = CSkrnyInverse (&krny,ll_from [idx],ll_to [idx],&dist [idx]);
+		if (dist [idx] == 0.0) az [idx] = 0.0;
+	}
+	return cnt;
+}
+
+int EXP_LVL1 CS_azddllArray (double e_rad,
+							 double e_sq,
+							 Const double ll_from [][2],
+							 Const double az [],
+							 Const double dist [],
+							 int cnt,
+							 double ll_to [][2],
+							 int status [])
+{
+	int idx;
+	int st;
+	int failCnt;
+	struct csKarney_ krny;
+
+	failCnt = 0;
+	CSkrnySu (&krny,e_rad,e_sq);
+	for (idx = 0;idx < cnt;idx += 1)
+	{
+		/* Written so that a NaN fails each test. */
+		st = 0;
+		if (!(fabs (ll_from [idx][LAT]) <= 90.0) || !(fabs (ll_from [idx][LNG]) <= DBL_MAX) ||
+			!(fabs (az [idx]) <= DBL_MAX) || !(fabs (dist [idx]) <= DBL_MAX))
+		{
+			st = -1;
+			failCnt += 1;
+			ll_to [idx][LNG] = ll_from [idx][LNG];
+			ll_to [idx][LAT] = ll_from [idx][LAT];
+		}
+		else
+		{
+			CSkrnyDirect (&krny,ll_from [idx],az [idx],dist [idx],ll_to [idx]);
+		}
+		if (status != NULL) status [idx] = st;
+	}
+	return failCnt;
+}
+
 /**********************************************************************
 **	CSllnrml (oll,ll,ll1,ll2);
 **
@@ -108,6 +108,23 @@ Const char * EXP_LVL3 CS_ecvt (double value,int count,int *dec,int *sign)
 	}
 	return result;
 }
+/* Hash of a key name which is consistent with CS_stricmp; i.e. names which
+   CS_stricmp considers equal produce the same value.  Used to index the
+   various tables which are searched by name (FNV-1a). */
+ulong32_t EXP_LVL9 CSkeyHash (Const char *keyName)
+{
+	char cc;
+	ulong32_t hash;
+
+	hash = 2166136261UL;
+	while ((cc = *keyName++) != '\0')
+	{
+		if (CS_isupper (cc)) cc = (char)CS_tolower (cc);
+		hash ^= (ulong32_t)(unsigned char)cc;
+		hash = (hash * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	return hash;
+}
 int EXP_LVL3 CS_stricmp (Const char* cp1,Const char *cp2)
 {
 	char cc1, cc2;
@@ -262,17 +262,48 @@ int EXP_LVL9 CSbdkasI3 (struct csBdkas_ *badekas, double* trgLl, Const double* s
 	return status;
 }
 
+/* Applies the exact inverse of the linear portion (rotation and scale) of
+   the forward transformation to a geocentric vector. */
+static void CSbdkasLinInv (Const struct csBdkas_ *badekas,double rslt [3],Const double vec [3])
+{
+	extern double cs_One;				/* 1.0 */
+
+	double uu [3];
+	double dot;
+	double denom;
+
+	/* The rotation matrix is I - W, where W * vec is the cross product of
+	   the rotation vector with vec.  Since W is skew symmetric,
+	   inverse (I - W) = (I + W + r * rT) / (1 + |r| ** 2); i.e. the
+	   transpose is only an approximation of the inverse. */
+	uu [XX] = vec [XX] / badekas->scale;
+	uu [YY] = vec [YY] / badekas->scale;
+	uu [ZZ] = vec [ZZ] / badekas->scale;
+	dot = badekas->rotX * uu [XX] + badekas->rotY * uu [YY] + badekas->rotZ * uu [ZZ];
+	denom = cs_One + badekas->rotX * badekas->rotX + badekas->rotY * badekas->rotY + badekas->rotZ * badekas->rotZ;
+	rslt [XX] = (uu [XX] + (badekas->rotY * uu [ZZ] - badekas->rotZ * uu [YY]) + badekas->rotX * dot) / denom;
+	rslt [YY] = (uu [YY] + (badekas->rotZ * uu [XX] - badekas->rotX * uu [ZZ]) + badekas->rotY * dot) / denom;
+	rslt [ZZ] = (uu [ZZ] + (badekas->rotX * uu [YY] - badekas->rotY * uu [XX]) + badekas->rotZ * dot) / denom;
+	return;
+}
+
 /******************************************************************************
-	This is an iterative exercise of CSbdkasF2.  Thus, this calculation
-	will produce a rather precise inverse of geographic coordinates.  Used in
-	the two dimensional case as we don't know what the ellipsoid elevation is.
-	Thus, we can't precisely compute the inverse of a coordinate we might
-	have computed the forward for, and the using application threw away the
-	Z.  The end result of all this can be positional creep unless we do
-	as coded below.
+	This is a precise inverse of CSbdkasF2, used in the two dimensional case
+	as we don't know what the ellipsoid elevation is.  Thus, we can't simply
+	use the three dimensional inverse on a coordinate we might have computed
+	the forward for, and the using application threw away the Z.  The end
+	result of that would be positional creep.
+
+	The forward is affine in geocentric space, the rotation point included.
+	The points sharing the target latitude and longitude lie on the normal to
+	the target ellipsoid, which maps back to a line in the source system.
+	Where that line pierces the source ellipsoid is the exact inverse.  The
+	iterative exercise of CSbdkasF2 which follows is only a fallback.
 */
 int EXP_LVL9 CSbdkasI2 (struct csBdkas_ *badekas, double* trgLl, Const double* srcLl)
 {
+	extern double cs_Zero;				/* 0.0 */
+
 	int ii;
 	int lngOk;
 	int latOk;
@@ -281,6 +312,10 @@ int EXP_LVL9 CSbdkasI2 (struct csBdkas_ *badekas, double* trgLl, Const double* s
 	double guess [3];
 	double newLl [3];
 	double epsilon [3];
+	double xyz [3];
+	double nrm [3];
+	double pnt [3];
+	double dir [3];
 
 	/* Assume everything goes OK until we know different. */
 	rtnVal = 0;
@@ -290,6 +325,27 @@ int EXP_LVL9 CSbdkasI2 (struct csBdkas_ *badekas, double* trgLl, Const double* s
 	trgLl [LAT] = guess [LAT] = srcLl [LAT];
 	trgLl [HGT] = srcLl [HGT];
 
+	/* The closed form solution, see above. */
+	guess [HGT] = cs_Zero;
+	CS_llhToXyz (xyz,guess,badekas->trgERad,badekas->trgESqr);
+	CS_llhNormal (nrm,guess);
+	xyz [XX] -= badekas->deltaX + badekas->xlateX;
+	xyz [YY] -= badekas->deltaY + badekas->xlateY;
+	xyz [ZZ] -= badekas->deltaZ + badekas->xlateZ;
+	CSbdkasLinInv (badekas,pnt,xyz);
+	CSbdkasLinInv (badekas,dir,nrm);
+	pnt [XX] += badekas->xlateX;
+	pnt [YY] += badekas->xlateY;
+	pnt [ZZ] += badekas->xlateZ;
+	rtnVal = CS_xyzLineToLlh (newLl,pnt,dir,badekas->srcERad,badekas->srcESqr);
+	if (rtnVal == 0)
+	{
+		trgLl [LNG] = newLl [LNG];
+		trgLl [LAT] = newLl [LAT];
+		return rtnVal;
+	}
+	rtnVal = 0;
+
 	/* Start a loop which will iterate as many as maxIteration times. */
 	for (ii = 0;ii < badekas->maxIterations;ii++)
 	{
@@ -331,6 +387,7 @@ int EXP_LVL9 CSbdkasI2 (struct csBdkas_ *badekas, double* trgLl, Const double* s
 
 	/* If we didn't resolve in maxIteration tries, we issue a warning
 	   message.  Usually, three or four iterations does the trick. */
+	CSmetricsItr (ii,badekas->maxIterations);
 	if (ii >= badekas->maxIterations )
 	{
 		CS_erpt (cs_BW_CNVRG);
@@ -120,9 +120,11 @@ int EXP_LVL3 CS_csdel (struct cs_Csdef_ *csdef)
 		memory to facilitate the rapid validation of a coordinate system key
 		name.  Once our deletion of this coordinate system has been completed,
 		thatlist will not longer be valid.  Thus, we invalidate that list,
-		forcing a regeneration next time it is needed. */
+		forcing a regeneration next time it is needed.  Same with the
+		useful range index. */
 		CS_free (cs_CsKeyNames);
 		cs_CsKeyNames = NULL;
+		CScsRangeIdxRls ();
 	}
 
 	return result;
@@ -297,6 +299,9 @@ int EXP_LVL5 CS_csupd (struct cs_Csdef_ *csdef,int crypt)
 		cs_CsKeyNames = NULL;
 	}
 
+	//added or replaced, the useful range may have changed either way
+	CScsRangeIdxRls ();
+
 	return updateStatus;
 
 error:
@@ -383,6 +388,9 @@ struct cs_Csdef_ * EXP_LVL3 CS_csdef (Const char *cs_nam)
 **********************************************************************/
 struct cs_Csdef_ * EXP_LVL7 CS_csdef2 (Const char *cs_nam, char* pszDirPath)
 {
+	extern struct cs_Metrics_ csMetrics;
+
+	csMetrics.csdefCount += 1;
 	return CS_csDefinition(cs_nam, pszDirPath, NULL);
 }
 
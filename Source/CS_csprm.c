@@ -35,6 +35,74 @@
 
 extern int (*cs_CsHook)(struct cs_Csdef_ *csdef,unsigned short prj_code,ulong32_t prj_flags);
 
+/**********************************************************************
+**	pp = CSprjtabLu (prjKeyName);
+**
+**	char *prjKeyName;			key name of the projection to be located.
+**	struct cs_Prjtab_ *pp;		returns a pointer to the cs_Prjtab entry
+**								with the given key name, or a pointer to
+**								the terminating entry of the table (i.e.
+**								key_nm [0] == '\0') if there is none.
+**
+**	Equivalent to a linear search of cs_Prjtab using CS_stricmp, which
+**	is performed several times in the course of setting up a single
+**	coordinate system.  A hashed index of the table is built on first
+**	use.  Application programmers may edit the table, so a hit is always
+**	verified, and a name not found in the index is searched for the
+**	hard way.
+**********************************************************************/
+
+#define cs_PRJIDX_SIZE 256
+static short csPrjtabIdx [cs_PRJIDX_SIZE];
+static int csPrjtabIdxOk = FALSE;
+
+struct cs_Prjtab_* EXP_LVL9 CSprjtabLu (Const char *prjKeyName)
+{
+	extern struct cs_Prjtab_ cs_Prjtab [];
+
+	int ii;
+	int slot;
+
+	struct cs_Prjtab_ *pp;
+
+	if (!csPrjtabIdxOk)
+	{
+		for (slot = 0;slot < cs_PRJIDX_SIZE;slot++)
+		{
+			csPrjtabIdx [slot] = 0;
+		}
+		for (ii = 0;cs_Prjtab [ii].key_nm [0] != '\0' && ii < (cs_PRJIDX_SIZE / 2);ii++)
+		{
+			slot = (int)(CSkeyHash (cs_Prjtab [ii].key_nm) % cs_PRJIDX_SIZE);
+			while (csPrjtabIdx [slot] != 0 &&
+				   CS_stricmp (cs_Prjtab [csPrjtabIdx [slot] - 1].key_nm,cs_Prjtab [ii].key_nm))
+			{
+				slot = (slot + 1) % cs_PRJIDX_SIZE;
+			}
+			if (csPrjtabIdx [slot] == 0)
+			{
+				csPrjtabIdx [slot] = (short)(ii + 1);
+			}
+		}
+		csPrjtabIdxOk = TRUE;
+	}
+
+	slot = (int)(CSkeyHash (prjKeyName) % cs_PRJIDX_SIZE);
+	while (csPrjtabIdx [slot] != 0)
+	{
+		pp = &cs_Prjtab [csPrjtabIdx [slot] - 1];
+		if (!CS_stricmp (pp->key_nm,prjKeyName)) return pp;
+		slot = (slot + 1) % cs_PRJIDX_SIZE;
+	}
+
+	/* Not in the index. */
+	for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
+	{
+		if (!CS_stricmp (pp->key_nm,prjKeyName)) break;
+	}
+	return pp;
+}
+
 /**********************************************************************
 **	csprm = CS_csloc (cs_nam);
 **
@@ -48,7 +116,6 @@ extern int (*cs_CsHook)(struct cs_Csdef_ *csdef,unsigned short prj_code,ulong32_
 struct cs_Csprm_ * EXP_LVL3 CS_csloc (Const char *cs_nam)
 {
 	extern char csErrnam [];
-	extern struct cs_Prjtab_ cs_Prjtab [];
 
 	int status;
 
@@ -60,6 +127,7 @@ struct cs_Csprm_ * EXP_LVL3 CS_csloc (Const char *cs_nam)
 
 	csprm = NULL;
 	cs_ptr = NULL;
+	CStraceBgn (cs_TRACE_CSLOC,cs_nam);
 
 	/* Get the coordinate system definition from the dictionary. */
 
@@ -71,10 +139,7 @@ struct cs_Csprm_ * EXP_LVL3 CS_csloc (Const char *cs_nam)
 	   as CS_cschk will do the same thing, but it isn't that
 	   expensive. */
 
-	for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
-	{
-		if (!CS_stricmp (pp->key_nm,cs_ptr->prj_knm)) break;
-	}
+	pp = CSprjtabLu (cs_ptr->prj_knm);
 	if (*pp->key_nm == '\0' || pp->setup == NULL)
 	{
 		CS_stncp (csErrnam,cs_ptr->prj_knm,MAXPATH);
@@ -104,11 +169,13 @@ struct cs_Csprm_ * EXP_LVL3 CS_csloc (Const char *cs_nam)
 
 	CS_free (cs_ptr);
 	cs_ptr = NULL;
+	CStraceEnd (cs_TRACE_CSLOC,cs_nam,0);
 	return (csprm);
 
 error:
 	if (cs_ptr != NULL) CS_free (cs_ptr);
 	if (csprm != NULL) CS_free (csprm);		/*lint !e774 */ /* redundant, but defensively desireable */
+	CStraceEnd (cs_TRACE_CSLOC,cs_nam,-1);
 	return (NULL);
 }
 
@@ -120,7 +187,6 @@ error:
 struct cs_Csprm_ * EXP_LVL3 CScsloc1 (struct cs_Csdef_ *cs_ptr)
 {
 	extern char csErrnam [];
-	extern struct cs_Prjtab_ cs_Prjtab [];
 
 	struct cs_Csprm_ *csprm;
 	struct cs_Datum_ *dt_ptr;
@@ -137,10 +203,7 @@ struct cs_Csprm_ * EXP_LVL3 CScsloc1 (struct cs_Csdef_ *cs_ptr)
 	   as CS_cschk (called from CScsloc) will do the same thing,
 	   but if we don't have a valid projection, things get ugly. */
 
-	for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
-	{
-		if (!CS_stricmp (pp->key_nm,cs_ptr->prj_knm)) break;
-	}
+	pp = CSprjtabLu (cs_ptr->prj_knm);
 	if (*pp->key_nm == '\0' || pp->setup == NULL)
 	{
 		CS_stncp (csErrnam,cs_ptr->prj_knm,MAXPATH);
@@ -257,7 +320,6 @@ struct cs_Csprm_ * EXP_LVL3 CScsloc (	struct cs_Csdef_ *cs_ptr,
 										struct cs_Datum_ *dt_ptr)
 {
 	extern char csErrnam [];
-	extern struct cs_Prjtab_ cs_Prjtab [];
 
 	extern double cs_One;					/* 1.0 */
 	extern double cs_Two_pi;				/* 6.28..... */
@@ -278,10 +340,7 @@ struct cs_Csprm_ * EXP_LVL3 CScsloc (	struct cs_Csdef_ *cs_ptr,
 	   as CS_cschk (below) will do the same thing, but if we
 	   don't have a valid projection, things get ugly. */
 
-	for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
-	{
-		if (!CS_stricmp (pp->key_nm,cs_ptr->prj_knm)) break;
-	}
+	pp = CSprjtabLu (cs_ptr->prj_knm);
 	if (*pp->key_nm == '\0' || pp->setup == NULL)
 	{
 		CS_stncp (csErrnam,cs_ptr->prj_knm,MAXPATH);
@@ -390,8 +449,10 @@ struct cs_Csprm_ * EXP_LVL3 CScsloc (	struct cs_Csdef_ *cs_ptr,
 	csprm->prj_flags = pp->flags;
 
 	/* Call the Set up routine.  We wouldn't be here if pp wasn't
-	   valid. */
+	   valid.  Only a few projections provide the combined distortion
+	   function. */
 
+	csprm->cs_dstrt = NULL;
 	(*pp->setup)(csprm);
 
 	/* That's it. Csprm is already to go. */
@@ -427,21 +488,89 @@ extern int (*cs_DtHook)(struct cs_Dtdef_ *dtdef);
 **	The returned pointer points to a malloc'ed area of
 **	memory and can be "free'ed" by CS_free when no longer
 **	required.
+**
+**	The most recently located datums are kept in a small cache
+**	(see csDtmcach_ in cs_map.h), as composing the structure
+**	requires a search of two dictionary files.
 **********************************************************************/
 
+static int csDtmcachCnt = 0;			/* Entries actually allocated. */
+static ulong32_t csDtmcachClock = 0UL;	/* Source of lastUse values. */
+
 struct cs_Datum_ * EXP_LVL5 CS_dtloc (Const char *dat_nam)
 
 {
 	extern char csErrnam [];
+	extern int (*CS_usrDtDefPtr)(struct cs_Dtdef_ *dtDef,Const char *keyName);
+	extern int (*CS_usrElDefPtr)(struct cs_Eldef_ *elDef,Const char *keyName);
+	extern struct csDtmcach_ *csDtmcachP;
+	extern int csDtmcachI;
+	extern struct cs_Metrics_ csMetrics;
 
+	int ii;
 	int status;
+	int useCache;
+
+	ulong32_t hash;
 
 	struct cs_Dtdef_ *dtdef_p;
 	struct cs_Datum_ *datum;
+	struct csDtmcach_ *chPtr;
+	struct csDtmcach_ *oldPtr;
 
 	/* Prepare for any type of error. */
 
 	datum = NULL;
+	dtdef_p = NULL;
+	hash = 0UL;
+	oldPtr = NULL;
+
+	/* Look in the cache first.  The cache is not used while any of the
+	   hooks which could produce a different result are active. */
+
+	useCache = (csDtmcachI > 0 && cs_DtHook == NULL &&
+				CS_usrDtDefPtr == NULL && CS_usrElDefPtr == NULL);
+	if (useCache && csDtmcachP == NULL)
+	{
+		csDtmcachP = (struct csDtmcach_ *)CS_malc (sizeof (struct csDtmcach_) * (size_t)csDtmcachI);
+		if (csDtmcachP == NULL)
+		{
+			CS_erpt (cs_NO_MEM);
+			goto error;
+		}
+		csDtmcachCnt = csDtmcachI;
+		for (ii = 0;ii < csDtmcachCnt;ii++)
+		{
+			csDtmcachP [ii].hash = 0UL;
+			csDtmcachP [ii].lastUse = 0UL;
+			csDtmcachP [ii].dt_nam [0] = '\0';
+		}
+	}
+	if (useCache)
+	{
+		hash = CSkeyHash (dat_nam);
+		oldPtr = csDtmcachP;
+		for (ii = 0;ii < csDtmcachCnt;ii++)
+		{
+			chPtr = &csDtmcachP [ii];
+			if (chPtr->hash == hash && chPtr->dt_nam [0] != '\0' &&
+				!CS_stricmp (chPtr->dt_nam,dat_nam))
+			{
+				datum = (struct cs_Datum_ *)CS_malc (sizeof (*datum));
+				if (datum == NULL)
+				{
+					CS_erpt (cs_NO_MEM);
+					goto error;
+				}
+				memcpy (datum,&chPtr->datum,sizeof (*datum));
+				chPtr->lastUse = ++csDtmcachClock;
+				csMetrics.dtmCacheHits += 1;
+				return (datum);
+			}
+			if (chPtr->lastUse < oldPtr->lastUse) oldPtr = chPtr;
+		}
+		csMetrics.dtmCacheMisses += 1;
+	}
 
 	/* Get the datum definition. */
 
@@ -473,6 +602,16 @@ struct cs_Datum_ * EXP_LVL5 CS_dtloc (Const char *dat_nam)
 	CS_free (dtdef_p);
 	dtdef_p = NULL;
 
+	/* Replace the least recently used cache entry with this one. */
+
+	if (useCache && strlen (dat_nam) < sizeof (oldPtr->dt_nam))
+	{
+		oldPtr->hash = hash;
+		oldPtr->lastUse = ++csDtmcachClock;
+		CS_stncp (oldPtr->dt_nam,dat_nam,sizeof (oldPtr->dt_nam));
+		memcpy (&oldPtr->datum,datum,sizeof (*datum));
+	}
+
 	/* Return the initialized datum structure to the user. */
 
 	return (datum);
@@ -486,6 +625,20 @@ error:
 	return (datum);
 }
 
+/* Releases the datum cache maintained by CS_dtloc; called whenever the
+   datum or ellipsoid dictionaries change. */
+void EXP_LVL9 CSdtlocRls (void)
+{
+	extern struct csDtmcach_ *csDtmcachP;
+
+	if (csDtmcachP != NULL)
+	{
+		CS_free (csDtmcachP);
+		csDtmcachP = NULL;
+	}
+	csDtmcachCnt = 0;
+}
+
 struct cs_Datum_ * EXP_LVL5 CSdtloc1 (Const struct cs_Dtdef_ *dtdef_p)
 {
 	struct cs_Eldef_ *eldef_p;
@@ -594,7 +747,6 @@ error:
 
 int EXP_LVL9 CSllCsFromDt (char* csKeyName,int csKeySize,Const char* dtKeyName)
 {
-	extern struct cs_Prjtab_ cs_Prjtab [];
 	extern struct cs_Datum_ cs_Wgs84Def;
 
 	int st;
@@ -641,10 +793,7 @@ int EXP_LVL9 CSllCsFromDt (char* csKeyName,int csKeySize,Const char* dtKeyName)
 				continue;
 			}
 			/* Determine the projection code. */
-			for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
-			{
-				if (!CS_stricmp (pp->key_nm,cs_def.prj_knm)) break;
-			}
+			pp = CSprjtabLu (cs_def.prj_knm);
 			if (*pp->key_nm == '\0' || pp->setup == NULL)
 			{
 				/* Couldn't find a projection code, shouldn't happen. */
@@ -1291,6 +1291,49 @@ EcsCsvStatus TcsCsvRecord::ReplaceRecord (std::wistream& iStrm,TcsCsvStatus& sta
     }
     return csvStatus;
 }
+EcsCsvStatus TcsCsvRecord::ReplaceRecord (TcsCsvReader& csvReader,TcsCsvStatus& status)
+{
+    // Equivalent to the std::wistream overload above, but the fields are
+    // copied directly from the reader's buffer.  Resizing, rather than
+    // clearing, the Fields vector lets the existing strings keep their
+    // allocations from one record to the next.
+    EcsCsvStatus csvStatus = csvReader.NextRecord ();
+    if (csvStatus == csvOk)
+    {
+        status.BumpLineNbr ();
+        csvStatus = csvReader.ParseFields ();
+        if (csvStatus == csvOk)
+        {
+            short fldCnt = csvReader.FieldCount ();
+            Fields.resize (static_cast<size_t>(fldCnt));
+            for (short fldNbr = 0;fldNbr < fldCnt;fldNbr += 1)
+            {
+                csvReader.GetField (Fields [static_cast<size_t>(fldNbr)],fldNbr);	//lint !e534  ignoring return value
+            }
+            if (fldCnt < MinFldCnt)
+            {
+                status.SetStatus (csvTooFewFields);
+            }
+            else if (fldCnt > MaxFldCnt)
+            {
+                status.SetStatus (csvTooManyFields);
+            }
+        }
+        else
+        {
+            Fields.clear ();
+        }
+    }
+    if (csvStatus != csvOk)
+    {
+        if (csvStatus == csvEmptyLine || csvStatus == csvCommentLine)
+        {
+            status.BumpLineNbr ();
+        }
+        status.SetStatus (csvStatus);
+    }
+    return csvStatus;
+}
 bool TcsCsvRecord::ReturnAsRecord (std::wstring& record,TcsCsvStatus& /*status*/,const wchar_t* delimiters) const
 {
     bool ok = true;
@@ -1328,6 +1371,626 @@ bool TcsCsvRecord::WriteToStream (std::wostream& oStrm,TcsCsvStatus& status,cons
 }
 //newPage//
 //=============================================================================
+// TcsCsvReader Object -- Buffered extraction and parsing of CSV records.
+//
+// The two state machines below are line for line equivalents of those in
+// csGetCsvRecord and csCsvFieldParse.  The difference is that they operate in
+// place on a buffer rather than copying characters into std::wstrings.  Should
+// the rules implemented by either of those functions change, the equivalent
+// change needs to be made here.
+//
+// Since csGetCsvRecord drops all carriage returns, csCsvFieldParse never sees
+// one.  The field parser here sees the raw text, so it skips carriage returns
+// explicitly, and any field which contains one is marked as "cooked" so that
+// GetField will remove them when the field is materialized.
+//=============================================================================
+const size_t TcsCsvReader::DefaultBlockSize = 65536;
+//=========================================================================
+// Construction, Destruction, Assignment
+TcsCsvReader::TcsCsvReader (std::wistream& iStrm,const wchar_t* delimiters,size_t blockSize)
+                                :
+                            IStrm        (&iStrm),
+                            StrmDone     (false),
+                            EofSeen      (false),
+                            FieldsParsed (false),
+                            Separator    (L','),
+                            Quote        (L'\"'),
+                            Escape       (L'\"'),
+                            Comment      (L'\0'),
+                            Data         (0),
+                            DataEnd      (0),
+                            RecBeg       (0),
+                            RecEnd       (0),
+                            NextPos      (0),
+                            ParseStatus  (csvOk),
+                            Buffer       (),
+                            Spans        ()
+{
+    SetDelimiters (delimiters);
+    if (blockSize == 0)
+    {
+        blockSize = DefaultBlockSize;
+    }
+    else if (blockSize < 16)
+    {
+        blockSize = 16;
+    }
+    Buffer.resize (blockSize);
+    Data = &Buffer [0];
+    Spans.reserve (32);
+
+    // Mimic the behavior of a stream which is not in a good state
+    // before we start.
+    if (!iStrm.good ())
+    {
+        StrmDone = true;
+        EofSeen = true;
+    }
+}
+TcsCsvReader::TcsCsvReader (const wchar_t* csvText,size_t csvLength,const wchar_t* delimiters)
+                                :
+                            IStrm        (0),
+                            StrmDone     (true),
+                            EofSeen      (false),
+                            FieldsParsed (false),
+                            Separator    (L','),
+                            Quote        (L'\"'),
+                            Escape       (L'\"'),
+                            Comment      (L'\0'),
+                            Data         (csvText),
+                            DataEnd      (csvLength),
+                            RecBeg       (0),
+                            RecEnd       (0),
+                            NextPos      (0),
+                            ParseStatus  (csvOk),
+                            Buffer       (),
+                            Spans        ()
+{
+    SetDelimiters (delimiters);
+    Spans.reserve (32);
+    if (csvText == 0)
+    {
+        DataEnd = 0;
+        EofSeen = true;
+    }
+}
+TcsCsvReader::~TcsCsvReader (void)
+{
+}
+//=========================================================================
+// Public Named Member Functions
+bool TcsCsvReader::AtEof (void) const
+{
+    // Equivalent to !iStrm.good () after a csGetCsvRecord call.
+    return EofSeen;
+}
+//lint -save -esym(788,done,error)  enumeration names not used in switch
+EcsCsvStatus TcsCsvReader::NextRecord (void)
+{
+    EcsCsvStatus csvStatus = csvOk;
+
+    bool wholeLineComment (false);
+    size_t position;
+    size_t appended;
+    wchar_t wc;
+
+    // Same states as csGetCsvRecord.
+    enum {  error,
+            preamble,
+            copyingFields,
+            copyingQuotedField,
+            lastWasEscape,
+            lastWasQuote,
+            copyingComment,
+            done,
+            eof
+         } state;
+
+    Spans.clear ();
+    FieldsParsed = false;
+    ParseStatus = csvOk;
+
+    position = NextPos;
+    RecBeg = position;
+    appended = 0;
+    state = preamble;
+    while (state != done && state != error)
+    {
+        if (position >= DataEnd)
+        {
+            // Refill moves the current record to the front of the buffer.
+            size_t offset = position - RecBeg;
+            if (!Refill ())
+            {
+                EofSeen = true;
+                state = eof;
+                break;
+            }
+            position = RecBeg + offset;
+        }
+        wc = Data [position++];
+        if (wc == L'\r')
+        {
+            continue;
+        }
+
+        switch (state) {
+        case preamble:
+            if (wc == Quote)
+            {
+                state = copyingQuotedField;
+            }
+            else if (wc == L'\n')
+            {
+                state = done;
+            }
+            else if (wc == Separator)
+            {
+                state = preamble;
+            }
+            else if (wc == Comment)
+            {
+                state = copyingFields;
+                if (appended == 0)
+                {
+                    wholeLineComment = true;
+                    state = copyingComment;
+                }
+            }
+            else
+            {
+                state = copyingFields;
+            }
+            break;
+
+        case copyingFields:
+            if (wc == L'\n') state = done;
+            if (wc == Separator) state = preamble;
+            break;
+
+        case copyingQuotedField:
+            if (wc == Escape)
+            {
+                state = (Escape == Quote) ? lastWasQuote : lastWasEscape;
+            }
+            break;
+
+        case lastWasQuote:
+            if (wc == L'\n')
+            {
+                state = done;
+            }
+            else if (wc == Quote)
+            {
+                state = copyingQuotedField;
+            }
+            else if (wc == Separator)
+            {
+                state = preamble;
+            }
+            else
+            {
+                state = copyingFields;
+            }
+            break;
+
+        case lastWasEscape:
+            state = copyingQuotedField;
+            break;
+
+        case copyingComment:
+            if (wc == L'\n')
+            {
+                state = done;
+            }
+            break;
+
+        case eof:               // Keep lint happy.
+        default:
+            state = error;
+            csvStatus = csvInternal;
+            break;
+        }
+
+        if (state != done && state != error)
+        {
+            appended += 1;
+        }
+        if (appended >= 100000)
+        {
+            state = error;
+            csvStatus = csvRecordTooLong;
+            break;
+        }
+    }
+
+    // The terminating new line is not part of the record.
+    RecEnd = (state == done) ? position - 1 : position;
+    NextPos = position;
+
+    switch (state) {
+    case error:
+        break;
+    case done:
+        if (appended == 0)
+        {
+            csvStatus = csvEmptyLine;
+        }
+        else
+        {
+            csvStatus = wholeLineComment ? csvCommentLine : csvOk;
+        }
+        break;
+    case eof:
+        csvStatus = (appended == 0) ? csvEof : csvEarlyEof;
+        break;
+    case preamble:
+    case copyingFields:
+        csvStatus = csvOk;
+        break;
+    case copyingQuotedField:
+        csvStatus = csvEndInQuote;
+        break;
+    case lastWasEscape:
+        csvStatus = csvLastWasEsc;
+        break;
+    case lastWasQuote:
+        csvStatus = csvInvRecord;
+        break;
+    case copyingComment:
+    default:
+        csvStatus = csvInternal;
+        break;
+    }
+    return csvStatus;
+}
+//lint -restore
+//lint -save
+//lint -esym(788,csvState::csvDone,csvState::csvError)  // enumeration values not used in switch
+EcsCsvStatus TcsCsvReader::ParseFields (void)
+{
+    EcsCsvStatus status = csvOk;
+
+    // Same states as csCsvFieldParse.
+    enum csvState { csvNone = 0,
+                    csvBegTrim,
+                    csvQuoted,
+                    csvQuotedEsc,
+                    csvUnQuoted,
+                    csvEndTrim,
+                    csvDone,
+                    csvError
+                  } state;
+
+    wchar_t wc;
+    size_t position;
+    size_t fieldLength;
+    TcsCsvFieldSpan span;
+
+    if (FieldsParsed)
+    {
+        return ParseStatus;
+    }
+
+    Spans.clear ();
+    span.FieldPtr = Data + RecBeg;
+    span.FieldLength = 0;
+    span.Quoted = false;
+    span.Cooked = false;
+    fieldLength = 0;
+    position = RecBeg;
+    state = csvBegTrim;
+
+    while (state != csvDone && state != csvError)
+    {
+        if (position >= RecEnd)
+        {
+            if (state == csvQuoted || state == csvQuotedEsc)
+            {
+                state = csvError;
+                status = csvEndInQuote;
+            }
+            else
+            {
+                if (state == csvUnQuoted)
+                {
+                    span.FieldLength = static_cast<size_t>((Data + position) - span.FieldPtr);
+                }
+                if (state != csvEndTrim)
+                {
+                    Spans.push_back (span);
+                }
+                state = csvDone;
+            }
+        }
+        else
+        {
+            wc = Data [position++];
+            if (wc == L'\r')
+            {
+                if (state != csvBegTrim && state != csvEndTrim)
+                {
+                    span.Cooked = true;
+                }
+                continue;
+            }
+            switch (state) {
+            case csvBegTrim:
+                if (wc == Quote)
+                {
+                    span.FieldPtr = Data + position;
+                    span.Quoted = true;
+                    state = (Escape == Quote) ? csvQuoted : csvQuotedEsc;
+                }
+                else if (!iswspace (wc))
+                {
+                    if (wc == Separator)
+                    {
+                        // The null field.
+                        span.FieldPtr = Data + position - 1;
+                        Spans.push_back (span);
+                        span.Cooked = false;
+                    }
+                    else
+                    {
+                        span.FieldPtr = Data + position - 1;
+                        state = csvUnQuoted;
+                        fieldLength += 1;
+                    }
+                }
+                break;
+
+            case csvUnQuoted:
+                if (wc == L'\n')
+                {
+                    state = csvError;
+                    status = csvInvLineBrk;
+                    break;
+                }
+                if (wc != Separator)
+                {
+                    fieldLength += 1;
+                }
+                else
+                {
+                    span.FieldLength = static_cast<size_t>((Data + position - 1) - span.FieldPtr);
+                    Spans.push_back (span);
+                    span.FieldLength = 0;
+                    span.Cooked = false;
+                    fieldLength = 0;
+                    state = csvBegTrim;
+                }
+                break;
+
+            case csvQuoted:
+                if (wc == Quote)
+                {
+                    size_t nextPos = SkipReturns (position);
+                    if (nextPos < RecEnd && Data [nextPos] == Quote)
+                    {
+                        // Two consecutive quote characters.
+                        position = nextPos + 1;
+                        span.Cooked = true;
+                        fieldLength += 1;
+                    }
+                    else
+                    {
+                        span.FieldLength = static_cast<size_t>((Data + position - 1) - span.FieldPtr);
+                        Spans.push_back (span);
+                        span.FieldLength = 0;
+                        span.Quoted = false;
+                        span.Cooked = false;
+                        fieldLength = 0;
+                        state = csvEndTrim;
+                    }
+                }
+                else
+                {
+                    fieldLength += 1;
+                }
+                break;
+
+            case csvQuotedEsc:
+                if (wc == Escape)
+                {
+                    size_t nextPos = SkipReturns (position);
+                    if (nextPos < RecEnd)
+                    {
+                        position = nextPos + 1;
+                        span.Cooked = true;
+                        fieldLength += 1;
+                    }
+                    else
+                    {
+                        state = csvError;
+                        status = csvLastWasEsc;
+                    }
+                }
+                else if (wc == Quote)
+                {
+                    span.FieldLength = static_cast<size_t>((Data + position - 1) - span.FieldPtr);
+                    Spans.push_back (span);
+                    span.FieldLength = 0;
+                    span.Quoted = false;
+                    span.Cooked = false;
+                    fieldLength = 0;
+                    state = csvEndTrim;
+                }
+                else
+                {
+                    fieldLength += 1;
+                }
+                break;
+
+            case csvEndTrim:
+                if (wc == Separator)
+                {
+                    state = csvBegTrim;
+                }
+                else if (!iswspace (wc))
+                {
+                    state = csvError;
+                    status = csvAmbigQuote;
+                }
+                break;
+
+            case csvNone:
+            default:
+                state = csvError;
+                status = csvInternal;
+                break;
+            }
+        }
+        if (fieldLength > 10000)
+        {
+            state = csvError;
+            status = csvFieldTooLong;
+        }
+        if (Spans.size () > 300)
+        {
+            state = csvError;
+            status = csvTooManyFields;
+        }
+    }
+    FieldsParsed = true;
+    ParseStatus = status;
+    return status;
+}
+//lint -restore
+short TcsCsvReader::FieldCount (void) const
+{
+    short fldCount = static_cast<short>(Spans.size ());
+    return fldCount;
+}
+const TcsCsvFieldSpan* TcsCsvReader::GetFieldSpan (short fieldNbr) const
+{
+    const TcsCsvFieldSpan* spanPtr = 0;
+
+    if (fieldNbr >= 0 && static_cast<size_t>(fieldNbr) < Spans.size ())
+    {
+        spanPtr = &Spans [static_cast<size_t>(fieldNbr)];
+    }
+    return spanPtr;
+}
+bool TcsCsvReader::GetField (std::wstring& field,short fieldNbr) const
+{
+    bool ok (false);
+    wchar_t wc;
+    const wchar_t* srcPtr;
+    const wchar_t* endPtr;
+    const TcsCsvFieldSpan* spanPtr;
+
+    field.clear ();
+    spanPtr = GetFieldSpan (fieldNbr);
+    if (spanPtr != 0)
+    {
+        ok = true;
+        if (!spanPtr->Cooked)
+        {
+            field.assign (spanPtr->FieldPtr,spanPtr->FieldLength);
+        }
+        else
+        {
+            // The parser has already verified the escape sequences, so
+            // there is no error checking required here.
+            srcPtr = spanPtr->FieldPtr;
+            endPtr = srcPtr + spanPtr->FieldLength;
+            while (srcPtr < endPtr)
+            {
+                wc = *srcPtr++;
+                if (wc == L'\r')
+                {
+                    continue;
+                }
+                if (spanPtr->Quoted && wc == Escape)
+                {
+                    while (srcPtr < endPtr && *srcPtr == L'\r')
+                    {
+                        srcPtr += 1;
+                    }
+                    if (srcPtr < endPtr)
+                    {
+                        wc = *srcPtr++;
+                    }
+                }
+                field += wc;
+            }
+        }
+    }
+    return ok;
+}
+//=========================================================================
+// Private Named Member Functions
+void TcsCsvReader::SetDelimiters (const wchar_t* delimiters)
+{
+    if (delimiters != 0)
+    {
+        if (*delimiters != L'\0')
+        {
+            Separator = *delimiters;
+            if (*(delimiters + 1) != L'\0')
+            {
+                Quote = *(delimiters + 1);
+                if (*(delimiters + 2) != L'\0')
+                {
+                    Escape = *(delimiters + 2);
+                    if (*(delimiters + 3) != L'\0')
+                    {
+                        Comment = *(delimiters + 3);
+                    }
+                }
+            }
+        }
+    }
+}
+// Reads the next block from the source stream, if any.  The current record
+// (i.e. everything from RecBeg on) is moved to the front of the buffer first,
+// growing the buffer if the record is larger than the buffer.  Returns false
+// if there is no more data to be had.
+bool TcsCsvReader::Refill (void)
+{
+    size_t keep;
+    std::streamsize readCount;
+
+    if (StrmDone || IStrm == 0)
+    {
+        return false;
+    }
+
+    keep = DataEnd - RecBeg;
+    if (RecBeg > 0 && keep > 0)
+    {
+        wmemmove (&Buffer [0],&Buffer [RecBeg],keep);
+    }
+    RecBeg = 0;
+    NextPos = 0;
+    DataEnd = keep;
+    if (DataEnd >= Buffer.size ())
+    {
+        Buffer.resize (Buffer.size () * 2);
+    }
+    Data = &Buffer [0];
+
+    IStrm->read (&Buffer [DataEnd],static_cast<std::streamsize>(Buffer.size () - DataEnd));
+    readCount = IStrm->gcount ();
+    if (readCount <= 0)
+    {
+        StrmDone = true;
+        return false;
+    }
+    DataEnd += static_cast<size_t>(readCount);
+    return true;
+}
+size_t TcsCsvReader::SkipReturns (size_t position) const
+{
+    while (position < RecEnd && Data [position] == L'\r')
+    {
+        position += 1;
+    }
+    return position;
+}
+//newPage//
+//=============================================================================
 // CSV File Sort Function Object
 //
 // Create an object of this type to specify the fields which are to be used in
@@ -2144,17 +2807,23 @@ bool TcsCsvFileBase::ReadFromStream (std::wistream& iStrm,bool firstIsLabels,Tcs
 		delimiters [3] = Comment;
 		delimiters [4] = L'\0';
 
+		// All records are extracted through a single buffered reader, rather
+		// than a character at a time from the stream.  The reader consumes the
+		// stream in blocks, i.e. beyond the last record it returns, which is
+		// of no consequence here as we read to the end.
+		TcsCsvReader csvReader (iStrm,delimiters);
+
 		// Read the labels if they're supposed to be there.
 		if (firstIsLabels)
 		{
-			csvStatus =Labels.ReplaceRecord (iStrm,status,delimiters);
+			csvStatus =Labels.ReplaceRecord (csvReader,status);
 		}
 
 		// Read the rest of the input stream.
 		csvStatus = csvOk;
-		while (csvStatus == csvOk && iStrm.good ())
+		while (csvStatus == csvOk && !csvReader.AtEof ())
 		{
-			csvStatus = csvRecord.ReplaceRecord (iStrm,status,delimiters);
+			csvStatus = csvRecord.ReplaceRecord (csvReader,status);
 			if (csvStatus == csvOk)
 			{
 				Records.push_back (csvRecord);
@@ -139,6 +139,13 @@
 **	ignored.
 **********************************************************************/
 
+/* Name given to the tracing hooks for the datum conversion setup stages.
+   The buffer must hold two key names and the separator. */
+static void CSdtcsuTraceName (char *trcName,Const struct cs_Datum_ *src_dt,Const struct cs_Datum_ *dst_dt)
+{
+	sprintf (trcName,"%.*s->%.*s",cs_KEYNM_DEF - 1,src_dt->key_nm,cs_KEYNM_DEF - 1,dst_dt->key_nm);
+}
+
 /**********************************************************************
 	Original calling sequence. This now acts as a hook to the more generally
 	useful function defined immediately below.
@@ -152,6 +159,9 @@ struct cs_Dtcprm_ * EXP_LVL3 CS_dtcsu (	Const struct cs_Csprm_ *src_cs,
 {
 	short srcIsNerth = 0;
 	short dstIsNerth = 0;
+	char trcName [cs_KEYNM_DEF + cs_KEYNM_DEF + 4];
+	struct cs_Dtcprm_ *dtcPtr;
+
 	srcIsNerth = (src_cs->prj_code == cs_PRJCOD_NERTH) || (src_cs->prj_code == cs_PRJCOD_NRTHSRT);
 	dstIsNerth = (dst_cs->prj_code == cs_PRJCOD_NERTH) || (dst_cs->prj_code == cs_PRJCOD_NRTHSRT);
 	if ((srcIsNerth != 0) ^ (dstIsNerth != 0))
@@ -159,7 +169,15 @@ struct cs_Dtcprm_ * EXP_LVL3 CS_dtcsu (	Const struct cs_Csprm_ *src_cs,
 		CS_erpt (cs_NOT_NERTH);
 		return NULL;
 	}
-	return CSdtcsu(&(src_cs->datum),&(dst_cs->datum),dat_erf,blk_erf);
+	trcName [0] = '\0';
+	if (CStraceActive ())
+	{
+		CSdtcsuTraceName (trcName,&(src_cs->datum),&(dst_cs->datum));
+	}
+	CStraceBgn (cs_TRACE_DTCSU,trcName);
+	dtcPtr = CSdtcsu(&(src_cs->datum),&(dst_cs->datum),dat_erf,blk_erf);
+	CStraceEnd (cs_TRACE_DTCSU,trcName,(dtcPtr != NULL) ? 0 : -1);
+	return dtcPtr;
 }
 
 struct cs_Dtcprm_ * EXP_LVL3 CSdtcsu (	Const struct cs_Datum_ *src_dt,
@@ -179,6 +197,7 @@ struct cs_Dtcprm_ * EXP_LVL3 CSdtcsu (	Const struct cs_Datum_ *src_dt,
 	unsigned gxIdxCnt;
 
 	char errMsg [256];
+	char trcName [cs_KEYNM_DEF + cs_KEYNM_DEF + 4];
 
 	Const char* srcDtmName;
 	Const char* trgDtmName;
@@ -297,6 +316,11 @@ struct cs_Dtcprm_ * EXP_LVL3 CSdtcsu (	Const struct cs_Datum_ *src_dt,
 	   
 	   If the bridge is not complete, we have some serious work to do. */
 	bridgeStatus = CSdtmBridgeIsComplete (bridgePtr);
+	trcName [0] = '\0';
+	if (CStraceActive ())
+	{
+		CSdtcsuTraceName (trcName,src_dt,dst_dt);
+	}
 	while (bridgeStatus == cs_DTCBRG_BUILDING)
 	{
 		/* We need to add some transformations to the bridge.  There
@@ -307,7 +331,9 @@ struct cs_Dtcprm_ * EXP_LVL3 CSdtcsu (	Const struct cs_Datum_ *src_dt,
 		   Path dictionary for a path definition which converts from the
 		   source datum to the target datum.  If such is located, we copy
 		   the transformations into the bridge and we're done. */
+		CStraceBgn (cs_TRACE_DTCPH1,trcName);
 		bridgeStatus = CSdtcsuPhaseOne (bridgePtr,dtcPtr);
+		CStraceEnd (cs_TRACE_DTCPH1,trcName,bridgeStatus);
 		if (bridgeStatus == cs_DTCBRG_COMPLETE)
 		{
 			//CS_stncp (dtcPtr->pathName,gpDef.pathName,sizeof (dtcPtr->pathName));
@@ -321,7 +347,9 @@ struct cs_Dtcprm_ * EXP_LVL3 CSdtcsu (	Const struct cs_Datum_ *src_dt,
 			   we look for a transformation which converts directly from
 			   the source datum to the target datum.  If we find one, we
 			   add that transformation to the bridge and we're all done. */
+			CStraceBgn (cs_TRACE_DTCPH2,trcName);
 			bridgeStatus = CSdtcsuPhaseTwo (bridgePtr,dtcPtr);
+			CStraceEnd (cs_TRACE_DTCPH2,trcName,bridgeStatus);
 		}
 		if (bridgeStatus == cs_DTCBRG_BUILDING)
 		{
@@ -331,7 +359,9 @@ struct cs_Dtcprm_ * EXP_LVL3 CSdtcsu (	Const struct cs_Datum_ *src_dt,
 			   datum to the target datum using a pivot datum.  The pivot datum
 			   is typically WGS84.  However, our new phase three will do this
 			   function using an ordered list of pivot datums. */
+			CStraceBgn (cs_TRACE_DTCPH3,trcName);
 			bridgeStatus = CSdtcsuPhaseThree (bridgePtr,dtcPtr);
+			CStraceEnd (cs_TRACE_DTCPH3,trcName,bridgeStatus);
 		}
 		if (bridgeStatus == cs_DTCBRG_BUILDING)
 		{
@@ -358,7 +388,9 @@ struct cs_Dtcprm_ * EXP_LVL3 CSdtcsu (	Const struct cs_Datum_ *src_dt,
 			   return cs_DTCBRG_ERROR if it doesn't modify the bridge in anyway.
 			   This is what will break the 'while' loop in the event of an
 			   impossible path. */
+			CStraceBgn (cs_TRACE_DTCPH4,trcName);
 			bridgeStatus = CSdtcsuPhaseFour (bridgePtr,dtcPtr);
+			CStraceEnd (cs_TRACE_DTCPH4,trcName,bridgeStatus);
 		}
 	}
 
@@ -1174,6 +1206,7 @@ int EXP_LVL3 CSdtcvt (struct cs_Dtcprm_ *dtcPrm,short flag3D,Const double ll_in
 	extern int csErrlng;
 	extern int csErrlat;
 	extern double cs_Zero;
+	extern struct cs_Metrics_ csMetrics;
 
 	short idx;
 	short xfrmCount;
@@ -1194,6 +1227,7 @@ int EXP_LVL3 CSdtcvt (struct cs_Dtcprm_ *dtcPrm,short flag3D,Const double ll_in
 	ll_out [LAT] = ll_in [LAT];
 	ll_out [HGT] = ll_in [HGT];
 	rptCode = 0;
+	csMetrics.dtcvtPnts += 1;
 
 	status = 0;			/* Until we know differently. */
 	if (dtcPrm != NULL && dtcPrm->xfrmCount > 0 &&
@@ -1222,6 +1256,7 @@ int EXP_LVL3 CSdtcvt (struct cs_Dtcprm_ *dtcPrm,short flag3D,Const double ll_in
 			   replaced with dtcTypSkip. */
 			if (methodCode == cs_DTCMTH_SKIP) continue;
 //			if (xfrmPtr->isNullXfrm)continue;
+			csMetrics.xfrmPnts [cs_METRICS_SLOT (methodCode)] += 1;
 
 			/* Call the approriate function.  Convention here is:
 			   functions return  0 for OK,
@@ -1326,6 +1361,7 @@ int EXP_LVL3 CSdtcvt (struct cs_Dtcprm_ *dtcPrm,short flag3D,Const double ll_in
 			/* Here if we had a non-fatal error of some sort. Issue the
 			   appropriate message per the applications instructions.
 			   First, we put the lat/long in the error list. */
+			csMetrics.blkErrPnts += 1;
 			csErrlng = (fabs (ll_in [LNG]) >= 1000.0) ? 999 : (int)ll_in [LNG];
 			csErrlat = (fabs (ll_in [LAT]) >= 1000.0) ? 999 : (int)ll_in [LAT];
 			if (dtcPrm->listCount < 10)
@@ -1348,6 +1384,7 @@ int EXP_LVL3 CSdtcvt (struct cs_Dtcprm_ *dtcPrm,short flag3D,Const double ll_in
 					dtcPrm->errLngLat [dtcPrm->listCount][LNG] = (short)csErrlng;
 					dtcPrm->errLngLat [dtcPrm->listCount][LAT] = (short)csErrlat;
 					dtcPrm->listCount += 1;
+					csMetrics.blkErrNew += 1;
 				}
 			}
 
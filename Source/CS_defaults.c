@@ -75,6 +75,7 @@ char* EXP_LVL3 CS_dtdflt (Const char *dflt_dt)
 	if (*dflt_dt == '\0')
 	{
 		csDtDflt [0] = '\0';
+		CSdtlocRls ();
 		return (previous);
 	}
 
@@ -87,6 +88,7 @@ char* EXP_LVL3 CS_dtdflt (Const char *dflt_dt)
 	}
 	CS_free (dtp);
 	CS_stncp (csDtDflt,dflt_dt,cs_KEYNM_DEF);
+	CSdtlocRls ();
 	return (previous);
 }
 
@@ -106,6 +108,7 @@ char* EXP_LVL3 CS_eldflt (Const char *dflt_el)
 	if (*dflt_el == '\0')
 	{
 		csElDflt [0] = '\0';
+		CSdtlocRls ();
 		return (previous);
 	}
 	elp = CS_eldef (dflt_el);
@@ -115,6 +118,7 @@ char* EXP_LVL3 CS_eldflt (Const char *dflt_el)
 	}
 	CS_free (elp);
 	CS_stncp (csElDflt,dflt_el,cs_KEYNM_DEF);
+	CSdtlocRls ();
 	return (previous);
 }
 
@@ -178,3 +178,98 @@ int EXP_LVL5 CS_xyzToLlh (double llh [3],Const double xyz [3],double e_rad,doubl
 	   zero.  Much of the rest of this module relies on this behavior. */
 	return status;
 }
+
+/******************************************************************************
+	CS_llhNormal (nrm [3],llh [3]);
+
+	double nrm [3];				the unit vector normal to the ellipsoid at the
+								given point is returned here, in the geocentric
+								frame.
+	double llh [3];				the longitude and latitude of the point, in
+								degrees.  The height element is ignored.
+
+	The normal depends only upon the geodetic latitude and longitude, thus
+	the ellipsoid need not be specified.  All points having the same geodetic
+	latitude and longitude lie on the line through the point on the
+	ellipsoid in this direction.
+*/
+void EXP_LVL5 CS_llhNormal (double nrm [3],Const double llh [3])
+{
+	extern double cs_Degree;			/* 0.017.... */
+
+	double lng, lat;
+	double cos_lat;
+
+	lng = llh [LNG] * cs_Degree;
+	lat = llh [LAT] * cs_Degree;
+	cos_lat = cos (lat);
+	nrm [XX] = cos_lat * cos (lng);
+	nrm [YY] = cos_lat * sin (lng);
+	nrm [ZZ] = sin (lat);
+
+	return;
+}
+
+/******************************************************************************
+	status = CS_xyzLineToLlh (llh [3],xyz [3],dir [3],e_rad,e_sq);
+
+	double llh [3];				the longitude, latitude, and ellipsoid height
+								of the point at which the line pierces the
+								ellipsoid are returned here.  The height will
+								be zero to within the precision of the
+								arithmetic.
+	double xyz [3];				a point on the line, in geocentric coordinates.
+	double dir [3];				the direction of the line, in geocentric
+								coordinates.  Need not be a unit vector.
+	double e_rad;				equatorial radius of the ellipsoid/shpere.
+	double e_sq;				eccentricity squared of the ellipsoid.  Use
+								zero for a sphere.
+	int status;					returns zero on success, -1 if the line does
+								not intersect the ellipsoid, or if CS_xyzToLlh
+								fails.
+
+	Of the two intersections, the one nearest xyz is chosen.  Used by the
+	two dimensional inverses of the geocentric transformations.  The forward
+	of these is affine in geocentric space, so the line of points sharing the
+	target latitude and longitude (i.e. the normal to the target ellipsoid)
+	maps back to a line in the source system, and where that line pierces the
+	source ellipsoid is the exact inverse.
+*/
+int EXP_LVL5 CS_xyzLineToLlh (double llh [3],Const double xyz [3],Const double dir [3],double e_rad,double e_sq)
+{
+	extern double cs_Zero;				/* 0.0 */
+	extern double cs_One;				/* 1.0 */
+
+	double zWeight;
+	double aa, bb, cc;
+	double disc;
+	double tt;
+	double pnt [3];
+
+	/* With zWeight = 1 / (1 - e_sq), the ellipsoid is:
+			x*x + y*y + z*z*zWeight = e_rad*e_rad
+	   Substituting the line yields aa*tt*tt + 2*bb*tt + cc = 0. */
+	zWeight = cs_One / (cs_One - e_sq);
+	aa = dir [XX] * dir [XX] + dir [YY] * dir [YY] + dir [ZZ] * dir [ZZ] * zWeight;
+	bb = xyz [XX] * dir [XX] + xyz [YY] * dir [YY] + xyz [ZZ] * dir [ZZ] * zWeight;
+	cc = xyz [XX] * xyz [XX] + xyz [YY] * xyz [YY] + xyz [ZZ] * xyz [ZZ] * zWeight - e_rad * e_rad;
+	disc = bb * bb - aa * cc;
+	if (aa <= cs_Zero || disc < cs_Zero)
+	{
+		return -1;
+	}
+
+	/* The root of smaller magnitude, in a form which avoids cancellation. */
+	disc = sqrt (disc);
+	if (bb < cs_Zero) disc = -disc;
+	if ((bb + disc) == cs_Zero)
+	{
+		return -1;
+	}
+	tt = -cc / (bb + disc);
+
+	pnt [XX] = xyz [XX] + tt * dir [XX];
+	pnt [YY] = xyz [YY] + tt * dir [YY];
+	pnt [ZZ] = xyz [ZZ] + tt * dir [ZZ];
+	return CS_xyzToLlh (llh,pnt,e_rad,e_sq);
+}
@@ -119,6 +119,7 @@ int EXP_LVL5 CS_dtdel (struct cs_Dtdef_ *dtdef)
 
 		CS_free (cs_DtKeyNames);
 		cs_DtKeyNames = NULL;
+		CSdtlocRls ();
 	}
 
 	return result;
@@ -153,6 +154,9 @@ int EXP_LVL5 CS_dtupd (struct cs_Dtdef_ *dtdef,int crypt)
 	if (updateStatus < 0)
 		return updateStatus;
 
+	/* Any datum located under this name is now stale. */
+	CSdtlocRls ();
+
 	/*	cs_DtKeyNames is a memory array which contains all of the existing
 		datum key names.  Since we're going to change this, we free up the
 		in memory list to force a regeneration of same next time its use is
@@ -250,9 +254,12 @@ struct cs_Dtdef_ * EXP_LVL5 CS_dtdef2 (Const char *dat_nam, char* pszDirPath)
 	extern double cs_RotMax;		/* 15.0    */
 	extern double cs_SclMax;		/* 200.0   */
 
+	extern struct cs_Metrics_ csMetrics;
+
 	struct cs_Dtdef_* dtptr = NULL;
 	int isUsrDef = FALSE;
 
+	csMetrics.dtdefCount += 1;
 	dtptr = CS_dtDefinition(dat_nam, pszDirPath, &isUsrDef);
 	if (NULL == dtptr || TRUE == isUsrDef)
 		return dtptr;
@@ -317,6 +324,7 @@ void EXP_LVL1 CS_dtfnm (Const char *new_name)
 	extern char cs_Dtname [];
 
 	(void)CS_stncp (cs_Dtname,new_name,cs_FNM_MAXLEN);
+	CSdtlocRls ();
 	return;
 }
 
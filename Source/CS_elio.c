@@ -116,6 +116,7 @@ int EXP_LVL5 CS_eldel (struct cs_Eldef_ *eldef)
 		successfully. */
 	CS_free(cs_ElKeyNames);
 	cs_ElKeyNames = NULL;
+	CSdtlocRls ();
 
 	return deletionStatus;
 }
@@ -208,6 +209,9 @@ int EXP_LVL5 CS_elupd (struct cs_Eldef_ *eldef,int crypt)
 	if (updateStatus < 0)
 		return updateStatus;
 
+	/* Datums which reference this ellipsoid are now stale. */
+	CSdtlocRls ();
+
 	if (0 == updateStatus)
 	{
 		CS_free(cs_ElKeyNames);
@@ -325,6 +329,7 @@ struct cs_Eldef_ * EXP_LVL5 CS_eldef2 (Const char *el_nam, char* pszDirPath)
 	extern double cs_PRadMin;		/*  0.75 */
 	extern double cs_PRadMax;		/* 100 million */
 	extern double cs_EccentMax;		/* 0.2 */
+	extern struct cs_Metrics_ csMetrics;
 
 	double my_ecent;
 	double my_flat;
@@ -332,6 +337,7 @@ struct cs_Eldef_ * EXP_LVL5 CS_eldef2 (Const char *el_nam, char* pszDirPath)
 	struct cs_Eldef_* el_ptr = NULL;
 	int isUsrDef = FALSE;
 
+	csMetrics.eldefCount += 1;
 	el_ptr = CS_elDefinition(el_nam, pszDirPath, &isUsrDef);
 	if (NULL == el_ptr || TRUE == isUsrDef)
 		return el_ptr;
@@ -403,6 +409,7 @@ void EXP_LVL1 CS_elfnm (Const char *new_name)
 	extern char cs_Elname [];
 
 	(void)CS_stncp (cs_Elname,new_name,cs_FNM_MAXLEN);
+	CSdtlocRls ();
 	return;
 }
 
@@ -38,15 +38,21 @@
 void EXP_LVL3 CS_erpt (int err_num)
 
 {
+	extern int cs_ErrMode;
 	extern char csErrmsg [cs_ERRMSG_SIZE];
-
-//    return;
-
 #ifdef PRINTF
 	extern unsigned short cs_ErrSup;
 
 	short sup_bm;
+#endif
+
+//    return;
+
+	/* Set cs_Error, count the error, and unless we're in the counters only
+	   mode, record it in the recent error ring. */
+	CSerptRecord (err_num);
 
+#ifdef PRINTF
 	sup_bm = CSerpt (csErrmsg,sizeof (csErrmsg),err_num);
 
 	if ((sup_bm & cs_ErrSup) == 0)
@@ -54,7 +60,12 @@ void EXP_LVL3 CS_erpt (int err_num)
 		fprintf (stderr,"%s\n",csErrmsg);
 	}
 #else
-	CSerpt (csErrmsg,sizeof (csErrmsg),err_num);		/*lint !e534 */
+	/* Message text is only produced now in the default mode; otherwise
+	   CS_errmsg produces it on demand. */
+	if (cs_ErrMode == cs_ERRMODE_FORMAT)
+	{
+		CSerpt (csErrmsg,sizeof (csErrmsg),err_num);	/*lint !e534 */
+	}
 #endif
 
 	/* Return to the calling module for cleanup. */
@@ -27,6 +27,9 @@
 
 #include "cs_map.h"
 
+static unsigned short CSerptMsg (char *mesg,int size,int err_num,Const char *errNam,int errLng,int errLat);
+static void CSerptFlush (void);
+
 /**********************************************************************
 	The following function is used to return a text string which
 	describes thelast error condition encounered.
@@ -35,7 +38,14 @@
 void EXP_LVL1 CS_errmsg (char *user_bufr,int bfr_size)
 {
 	extern char csErrmsg [256];
-	
+	extern struct csErrRing_ csErrRing;
+
+	/* In the lazy mode, the text of the most recent message may not have
+	   been produced yet. */
+	if (csErrRing.pending)
+	{
+		CSerptFlush ();
+	}
 	strncpy (user_bufr,csErrmsg,(unsigned)bfr_size);
 	user_bufr [bfr_size - 1] = '\0';
 	return;
@@ -850,6 +860,22 @@ unsigned short EXP_LVL7 CSerpt (char *mesg,int size,int err_num)
 	extern ulong32_t cs_Doserr;
 #endif
 
+#if _RUN_TIME < _rt_UNIXPCC
+	cs_Errno = errno;
+	cs_Doserr = _doserrno;
+#else
+	cs_Errno = errno;
+#endif
+	cs_Error = err_num;
+
+	return CSerptMsg (mesg,size,err_num,csErrnam,csErrlng,csErrlat);
+}
+
+/* Formats the message for the indicated error, using the provided inserts
+   rather than the current values of the related globals.  Returns the
+   suppression group of the error. */
+static unsigned short CSerptMsg (char *mesg,int size,int err_num,Const char *errNam,int errLng,int errLat)
+{
 	char dir_cc;
 
 	long32_t ltemp;
@@ -860,14 +886,6 @@ unsigned short EXP_LVL7 CSerpt (char *mesg,int size,int err_num)
 	char ctemp [32];
 	char insert [32];
 
-#if _RUN_TIME < _rt_UNIXPCC
-	cs_Errno = errno;
-	cs_Doserr = _doserrno;
-#else
-	cs_Errno = errno;
-#endif
-	cs_Error = err_num;
-
 	/* Locate the appropriate message. */
 
 	for (err_ptr = csErrtab;err_ptr->code != 0;err_ptr++)
@@ -877,18 +895,18 @@ unsigned short EXP_LVL7 CSerpt (char *mesg,int size,int err_num)
 			switch (err_ptr->type) {
 
 			case csET_NM:
-				CSsprntf (mesg,size,err_ptr->msg,csErrnam);
+				CSsprntf (mesg,size,err_ptr->msg,(char *)errNam);
 				break;
 
 			case csET_LOC:
 				/* Build a string which defines the
 				   location.  We desire to do this
 				   re-entrantly. */
-				ltemp = (long32_t)csErrlng;
+				ltemp = (long32_t)errLng;
 				dir_cc = 'E';
-				if (csErrlng < 0)
+				if (errLng < 0)
 				{
-					ltemp = (long32_t)(-csErrlng);
+					ltemp = (long32_t)(-errLng);
 					dir_cc = 'W';
 				}
 				CSreltoa (ctemp,sizeof (ctemp),ltemp);
@@ -896,11 +914,11 @@ unsigned short EXP_LVL7 CSerpt (char *mesg,int size,int err_num)
 				*cp++ = dir_cc;
 				*cp++ = ':';
 				
-				ltemp = (long32_t)csErrlat;
+				ltemp = (long32_t)errLat;
 				dir_cc = 'N';
-				if (csErrlat < 0)
+				if (errLat < 0)
 				{
-					ltemp = (long32_t)(-csErrlat);
+					ltemp = (long32_t)(-errLat);
 					dir_cc = 'S';
 				}
 				CSreltoa (ctemp,sizeof (ctemp),ltemp);
@@ -933,6 +951,187 @@ unsigned short EXP_LVL7 CSerpt (char *mesg,int size,int err_num)
 	return (err_ptr->sup_grp);
 }
 
+/**********************************************************************
+**	CSerptRecord (err_num);
+**
+**	int err_num;				number of the error condition being
+**								reported.
+**
+**	Does the part of error reporting which is cheap: sets cs_Error and
+**	cs_Errno, counts the error, and (except in the counters only mode)
+**	records the error code and its inserts in the recent error ring.
+**	The message text is produced later, and only if it is asked for.
+**********************************************************************/
+void EXP_LVL7 CSerptRecord (int err_num)
+{
+	extern char csErrnam [];
+	extern int csErrlng;
+	extern int csErrlat;
+	extern int cs_Error;
+	extern int cs_Errno;
+	extern int cs_ErrMode;
+	extern struct csErrRing_ csErrRing;
+	extern ulong32_t csErrCount [];
+#if _RUN_TIME < _rt_UNIXPCC
+	extern ulong32_t cs_Doserr;
+#endif
+
+	struct csErrRec_ *recPtr;
+
+#if _RUN_TIME < _rt_UNIXPCC
+	cs_Errno = errno;
+	cs_Doserr = _doserrno;
+#else
+	cs_Errno = errno;
+#endif
+	cs_Error = err_num;
+
+	if (err_num >= 0 && err_num <= cs_ERROR_MAX) csErrCount [err_num] += 1UL;
+	else csErrCount [cs_ERROR_MAX + 1] += 1UL;
+
+	if (cs_ErrMode != cs_ERRMODE_COUNT)
+	{
+		recPtr = &csErrRing.recs [csErrRing.count % cs_ERRRING_SIZE];
+		recPtr->errNum = err_num;
+		recPtr->errNo = cs_Errno;
+		recPtr->errLng = csErrlng;
+		recPtr->errLat = csErrlat;
+		CS_stncp (recPtr->errNam,csErrnam,sizeof (recPtr->errNam));
+		csErrRing.count += 1UL;
+		csErrRing.pending = (cs_ErrMode == cs_ERRMODE_LAZY);
+	}
+	return;
+}
+
+/* Produces the text of the most recently recorded error in csErrmsg. */
+static void CSerptFlush (void)
+{
+	extern char csErrmsg [];
+	extern struct csErrRing_ csErrRing;
+
+	struct csErrRec_ *recPtr;
+
+	csErrRing.pending = FALSE;
+	if (csErrRing.count > 0UL)
+	{
+		recPtr = &csErrRing.recs [(csErrRing.count - 1UL) % cs_ERRRING_SIZE];
+		CSerptMsg (csErrmsg,cs_ERRMSG_SIZE,recPtr->errNum,recPtr->errNam,recPtr->errLng,recPtr->errLat);	/*lint !e534 */
+	}
+	return;
+}
+
+/**********************************************************************
+**	prvMode = CS_errorMode (mode);
+**
+**	int mode;					one of the cs_ERRMODE_XXX values; a
+**								negative value simply returns the
+**								current mode.
+**	int prvMode;				returns the mode in effect prior to
+**								this call.
+**
+**	Selects the manner in which CS_erpt reports errors, see cs_map.h.
+**********************************************************************/
+int EXP_LVL1 CS_errorMode (int mode)
+{
+	extern int cs_ErrMode;
+	extern struct csErrRing_ csErrRing;
+
+	int prvMode;
+
+	prvMode = cs_ErrMode;
+	if (mode == cs_ERRMODE_FORMAT || mode == cs_ERRMODE_LAZY || mode == cs_ERRMODE_COUNT)
+	{
+		/* Leaving the lazy mode; make sure csErrmsg is current for those
+		   who access it directly. */
+		if (csErrRing.pending && mode != cs_ERRMODE_LAZY)
+		{
+			CSerptFlush ();
+		}
+		cs_ErrMode = mode;
+	}
+	return prvMode;
+}
+
+/**********************************************************************
+**	found = CS_errorRecent (index,&err_num,mesg,size);
+**
+**	int index;					zero for the most recent error, one for the
+**								one before that, etc.
+**	int *err_num;				the code of the indexed error is returned
+**								here.
+**	char *mesg;					the text of the message is returned here;
+**								may be NULL.
+**	int size;					size of the mesg array.
+**	int found;					returns TRUE if the indicated error is
+**								still in the ring, else FALSE.
+**
+**	The last cs_ERRRING_SIZE errors reported by CS_erpt, other than
+**	those reported in the counters only mode, are available.
+**********************************************************************/
+int EXP_LVL1 CS_errorRecent (int index,int *err_num,char *mesg,int size)
+{
+	extern struct csErrRing_ csErrRing;
+
+	struct csErrRec_ *recPtr;
+
+	*err_num = 0;
+	if (mesg != NULL && size > 0) *mesg = '\0';
+	if (index < 0 || index >= cs_ERRRING_SIZE || (ulong32_t)index >= csErrRing.count)
+	{
+		return FALSE;
+	}
+	recPtr = &csErrRing.recs [(csErrRing.count - 1UL - (ulong32_t)index) % cs_ERRRING_SIZE];
+	*err_num = recPtr->errNum;
+	if (mesg != NULL && size > 0)
+	{
+		CSerptMsg (mesg,size,recPtr->errNum,recPtr->errNam,recPtr->errLng,recPtr->errLat);	/*lint !e534 */
+	}
+	return TRUE;
+}
+
+/**********************************************************************
+**	count = CS_errorCount (err_num);
+**
+**	int err_num;				the error code whose count is desired;
+**								zero returns the count of all errors.
+**	ulong32_t count;			the number of times the indicated error
+**								has been reported by CS_erpt.
+**
+**	CS_errorCountReset sets all of the counters back to zero.
+**********************************************************************/
+ulong32_t EXP_LVL1 CS_errorCount (int err_num)
+{
+	extern ulong32_t csErrCount [];
+
+	int idx;
+	ulong32_t count;
+
+	if (err_num == 0)
+	{
+		count = 0UL;
+		for (idx = 0;idx <= cs_ERROR_MAX + 1;idx += 1)
+		{
+			count += csErrCount [idx];
+		}
+	}
+	else if (err_num > 0 && err_num <= cs_ERROR_MAX)
+	{
+		count = csErrCount [err_num];
+	}
+	else
+	{
+		count = csErrCount [cs_ERROR_MAX + 1];
+	}
+	return count;
+}
+void EXP_LVL1 CS_errorCountReset (void)
+{
+	extern ulong32_t csErrCount [];
+
+	memset (csErrCount,'\0',(cs_ERROR_MAX + 2) * sizeof (ulong32_t));
+	return;
+}
+
 /*
 	A reentrant means of doing ltoa.  It will not exceed
 	the size of the provided destination array.
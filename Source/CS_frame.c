@@ -216,17 +216,49 @@ int EXP_LVL9 CSframeI3 (struct csFrame_ *frame,double* trgLl,Const double* srcLl
 	return status;
 }
 
+/* Applies the exact inverse of the linear portion (rotation and scale) of
+   the forward transformation to a geocentric vector. */
+static void CSframeLinInv (Const struct csFrame_ *frame,double rslt [3],Const double vec [3])
+{
+	extern double cs_One;				/* 1.0 */
+
+	double uu [3];
+	double dot;
+	double denom;
+
+	/* The rotation matrix is I - W, where W * vec is the cross product of
+	   the rotation vector with vec.  Since W is skew symmetric,
+	   inverse (I - W) = (I + W + r * rT) / (1 + |r| ** 2); i.e. the
+	   transpose is only an approximation of the inverse. */
+	uu [XX] = vec [XX] / frame->scale;
+	uu [YY] = vec [YY] / frame->scale;
+	uu [ZZ] = vec [ZZ] / frame->scale;
+	dot = frame->rotX * uu [XX] + frame->rotY * uu [YY] + frame->rotZ * uu [ZZ];
+	denom = cs_One + frame->rotX * frame->rotX + frame->rotY * frame->rotY + frame->rotZ * frame->rotZ;
+	rslt [XX] = (uu [XX] + (frame->rotY * uu [ZZ] - frame->rotZ * uu [YY]) + frame->rotX * dot) / denom;
+	rslt [YY] = (uu [YY] + (frame->rotZ * uu [XX] - frame->rotX * uu [ZZ]) + frame->rotY * dot) / denom;
+	rslt [ZZ] = (uu [ZZ] + (frame->rotX * uu [YY] - frame->rotY * uu [XX]) + frame->rotZ * dot) / denom;
+	return;
+}
+
 /******************************************************************************
-	This is an iterative exercise of CS_bw2dFowrd.  Thus, this calculation
-	will produce a rather precise inverse of geographic coordinates.  Used in
-	the two dimensional case as we don't know what the ellipsoid elevation is.
-	Thus, we can't precisely compute the inverse of a coordinate we might
-	have computed the forward for, and the using application threw away the
-	Z.  The end result of all this can be positional creep unless we do
-	as coded below.
+	This is a precise inverse of CSframeF2, used in the two dimensional case as
+	we don't know what the ellipsoid elevation is.  Thus, we can't simply use
+	the three dimensional inverse on a coordinate we might have computed the
+	forward for, and the using application threw away the Z.  The end result
+	of that would be positional creep.
+
+	The forward is affine in geocentric space.  The points sharing the
+	target latitude and longitude lie on the normal to the target ellipsoid,
+	which maps back to a line in the source system.  Where that line
+	pierces the source ellipsoid is the exact inverse, at about the cost of
+	a single forward.  The iterative exercise of CSframeF2 which follows is
+	only a fallback.
 */
 int EXP_LVL9 CSframeI2 (struct csFrame_ *frame,double* trgLl,Const double* srcLl)
 {
+	extern double cs_Zero;				/* 0.0 */
+
 	int ii;
 	int lngOk;
 	int latOk;
@@ -235,6 +267,10 @@ int EXP_LVL9 CSframeI2 (struct csFrame_ *frame,double* trgLl,Const double* srcLl
 	double guess [3];
 	double newLl [3];
 	double epsilon [3];
+	double xyz [3];
+	double nrm [3];
+	double pnt [3];
+	double dir [3];
 
 	/* Assume everything goes OK until we know different. */
 	rtnVal = 0;
@@ -248,9 +284,23 @@ int EXP_LVL9 CSframeI2 (struct csFrame_ *frame,double* trgLl,Const double* srcLl
 	trgLl [LAT] = guess [LAT] = srcLl [LAT];
 	trgLl [HGT] = srcLl [HGT];
 
-	/* To improve performancce, we could use CS_bw3dInvrs here to
-	   get our guess.  That function will probably reduce the
-	   number of iterations require below substantially. */
+	/* The closed form solution, see above. */
+	guess [HGT] = cs_Zero;
+	CS_llhToXyz (xyz,guess,frame->trgERad,frame->trgESqr);
+	CS_llhNormal (nrm,guess);
+	xyz [XX] -= frame->deltaX;
+	xyz [YY] -= frame->deltaY;
+	xyz [ZZ] -= frame->deltaZ;
+	CSframeLinInv (frame,pnt,xyz);
+	CSframeLinInv (frame,dir,nrm);
+	rtnVal = CS_xyzLineToLlh (newLl,pnt,dir,frame->srcERad,frame->srcESqr);
+	if (rtnVal == 0)
+	{
+		trgLl [LNG] = newLl [LNG];
+		trgLl [LAT] = newLl [LAT];
+		return rtnVal;
+	}
+	rtnVal = 0;
 
 	/* Start a loop which will iterate as many as maxIteration times. */
 	for (ii = 0;ii < frame->maxIterations;ii++)
@@ -293,6 +343,7 @@ int EXP_LVL9 CSframeI2 (struct csFrame_ *frame,double* trgLl,Const double* srcLl
 
 	/* If we didn't resolve in maxIteration tries, we issue a warning
 	   message.  Usually, three or four iterations does the trick. */
+	CSmetricsItr (ii,frame->maxIterations);
 	if (ii >= frame->maxIterations )
 	{
 		CS_erpt (cs_BW_CNVRG);
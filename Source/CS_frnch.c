@@ -836,6 +836,7 @@ int CScalcNtfToRgf (struct cs_Frnch_* thisPtr,double* llRgf,Const double* llNtf)
 	{
 		/* If we didn't resolve in maxIteration tries, we issue a warning
 		   message.  Usually, three or four iterations does the trick. */
+		CSmetricsItr (ii,thisPtr->maxIterations);
 		if (ii >= thisPtr->maxIterations)
 		{
 			rtnVal = csGRIDI_ST_COVERAGE;
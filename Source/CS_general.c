@@ -143,6 +143,7 @@ int EXP_LVL1 CS_altdr (Const char *alt_dir)
 		   we use it. */
 
 		cs_DirP = CS_stcpy (cs_Dir,ctemp);
+		CSdtlocRls ();
 		flag = TRUE;
 	}
 	return (flag ? 0 : -1);
@@ -204,6 +205,8 @@ exit:
 	//now that a new directory has been setup, we've to cleanup all of our internal "definition" caches
 	CS_free(cs_CsKeyNames);
 	cs_CsKeyNames = NULL;
+	CScsRangeIdxRls ();
+	CSdtlocRls ();
 	CS_free(cs_DtKeyNames);
 	cs_DtKeyNames = NULL;
 	CS_free(cs_ElKeyNames);
@@ -396,6 +396,7 @@ int CSgeocnI2 (struct cs_Geocn_ *geocn,double *ll_trg,Const double *ll_src)
 	
 		   If we didn't resolve in maxIteration tries, we issue a warning
 		   message. */
+		CSmetricsItr (ii,geocn->maxIterations);
 		if (ii >= geocn->maxIterations)
 		{
 			status = csGRIDI_ST_COVERAGE;
@@ -588,7 +589,9 @@ struct cs_GeoconFile_* CSnewGeoconFile (Const char* filePath,long32_t bufferSize
 	thisPtr->type = fileType;
 
 	/* Get the file information header. */
+	CStraceBgn (cs_TRACE_GRIDOPEN,thisPtr->filePath);
 	fstr = CS_fopen (thisPtr->filePath,_STRM_BINRD);
+	CStraceEnd (cs_TRACE_GRIDOPEN,thisPtr->filePath,(fstr != NULL) ? 0 : -1);
 	if (fstr == NULL)
 	{
 		CS_stncp (csErrnam,thisPtr->filePath,MAXPATH);
@@ -1653,6 +1656,7 @@ int CSextractGeoconGridFile (struct csGeocnGridCell_ *cellPtr,struct cs_GeoconFi
 int CSreadGeoconGridFile (struct cs_GeoconFile_* thisPtr,long32_t recNbr)
 {
 	extern char csErrnam [MAXPATH];
+	extern struct cs_Metrics_ csMetrics;
 
 	int status;
 	size_t readCount;
@@ -1718,13 +1722,17 @@ int CSreadGeoconGridFile (struct cs_GeoconFile_* thisPtr,long32_t recNbr)
 
 	/* See if the stuff we need is in the buffer.  Careful here, all of the
 	   intended range must be in the buffer, not just a portion of it. */
+	csMetrics.gridLookups += 1;
 	if (fposBegin < thisPtr->bufferBeginPosition || fposBegin > thisPtr->bufferEndPosition ||
 		fposEnd   < thisPtr->bufferBeginPosition || fposEnd   > thisPtr->bufferEndPosition)
 	{
 		/* The data we need is not there; we need to read it in.  Is the file open? */
+		csMetrics.gridMisses += 1;
 		if (thisPtr->strm == NULL)
 		{
+			CStraceBgn (cs_TRACE_GRIDOPEN,thisPtr->filePath);
 			thisPtr->strm = CS_fopen (thisPtr->filePath,_STRM_BINRD);
+			CStraceEnd (cs_TRACE_GRIDOPEN,thisPtr->filePath,(thisPtr->strm != NULL) ? 0 : -1);
 			if (thisPtr->strm == NULL)
 			{
 				CS_stncp (csErrnam,thisPtr->filePath,MAXPATH);
@@ -1815,7 +1823,11 @@ int CSreadGeoconGridFile (struct cs_GeoconFile_* thisPtr,long32_t recNbr)
 			CS_erpt (cs_IOERR);
 			goto error;
 		}
+		CStraceBgn (cs_TRACE_GRIDREAD,thisPtr->filePath);
 		checkCount = (size_t)CS_fread (thisPtr->dataBuffer,1,(size_t)readCount,thisPtr->strm);
+		CStraceEnd (cs_TRACE_GRIDREAD,thisPtr->filePath,(checkCount == readCount) ? 0 : -1);
+		csMetrics.gridReads += 1;
+		csMetrics.gridBytes += checkCount;
 		if (checkCount != readCount)
 		{
 			CS_stncp (csErrnam,thisPtr->filePath,MAXPATH);
@@ -227,6 +227,7 @@ int EXP_LVL9 CSgeoctI2 (struct csGeoct_ *geoct,double* trgLl,Const double* srcLl
 
 	/* If we didn't resolve in maxIteration tries, we issue a warning
 	   message.  Usually, three or four iterations does the trick. */
+	CSmetricsItr (ii,geoct->maxIterations);
 	if (ii >= geoct->maxIterations )
 	{
 		CS_erpt (cs_GEOCT_CNVRG);
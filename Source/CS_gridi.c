@@ -342,6 +342,7 @@ French technique is indeed 3 dimensional.  So our design here supports both
 int EXP_LVL9 CSgridiF3 (struct csGridi_ *gridi,double trgLl [3],Const double srcLl [3])
 {
 	extern char csErrnam [MAXPATH];
+	extern struct cs_Metrics_ csMetrics;
 
 	int status;
 	int fbStatus;
@@ -415,6 +416,8 @@ int EXP_LVL9 CSgridiF3 (struct csGridi_ *gridi,double trgLl [3],Const double src
 				fbStatus = 1;
 			}
 			status = (fbStatus == 0) ? 2 : 1;
+			if (fbStatus == 0) csMetrics.fallbackOk += 1;
+			else			   csMetrics.fallbackFail += 1;
 		}
 		else
 		{
@@ -428,6 +431,7 @@ int EXP_LVL9 CSgridiF3 (struct csGridi_ *gridi,double trgLl [3],Const double src
 int EXP_LVL9 CSgridiF2 (struct csGridi_ *gridi,double* trgLl,Const double* srcLl)
 {
 	extern char csErrnam [MAXPATH];
+	extern struct cs_Metrics_ csMetrics;
 
 	int status;
 	int fbStatus;
@@ -487,6 +491,8 @@ int EXP_LVL9 CSgridiF2 (struct csGridi_ *gridi,double* trgLl,Const double* srcLl
 				fbStatus = 1;
 			}
 			status = (fbStatus == 0) ? 2 : 1;
+			if (fbStatus == 0) csMetrics.fallbackOk += 1;
+			else			   csMetrics.fallbackFail += 1;
 		}
 		else
 		{
@@ -500,6 +506,7 @@ int EXP_LVL9 CSgridiF2 (struct csGridi_ *gridi,double* trgLl,Const double* srcLl
 int EXP_LVL9 CSgridiI3 (struct csGridi_ *gridi,double* trgLl,Const double* srcLl)
 {
 	extern char csErrnam [MAXPATH];
+	extern struct cs_Metrics_ csMetrics;
 
 	int status;
 	int fbStatus;
@@ -572,6 +579,8 @@ int EXP_LVL9 CSgridiI3 (struct csGridi_ *gridi,double* trgLl,Const double* srcLl
 				fbStatus = 1;
 			}
 			status = (fbStatus == 0) ? 2 : 1;
+			if (fbStatus == 0) csMetrics.fallbackOk += 1;
+			else			   csMetrics.fallbackFail += 1;
 		}
 		else
 		{
@@ -585,6 +594,7 @@ int EXP_LVL9 CSgridiI3 (struct csGridi_ *gridi,double* trgLl,Const double* srcLl
 int EXP_LVL9 CSgridiI2 (struct csGridi_ *gridi,double* trgLl,Const double* srcLl)
 {
 	extern char csErrnam [MAXPATH];
+	extern struct cs_Metrics_ csMetrics;
 
 	int status;
 	int fbStatus;
@@ -644,6 +654,8 @@ int EXP_LVL9 CSgridiI2 (struct csGridi_ *gridi,double* trgLl,Const double* srcLl
 				fbStatus = 1;
 			}
 			status = (fbStatus == 0) ? 2 : 1;
+			if (fbStatus == 0) csMetrics.fallbackOk += 1;
+			else			   csMetrics.fallbackFail += 1;
 		}
 		else
 		{
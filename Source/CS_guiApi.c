@@ -30,6 +30,92 @@
 
 extern int (*CS_usrCsDefPtr)(struct cs_Csdef_ *ptr,Const char *keyName);
 
+/* The name lists maintained by this module (e.g. cs_CsKeyNames) are
+   sequences of null terminated names, terminated by an additional null
+   character.  To make enumeration by index a constant time operation,
+   we maintain a table of pointers to the individual names of each list.
+   csNameListSerial is bumped every time any of the lists is (re)built,
+   and a table is rebuilt whenever its serial number, or list pointer,
+   does not match.  Thus, the code which frees the lists need not know
+   about these tables. */
+struct csNameIdx_
+{
+	Const char *list;			/* list the table was built for */
+	ulong32_t serial;			/* csNameListSerial at that time */
+	int count;					/* number of names in the list */
+	int alloc;					/* allocated size of names, in entries */
+	Const char **names;			/* pointer to each name; names [count]
+								   points to the terminating null */
+};
+static ulong32_t csNameListSerial = 1UL;
+static struct csNameIdx_ csCsNameIdx = { NULL, 0UL, 0, 0, NULL };
+static struct csNameIdx_ csDtNameIdx = { NULL, 0UL, 0, 0, NULL };
+static struct csNameIdx_ csElNameIdx = { NULL, 0UL, 0, 0, NULL };
+static struct csNameIdx_ csLlNameIdx = { NULL, 0UL, 0, 0, NULL };
+
+/* Returns a pointer to the index'th name in the list, or to the null string
+   which terminates the list if there is no such entry.  Returns NULL only
+   in the case of a memory allocation failure. */
+static Const char *CSnameIdxGet (struct csNameIdx_ *nmIdx,Const char *list,int index)
+{
+	int count;
+	Const char *cp;
+	Const char **tmpPtr;
+
+	if (nmIdx->list != list || nmIdx->serial != csNameListSerial)
+	{
+		nmIdx->list = NULL;
+		count = 0;
+		for (cp = list;*cp != '\0';cp += strlen (cp) + 1)
+		{
+			count += 1;
+		}
+		if (count >= nmIdx->alloc)
+		{
+			tmpPtr = (Const char **)CS_ralc ((void *)nmIdx->names,(size_t)(count + 1) * sizeof (char *));
+			if (tmpPtr == NULL)
+			{
+				CS_erpt (cs_NO_MEM);
+				return NULL;
+			}
+			nmIdx->names = tmpPtr;
+			nmIdx->alloc = count + 1;
+		}
+		count = 0;
+		for (cp = list;*cp != '\0';cp += strlen (cp) + 1)
+		{
+			nmIdx->names [count++] = cp;
+		}
+		nmIdx->names [count] = cp;
+		nmIdx->count = count;
+		nmIdx->list = list;
+		nmIdx->serial = csNameListSerial;
+	}
+	return (index < nmIdx->count) ? nmIdx->names [index] : nmIdx->names [nmIdx->count];
+}
+
+/* Releases the name list pointer tables; called by CS_recvr. */
+void EXP_LVL9 CSrlsNameIdx (void)
+{
+	struct csNameIdx_ *nmIdx;
+	struct csNameIdx_ *nmIdxs [4];
+	int ii;
+
+	nmIdxs [0] = &csCsNameIdx;
+	nmIdxs [1] = &csDtNameIdx;
+	nmIdxs [2] = &csElNameIdx;
+	nmIdxs [3] = &csLlNameIdx;
+	for (ii = 0;ii < 4;ii += 1)
+	{
+		nmIdx = nmIdxs [ii];
+		if (nmIdx->names != NULL) CS_free ((void *)nmIdx->names);
+		nmIdx->names = NULL;
+		nmIdx->list = NULL;
+		nmIdx->count = 0;
+		nmIdx->alloc = 0;
+	}
+}
+
 int EXP_LVL2 CS_getcs (Const char *cs_name,struct cs_Csdef_ *bufr)
 {
 	extern int cs_Error;
@@ -182,9 +268,8 @@ int EXP_LVL1 CS_csEnum (int index,char *key_name,int size)
 {
 	extern int cs_Error;
 
-	cs_Register char *cp;
-
-	int ii;
+	Const char *cp;
+	char *lstPtr;
 
 	*key_name = '\0';
 
@@ -196,16 +281,13 @@ int EXP_LVL1 CS_csEnum (int index,char *key_name,int size)
 
 	/* Get a pointer to the Coordinate System Names enumeration. */
 
-	cp = CScsKeyNames ();
-	if (cp == NULL) return (-cs_Error);
+	lstPtr = CScsKeyNames ();
+	if (lstPtr == NULL) return (-cs_Error);
 
 	/* Locate the index'th entry in the enumeration. */
 
-	for (ii = 0;ii < index;ii++)
-	{
-		while (*cp++ != '\0');						/*lint !e722 */
-		if (*cp == '\0') break;
-	}
+	cp = CSnameIdxGet (&csCsNameIdx,lstPtr,index);
+	if (cp == NULL) return (-cs_Error);
 
 	/* Return the located result, even if it is the null string. */
 
@@ -217,6 +299,63 @@ int EXP_LVL1 CS_csEnum (int index,char *key_name,int size)
 	return (*cp != '\0');
 }
 
+/* Cursor style form of CS_csEnum.  The caller initializes *cursor to zero;
+   each call returns the next name and advances the cursor.  Returns zero at
+   the end of the list, negative on error. */
+int EXP_LVL1 CS_csEnumNext (int *cursor,char *key_name,int size)
+{
+	int status;
+
+	status = CS_csEnum (*cursor,key_name,size);
+	if (status > 0) *cursor += 1;
+	return status;
+}
+
+/* Returns, in a single array, the key name, group, and description of every
+   coordinate system in the dictionary (and those provided by any user
+   definition function).  Each definition is read exactly once.  The array is
+   allocated by this function, the caller must release it using CS_free.
+   Returns the number of elements in the array, or -1 on error in which case
+   *enumArray is set to NULL. */
+int EXP_LVL3 CS_csEnumAll (struct cs_Csenum_ **enumArray)
+{
+	int ii;
+	int csCount;
+	struct cs_Csdef_** pDefArray;
+	struct cs_Csenum_ *enumPtr;
+
+	*enumArray = NULL;
+	pDefArray = NULL;
+	csCount = CS_csdefAll (&pDefArray);
+	if (csCount < 0)
+	{
+		if (pDefArray != NULL) CS_free (pDefArray);
+		return -1;
+	}
+
+	/* Allocate at least one element so that a successful return always
+	   produces a non-NULL pointer. */
+	enumPtr = (struct cs_Csenum_ *)CS_malc ((size_t)(csCount + 1) * sizeof (struct cs_Csenum_));
+	if (enumPtr == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+	}
+	for (ii = 0;ii < csCount;ii += 1)
+	{
+		if (enumPtr != NULL)
+		{
+			CS_stncp (enumPtr [ii].key_nm,pDefArray [ii]->key_nm,sizeof (enumPtr [ii].key_nm));
+			CS_stncp (enumPtr [ii].group,pDefArray [ii]->group,sizeof (enumPtr [ii].group));
+			CS_stncp (enumPtr [ii].descr,pDefArray [ii]->desc_nm,sizeof (enumPtr [ii].descr));
+		}
+		CS_free (pDefArray [ii]);
+	}
+	CS_free (pDefArray);
+	if (enumPtr == NULL) return -1;
+	*enumArray = enumPtr;
+	return csCount;
+}
+
 int EXP_LVL1 CS_csIsValid (Const char *key_name)
 {
 
@@ -270,9 +409,8 @@ int EXP_LVL1 CS_dtEnum (int index,char *key_name,int size)
 {
 	extern int cs_Error;
 
-	cs_Register char *cp;
-
-	int ii;
+	Const char *cp;
+	char *lstPtr;
 
 	*key_name = '\0';
 
@@ -282,13 +420,10 @@ int EXP_LVL1 CS_dtEnum (int index,char *key_name,int size)
 		return (-cs_Error);
 	}
 
-	cp = CSdtKeyNames ();
-	if (cp == NULL)	return (-1);
-	for (ii = 0;ii < index;ii++)
-	{
-		while (*cp++ != '\0');						/*lint !e722 */
-		if (*cp == '\0') break;
-	}
+	lstPtr = CSdtKeyNames ();
+	if (lstPtr == NULL) return (-1);
+	cp = CSnameIdxGet (&csDtNameIdx,lstPtr,index);
+	if (cp == NULL) return (-1);
 	CS_stncp (key_name,cp,size);
 	return (*cp != '\0');
 }
@@ -318,9 +453,8 @@ int EXP_LVL1 CS_elEnum (int index,char *key_name,int size)
 {
 	extern int cs_Error;
 
-	cs_Register char *cp;
-
-	int ii;
+	Const char *cp;
+	char *lstPtr;
 
 	*key_name = '\0';
 
@@ -330,13 +464,10 @@ int EXP_LVL1 CS_elEnum (int index,char *key_name,int size)
 		return (-cs_Error);
 	}
 
-	cp = CSelKeyNames ();
+	lstPtr = CSelKeyNames ();
+	if (lstPtr == NULL) return (-1);
+	cp = CSnameIdxGet (&csElNameIdx,lstPtr,index);
 	if (cp == NULL) return (-1);
-	for (ii = 0;ii < index;ii++)
-	{
-		while (*cp++ != '\0');						/*lint !e722 */
-		if (*cp == '\0') break;
-	}
 	CS_stncp (key_name,cp,size);
 	return (*cp != '\0');
 }
@@ -530,6 +661,7 @@ char * EXP_LVL9 CScsKeyNames (void)
 			used_size += 1;
 			cs_CsKeyNames = (char *)CS_ralc (new_ptr,used_size);
 			if (cs_CsKeyNames == NULL) CS_free (new_ptr);
+			csNameListSerial += 1;
 		}
 	}
 
@@ -614,6 +746,7 @@ char * EXP_LVL9 CSdtKeyNames (void)
 			used_size += 1;
 			cs_DtKeyNames = (char *)CS_ralc (new_ptr,used_size);
 			if (cs_DtKeyNames == NULL) CS_free (new_ptr);
+			csNameListSerial += 1;
 		}
 	}
 	return (cs_DtKeyNames);
@@ -693,6 +826,7 @@ char * EXP_LVL9 CSelKeyNames (void)
 			used_size += 1;
 			cs_ElKeyNames = (char *)CS_ralc (new_ptr,used_size);
 			if (cs_ElKeyNames == NULL) CS_free (new_ptr);
+			csNameListSerial += 1;
 		}
 	}
 	return (cs_ElKeyNames);
@@ -1595,14 +1729,236 @@ void EXP_LVL3 CS_fillIn (struct cs_Csdef_ *csPtr)
 	return;
 }
 
+/* Maps a longitude/latitude to its cell number in the useful range index.
+   Values on the grid edges are clamped into the edge cells. */
+static int CSrngLngCell (double lng)
+{
+	int cell;
+
+	cell = (int)((lng + 180.0) / cs_RNGIDX_CELL);
+	if (cell < 0) cell = 0;
+	if (cell >= cs_RNGIDX_LNGCNT) cell = cs_RNGIDX_LNGCNT - 1;
+	return cell;
+}
+static int CSrngLatCell (double lat)
+{
+	int cell;
+
+	cell = (int)((lat + 90.0) / cs_RNGIDX_CELL);
+	if (cell < 0) cell = 0;
+	if (cell >= cs_RNGIDX_LATCNT) cell = cs_RNGIDX_LATCNT - 1;
+	return cell;
+}
+static int CSrngInGrid (Const double ll_min [2],Const double ll_max [2])
+{
+	return (ll_min [0] >= -180.0 && ll_max [0] <= 180.0 &&
+			ll_min [1] >=  -90.0 && ll_max [1] <=  90.0);
+}
+
+/* Returns the useful range index, building it from the coordinate system
+   dictionary if it doesn't exist yet.  Returns NULL on error, with the
+   error already reported. */
+struct csCsRngIdx_* EXP_LVL9 CScsRangeIdx (void)
+{
+	extern struct csCsRngIdx_ *cs_CsRngIdx;
+
+	int st;
+	int crypt;
+	int idx;
+	int cell;
+	int total;
+	int lngCell, latCell;
+	int lngFirst, lngLast;
+	int latFirst, latLast;
+	int entryMax;
+
+	csFILE *strm;
+	struct csCsRngIdx_ *idxPtr;
+	struct csCsRngEntry_ *entPtr;
+	struct csCsRngEntry_ *tmpPtr;
+
+	int fill [cs_RNGIDX_LNGCNT * cs_RNGIDX_LATCNT];
+
+ 	__ALIGNMENT__1				/* Required by some Sun compilers. */
+	struct cs_Csdef_ cs_def;
+
+	if (cs_CsRngIdx != NULL)
+	{
+		return cs_CsRngIdx;
+	}
+
+	idxPtr = (struct csCsRngIdx_ *)CS_malc (sizeof (struct csCsRngIdx_));
+	if (idxPtr == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		return NULL;
+	}
+	memset (idxPtr,0,sizeof (struct csCsRngIdx_));
+
+	/* Capture the information we need from each definition, in dictionary
+	   order. */
+	strm = CS_csopn (_STRM_BINRD);
+	if (strm == NULL) goto error;
+	entryMax = 0;
+	while ((st = CS_csrd (strm,&cs_def,&crypt)) > 0)
+	{
+		if (idxPtr->entryCount >= entryMax)
+		{
+			entryMax += 1024;
+			tmpPtr = (struct csCsRngEntry_ *)CS_ralc (idxPtr->entries,entryMax * sizeof (struct csCsRngEntry_));
+			if (tmpPtr == NULL)
+			{
+				CS_erpt (cs_NO_MEM);
+				st = -1;
+				break;
+			}
+			idxPtr->entries = tmpPtr;
+		}
+		entPtr = &idxPtr->entries [idxPtr->entryCount];
+		CS_stncp (entPtr->key_nm,cs_def.key_nm,sizeof (entPtr->key_nm));
+		CS_stncp (entPtr->group,cs_def.group,sizeof (entPtr->group));
+		CS_stncp (entPtr->dat_knm,cs_def.dat_knm,sizeof (entPtr->dat_knm));
+		entPtr->ll_min [0] = cs_def.ll_min [0];
+		entPtr->ll_min [1] = cs_def.ll_min [1];
+		entPtr->ll_max [0] = cs_def.ll_max [0];
+		entPtr->ll_max [1] = cs_def.ll_max [1];
+		idxPtr->entryCount += 1;
+	}
+	CS_csDictCls (strm);
+	if (st < 0) goto error;
+
+	/* Count the entries in each cell.  cellStart [cell + 1] accumulates the
+	   count for each cell; the counts are then converted to offsets. */
+	total = 0;
+	for (idx = 0;idx < idxPtr->entryCount;idx += 1)
+	{
+		entPtr = &idxPtr->entries [idx];
+		if (entPtr->ll_min [0] > entPtr->ll_max [0] || entPtr->ll_min [1] > entPtr->ll_max [1])
+		{
+			continue;
+		}
+		if (!CSrngInGrid (entPtr->ll_min,entPtr->ll_max))
+		{
+			idxPtr->wideCount += 1;
+			continue;
+		}
+		lngFirst = CSrngLngCell (entPtr->ll_min [0]);
+		lngLast  = CSrngLngCell (entPtr->ll_max [0]);
+		latFirst = CSrngLatCell (entPtr->ll_min [1]);
+		latLast  = CSrngLatCell (entPtr->ll_max [1]);
+		for (lngCell = lngFirst;lngCell <= lngLast;lngCell += 1)
+		{
+			for (latCell = latFirst;latCell <= latLast;latCell += 1)
+			{
+				idxPtr->cellStart [lngCell * cs_RNGIDX_LATCNT + latCell + 1] += 1;
+				total += 1;
+			}
+		}
+	}
+	for (cell = 0;cell < (cs_RNGIDX_LNGCNT * cs_RNGIDX_LATCNT);cell += 1)
+	{
+		idxPtr->cellStart [cell + 1] += idxPtr->cellStart [cell];
+		fill [cell] = idxPtr->cellStart [cell];
+	}
+
+	/* Now we can allocate and populate the lists. */
+	idxPtr->cellList = (int *)CS_malc ((size_t)(total + 1) * sizeof (int));
+	idxPtr->wideList = (int *)CS_malc ((size_t)(idxPtr->wideCount + 1) * sizeof (int));
+	if (idxPtr->cellList == NULL || idxPtr->wideList == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		goto error;
+	}
+	idxPtr->wideCount = 0;
+	for (idx = 0;idx < idxPtr->entryCount;idx += 1)
+	{
+		entPtr = &idxPtr->entries [idx];
+		if (entPtr->ll_min [0] > entPtr->ll_max [0] || entPtr->ll_min [1] > entPtr->ll_max [1])
+		{
+			continue;
+		}
+		if (!CSrngInGrid (entPtr->ll_min,entPtr->ll_max))
+		{
+			idxPtr->wideList [idxPtr->wideCount++] = idx;
+			continue;
+		}
+		lngFirst = CSrngLngCell (entPtr->ll_min [0]);
+		lngLast  = CSrngLngCell (entPtr->ll_max [0]);
+		latFirst = CSrngLatCell (entPtr->ll_min [1]);
+		latLast  = CSrngLatCell (entPtr->ll_max [1]);
+		for (lngCell = lngFirst;lngCell <= lngLast;lngCell += 1)
+		{
+			for (latCell = latFirst;latCell <= latLast;latCell += 1)
+			{
+				cell = lngCell * cs_RNGIDX_LATCNT + latCell;
+				idxPtr->cellList [fill [cell]++] = idx;
+			}
+		}
+	}
+	cs_CsRngIdx = idxPtr;
+	return cs_CsRngIdx;
+
+error:
+	if (idxPtr->entries != NULL) CS_free (idxPtr->entries);
+	if (idxPtr->cellList != NULL) CS_free (idxPtr->cellList);
+	if (idxPtr->wideList != NULL) CS_free (idxPtr->wideList);
+	CS_free (idxPtr);
+	return NULL;
+}
+
+/* Releases the useful range index; it is rebuilt when next needed. */
+void EXP_LVL9 CScsRangeIdxRls (void)
+{
+	extern struct csCsRngIdx_ *cs_CsRngIdx;
+
+	if (cs_CsRngIdx != NULL)
+	{
+		CS_free (cs_CsRngIdx->entries);
+		CS_free (cs_CsRngIdx->cellList);
+		CS_free (cs_CsRngIdx->wideList);
+		CS_free (cs_CsRngIdx);
+		cs_CsRngIdx = NULL;
+	}
+}
+
 int EXP_LVL1 CS_csRangeEnumSetup (double longitude,double latitude)
+{
+	double ll [2];
+
+	ll [0] = longitude;
+	ll [1] = latitude;
+	return CS_csRangeEnumSetupEx (ll,ll,NULL,NULL);
+}
+
+/**********************************************************************
+**	count = CS_csRangeEnumSetupEx (ll_min,ll_max,group,datum);
+**
+**	double ll_min [2];			southwest corner of the region of interest,
+**								longitude and latitude in degrees.
+**	double ll_max [2];			northeast corner of the region of interest.
+**	char *group;				if not NULL or empty, only coordinate systems
+**								in this group are selected.
+**	char *datum;				if not NULL or empty, only coordinate systems
+**								referenced to this datum are selected.
+**	int count;					returns the number of coordinate systems
+**								selected, -1 for error.
+**
+**	Selects, for enumeration by CS_csRangeEnum, the coordinate systems
+**	whose useful range completely contains the indicated region; a point
+**	query is simply a region whose corners are the same.  Results are in
+**	dictionary order.
+**********************************************************************/
+int EXP_LVL1 CS_csRangeEnumSetupEx (Const double ll_min [2],Const double ll_max [2],Const char *group,Const char *datum)
 {
 	extern char *cs_CsLlEnum;
 
-	int st;
 	int result;
 	int count;
-	int crypt;
+	int entIdx;
+	int cell;
+	int cellIdx, cellEnd;
+	int wideIdx;
+	int scanAll;
 
 	size_t len;
 	size_t malc_size;
@@ -1611,10 +1967,9 @@ int EXP_LVL1 CS_csRangeEnumSetup (double longitude,double latitude)
 	char *cp;
 	char *new_ptr;
 	char *tmp_ptr;
-	csFILE *strm;
 
- 	__ALIGNMENT__1				/* Required by some Sun compilers. */
-	struct cs_Csdef_ cs_def;
+	struct csCsRngIdx_ *idxPtr;
+	struct csCsRngEntry_ *entPtr;
 
 	/* We assume we failed until we know different. */
 	result = -1;
@@ -1624,83 +1979,101 @@ int EXP_LVL1 CS_csRangeEnumSetup (double longitude,double latitude)
 		CS_free (cs_CsLlEnum);
 		cs_CsLlEnum = NULL;
 	}
+	if (group != NULL && *group == '\0') group = NULL;
+	if (datum != NULL && *datum == '\0') datum = NULL;
+
+	idxPtr = CScsRangeIdx ();
+	if (idxPtr == NULL)
+	{
+		return result;
+	}
+
+	/* Any system whose range contains the region must contain its
+	   southwest corner, and thus is listed in the cell containing that
+	   corner (or is in the wide list).  If the corner is outside the grid,
+	   we simply test every entry. */
+	scanAll = !CSrngInGrid (ll_min,ll_min);
+	cell = scanAll ? 0 : (CSrngLngCell (ll_min [0]) * cs_RNGIDX_LATCNT + CSrngLatCell (ll_min [1]));
+	cellIdx = idxPtr->cellStart [cell];
+	cellEnd = idxPtr->cellStart [cell + 1];
+	wideIdx = 0;
+
 	malc_size = 8196;
 	used_size = 0;
 	new_ptr = (char *)CS_malc (malc_size);
 	if (new_ptr == NULL)
 	{
 		CS_erpt (cs_NO_MEM);
+		return result;
 	}
-	else
+	entIdx = 0;
+	for (;;)
 	{
-		/* Open the coordinate system dictionary, we're going to look at each definition. */
-		strm = CS_csopn (_STRM_BINRD);
-		if (strm != NULL)
+		/* Select the next candidate.  The cell list and the wide list are
+		   both in dictionary order, so we merge them to preserve that
+		   order. */
+		if (scanAll)
 		{
-			while ((st = CS_csrd (strm,&cs_def,&crypt)) > 0)
-			{
-				/* See if the current entry meets the indeicated criteria. */
-				if (longitude >= cs_def.ll_min [0] && latitude >= cs_def.ll_min [1] &&
-					longitude <= cs_def.ll_max [0] && latitude <= cs_def.ll_max [1])
-				{
-					/* Add the keyname to the list. */
-					len = strlen (cs_def.key_nm);
-					if ((used_size + len + 2) >= malc_size)
-					{
-						malc_size += 2048;
-						tmp_ptr = (char *)CS_ralc (new_ptr,malc_size);
-						if (tmp_ptr == NULL)
-						{
-							st = -1;
-							CS_erpt (cs_NO_MEM);
-							CS_free (new_ptr);
-							new_ptr = NULL;
-							break;
-						}
-						new_ptr = tmp_ptr;
-					}
+			if (entIdx >= idxPtr->entryCount) break;
+			entPtr = &idxPtr->entries [entIdx++];
+		}
+		else if (cellIdx < cellEnd && (wideIdx >= idxPtr->wideCount || idxPtr->cellList [cellIdx] < idxPtr->wideList [wideIdx]))
+		{
+			entPtr = &idxPtr->entries [idxPtr->cellList [cellIdx++]];
+		}
+		else if (wideIdx < idxPtr->wideCount)
+		{
+			entPtr = &idxPtr->entries [idxPtr->wideList [wideIdx++]];
+		}
+		else
+		{
+			break;
+		}
 
-					/* Add the new item to the list. Must recalculate cp
-					   in case the realloc has moved the list to new memory. */
-					cp = new_ptr + used_size;
-					cp = CS_stcpy (cp,cs_def.key_nm);
-					used_size += len + 1;
+		/* See if the current entry meets the indicated criteria. */
+		if (ll_min [0] >= entPtr->ll_min [0] && ll_min [1] >= entPtr->ll_min [1] &&
+			ll_max [0] <= entPtr->ll_max [0] && ll_max [1] <= entPtr->ll_max [1])
+		{
+			if (group != NULL && CS_stricmp (group,entPtr->group)) continue;
+			if (datum != NULL && CS_stricmp (datum,entPtr->dat_knm)) continue;
 
-					/* Count it. */
-					count += 1;
-				}
-			}
-			CS_csDictCls (strm);
-			if (st >= 0)
+			/* Add the keyname to the list. */
+			len = strlen (entPtr->key_nm);
+			if ((used_size + len + 2) >= malc_size)
 			{
-				if (new_ptr != NULL)
+				malc_size += 2048;
+				tmp_ptr = (char *)CS_ralc (new_ptr,malc_size);
+				if (tmp_ptr == NULL)
 				{
-					/* List generated without an error. Make sure the whole list
-					   is properly terminated, and resize down to the minimum
-					   amount of memory necessary. */
-
-					*(new_ptr + used_size) = '\0';
-					used_size += 1;
-					cs_CsLlEnum = (char *)CS_ralc (new_ptr,used_size);
-					if (cs_CsLlEnum != NULL)
-					{
-						/* Success */
-						new_ptr = NULL;
-						result = count;
-					}
-					else
-					{
-						/* Failure */
-						CS_erpt (cs_NO_MEM);
-					}
+					CS_erpt (cs_NO_MEM);
+					CS_free (new_ptr);
+					return result;
 				}
+				new_ptr = tmp_ptr;
 			}
-		}
-		if (new_ptr != NULL)
-		{
-			CS_free (new_ptr);
+			cp = new_ptr + used_size;
+			cp = CS_stcpy (cp,entPtr->key_nm);
+			used_size += len + 1;
+			count += 1;
 		}
 	}
+
+	/* List generated without an error. Make sure the whole list
+	   is properly terminated, and resize down to the minimum
+	   amount of memory necessary. */
+	*(new_ptr + used_size) = '\0';
+	used_size += 1;
+	cs_CsLlEnum = (char *)CS_ralc (new_ptr,used_size);
+	csNameListSerial += 1;
+	if (cs_CsLlEnum != NULL)
+	{
+		result = count;
+	}
+	else
+	{
+		CS_erpt (cs_NO_MEM);
+		CS_free (new_ptr);
+	}
 	return result;
 }
 
@@ -1708,9 +2081,7 @@ int EXP_LVL1 CS_csRangeEnum (int index,char *key_name,int size)
 {
 	extern char *cs_CsLlEnum;
 
-	cs_Register char *cp;
-
-	int ii;
+	Const char *cp;
 
 	*key_name = '\0';
 	if (index < 0)
@@ -1720,19 +2091,15 @@ int EXP_LVL1 CS_csRangeEnum (int index,char *key_name,int size)
 	}
 
 	/* Get a pointer to the Coordinate System Names enumeration. */
-	cp = cs_CsLlEnum;
-	if (cp == NULL)
+	if (cs_CsLlEnum == NULL)
 	{
 		CS_erpt (cs_LLENUM_NOSU);
 		return (-1);
 	}
 
 	/* Locate the index'th entry in the enumeration. */
-	for (ii = 0;ii < index;ii++)
-	{
-		while (*cp++ != '\0');						/*lint !e722 */
-		if (*cp == '\0') break;
-	}
+	cp = CSnameIdxGet (&csLlNameIdx,cs_CsLlEnum,index);
+	if (cp == NULL) return (-1);
 
 	/* Return the located result, even if it is the null string. */
 	CS_stncp (key_name,cp,size);
@@ -253,6 +253,9 @@ struct cs_GeodeticTransform_ * EXP_LVL3 CS_gxdef (Const char *xfrmName)
 
 struct cs_GeodeticTransform_* EXP_LVL5 CS_gxdef2 (Const char *xfrmName, char* pszDirPath)
 {
+	extern struct cs_Metrics_ csMetrics;
+
+	csMetrics.gxdefCount += 1;
 	return CS_gxDefinition(xfrmName, pszDirPath);
 }
 
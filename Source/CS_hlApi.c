@@ -204,6 +204,947 @@ error:
 	return (-cs_Error);
 }
 
+/**********************************************************************
+**	st = CS_cnvrtExtent (src_cs,dst_cs,srcMin,srcMax,tolerance,dstMin,dstMax);
+**
+**	char *src_cs;				name of the source coordinate system.
+**	char *dst_cs;				name of the destination coordinate system.
+**	double srcMin [2];			southwest (i.e. minimum) corner of the
+**								extent, in source system coordinates.
+**	double srcMax [2];			northeast (i.e. maximum) corner.
+**	double tolerance;			maximum deviation, in destination system
+**								units, of a straight line between two
+**								adjacent densified edge points from the
+**								true image of the edge; zero or negative
+**								selects one thousandth of the size of the
+**								result.
+**	double dstMin [2];			minimum of the converted extent is
+**								returned here.
+**	double dstMax [2];			maximum of the converted extent.
+**	int st;						the cs_BASIC_XXXX bits of CS_cnvrt, or'ed
+**								over all points converted, or -cs_Error.
+**
+**	Each edge of the source rectangle is densified adaptively: a
+**	segment is split only where the image of its midpoint is further
+**	than the tolerance from the midpoint of the image of the segment,
+**	to a maximum of cs_EXTENT_DEPTH levels.  If the destination is
+**	geographic, longitudes are kept continuous around the boundary so
+**	that an extent which straddles the edge of the longitude range
+**	yields, e.g., 170 thru 190 rather than -180 thru 180.  If a pole
+**	lies inside the source rectangle, the result is extended to include
+**	it (and in the geographic case, all longitudes).
+**********************************************************************/
+
+#define cs_EXTENT_INIT  4		/* initial segments per edge */
+#define cs_EXTENT_DEPTH 12		/* maximum subdivision depth */
+
+struct csExtSeg_
+{
+	double src0 [2];
+	double dst0 [2];
+	double src1 [2];
+	double dst1 [2];
+	int depth;
+};
+
+/* Converts a single point, keeping the first coordinate of the result
+   within a half period of the reference value when period is non-zero.
+   The intermediate lat/long, on the destination datum, is returned in
+   dstLL if it is not NULL. */
+static int CSextentPnt (struct cs_Csprm_ *src_ptr,struct cs_Dtcprm_ *dtc_ptr,struct cs_Csprm_ *dst_ptr,
+						double period,Const double *refXY,Const double srcXY [2],double dstXY [2],double *dstLL)
+{
+	int st;
+	int status;
+	double my_xy [3];
+	double my_ll [3];
+
+	status = 0;
+	my_xy [0] = srcXY [0];
+	my_xy [1] = srcXY [1];
+	my_xy [2] = 0.0;
+	st = CS_cs2ll (src_ptr,my_ll,my_xy);
+	if (st != cs_CNVRT_NRML) status |= cs_BASIC_SRCRNG;
+	st = CS_dtcvt (dtc_ptr,my_ll,my_ll);
+	if (st != 0)
+	{
+		if (st < 0) return -1;
+		status |= cs_BASIC_DTCWRN;
+	}
+	if (dstLL != NULL)
+	{
+		dstLL [LNG] = my_ll [LNG];
+		dstLL [LAT] = my_ll [LAT];
+		dstLL [2] = 0.0;
+	}
+	st = CS_ll2cs (dst_ptr,my_xy,my_ll);
+	if (st != cs_CNVRT_NRML) status |= cs_BASIC_DSTRNG;
+	if (period > 0.0 && refXY != NULL)
+	{
+		while ((my_xy [0] - refXY [0]) >  (period * 0.5)) my_xy [0] -= period;
+		while ((my_xy [0] - refXY [0]) < -(period * 0.5)) my_xy [0] += period;
+	}
+	dstXY [0] = my_xy [0];
+	dstXY [1] = my_xy [1];
+	return status;
+}
+
+static int CScnvrtExtent (Const char *src_cs,Const char *dst_cs,Const double srcMin [2],Const double srcMax [2],
+														 double tolerance,double dstMin [2],double dstMax [2])
+{
+	extern int cs_Error;
+	extern double cs_K90;
+	extern double cs_Km90;
+
+	int ii;
+	int jj;
+	int st;
+	int status;
+	int stkIdx;
+
+	struct cs_Csprm_ *src_ptr;
+	struct cs_Csprm_ *dst_ptr;
+	struct cs_Dtcprm_ *dtc_ptr;
+
+	double period;
+	double devX, devY;
+	double srcMid [2];
+	double dstMid [2];
+	double pole [3];
+	double poleXY [3];
+	double corners [5][2];
+	double dstCorners [5][2];
+	double edgeSrc [cs_EXTENT_INIT + 1][2];
+	double edgeDst [cs_EXTENT_INIT + 1][2];
+	struct csExtSeg_ *segPtr;
+	struct csExtSeg_ stack [cs_EXTENT_DEPTH + 2];
+
+	status = 0;
+
+	src_ptr = CSbcclu (src_cs);
+	if (src_ptr == NULL) return (-cs_Error);
+	dst_ptr = CSbcclu (dst_cs);
+	if (dst_ptr == NULL) return (-cs_Error);
+	dtc_ptr = CSbdclu (src_ptr,dst_ptr,cs_DTCFLG_DAT_F,cs_DTCFLG_BLK_W);
+	if (dtc_ptr == NULL) return (-cs_Error);
+
+	/* In the geographic case, longitude is periodic.  Conventional
+	   orientation only; other quadrants are treated as projected. */
+	period = 0.0;
+	if (dst_ptr->prj_code == cs_PRJCOD_UNITY && dst_ptr->proj_prms.unity.quad <= 1)
+	{
+		period = dst_ptr->proj_prms.unity.usr_2pi;
+	}
+
+	/* The corners, counterclockwise, back to the first. */
+	corners [0][0] = srcMin [0]; corners [0][1] = srcMin [1];
+	corners [1][0] = srcMax [0]; corners [1][1] = srcMin [1];
+	corners [2][0] = srcMax [0]; corners [2][1] = srcMax [1];
+	corners [3][0] = srcMin [0]; corners [3][1] = srcMax [1];
+	corners [4][0] = srcMin [0]; corners [4][1] = srcMin [1];
+	for (ii = 0;ii < 5;ii += 1)
+	{
+		st = CSextentPnt (src_ptr,dtc_ptr,dst_ptr,period,(ii == 0) ? NULL : dstCorners [ii - 1],corners [ii],dstCorners [ii],NULL);
+		if (st < 0) return (-cs_Error);
+		status |= st;
+	}
+	dstMin [0] = dstMax [0] = dstCorners [0][0];
+	dstMin [1] = dstMax [1] = dstCorners [0][1];
+	for (ii = 1;ii < 4;ii += 1)
+	{
+		if (dstCorners [ii][0] < dstMin [0]) dstMin [0] = dstCorners [ii][0];
+		if (dstCorners [ii][0] > dstMax [0]) dstMax [0] = dstCorners [ii][0];
+		if (dstCorners [ii][1] < dstMin [1]) dstMin [1] = dstCorners [ii][1];
+		if (dstCorners [ii][1] > dstMax [1]) dstMax [1] = dstCorners [ii][1];
+	}
+	if (tolerance <= 0.0)
+	{
+		tolerance = (dstMax [0] - dstMin [0]) > (dstMax [1] - dstMin [1]) ? (dstMax [0] - dstMin [0]) : (dstMax [1] - dstMin [1]);
+		tolerance *= 1.0E-03;
+		if (tolerance <= 0.0) tolerance = 1.0E-09;
+	}
+
+	/* Walk around the boundary.  Each edge is divided into a few equal
+	   segments to begin with, then each segment is refined as necessary.
+	   The stack holds the segments yet to be processed, the one at the
+	   top being the next along the boundary. */
+	for (ii = 0;ii < 4;ii += 1)
+	{
+		edgeSrc [0][0] = corners [ii][0];
+		edgeSrc [0][1] = corners [ii][1];
+		edgeDst [0][0] = dstCorners [ii][0];
+		edgeDst [0][1] = dstCorners [ii][1];
+		for (jj = 1;jj <= cs_EXTENT_INIT;jj += 1)
+		{
+			edgeSrc [jj][0] = corners [ii][0] + (corners [ii + 1][0] - corners [ii][0]) * (double)jj / (double)cs_EXTENT_INIT;
+			edgeSrc [jj][1] = corners [ii][1] + (corners [ii + 1][1] - corners [ii][1]) * (double)jj / (double)cs_EXTENT_INIT;
+			st = CSextentPnt (src_ptr,dtc_ptr,dst_ptr,period,edgeDst [jj - 1],edgeSrc [jj],edgeDst [jj],NULL);
+			if (st < 0) return (-cs_Error);
+			status |= st;
+		}
+		for (jj = 0;jj < cs_EXTENT_INIT;jj += 1)
+		{
+			stkIdx = 0;
+			segPtr = &stack [0];
+			segPtr->src0 [0] = edgeSrc [jj][0];     segPtr->src0 [1] = edgeSrc [jj][1];
+			segPtr->dst0 [0] = edgeDst [jj][0];     segPtr->dst0 [1] = edgeDst [jj][1];
+			segPtr->src1 [0] = edgeSrc [jj + 1][0]; segPtr->src1 [1] = edgeSrc [jj + 1][1];
+			segPtr->dst1 [0] = edgeDst [jj + 1][0]; segPtr->dst1 [1] = edgeDst [jj + 1][1];
+			segPtr->depth = 0;
+			while (stkIdx >= 0)
+			{
+				segPtr = &stack [stkIdx];
+
+				/* Every point we produce is on the boundary. */
+				if (segPtr->dst1 [0] < dstMin [0]) dstMin [0] = segPtr->dst1 [0];
+				if (segPtr->dst1 [0] > dstMax [0]) dstMax [0] = segPtr->dst1 [0];
+				if (segPtr->dst1 [1] < dstMin [1]) dstMin [1] = segPtr->dst1 [1];
+				if (segPtr->dst1 [1] > dstMax [1]) dstMax [1] = segPtr->dst1 [1];
+				if (segPtr->depth >= cs_EXTENT_DEPTH)
+				{
+					stkIdx -= 1;
+					continue;
+				}
+
+				srcMid [0] = (segPtr->src0 [0] + segPtr->src1 [0]) * 0.5;
+				srcMid [1] = (segPtr->src0 [1] + segPtr->src1 [1]) * 0.5;
+				st = CSextentPnt (src_ptr,dtc_ptr,dst_ptr,period,segPtr->dst0,srcMid,dstMid,NULL);
+				if (st < 0) return (-cs_Error);
+				status |= st;
+				if (dstMid [0] < dstMin [0]) dstMin [0] = dstMid [0];
+				if (dstMid [0] > dstMax [0]) dstMax [0] = dstMid [0];
+				if (dstMid [1] < dstMin [1]) dstMin [1] = dstMid [1];
+				if (dstMid [1] > dstMax [1]) dstMax [1] = dstMid [1];
+				devX = dstMid [0] - (segPtr->dst0 [0] + segPtr->dst1 [0]) * 0.5;
+				devY = dstMid [1] - (segPtr->dst0 [1] + segPtr->dst1 [1]) * 0.5;
+				if ((devX * devX + devY * devY) <= (tolerance * tolerance))
+				{
+					stkIdx -= 1;
+					continue;
+				}
+
+				/* Split: the second half replaces this entry, the first half
+				   goes on top of it. */
+				stack [stkIdx + 1] = *segPtr;
+				segPtr->src0 [0] = srcMid [0]; segPtr->src0 [1] = srcMid [1];
+				segPtr->dst0 [0] = dstMid [0]; segPtr->dst0 [1] = dstMid [1];
+				segPtr->depth += 1;
+				segPtr = &stack [++stkIdx];
+				segPtr->src1 [0] = srcMid [0]; segPtr->src1 [1] = srcMid [1];
+				segPtr->dst1 [0] = dstMid [0]; segPtr->dst1 [1] = dstMid [1];
+				segPtr->depth += 1;
+			}
+		}
+	}
+
+	/* Poles.  A pole is the same point on any datum, so we need not worry
+	   about the datum shift to see if it is inside the source rectangle. */
+	for (ii = 0;ii < 2;ii += 1)
+	{
+		pole [LNG] = src_ptr->cent_mer;
+		pole [LAT] = (ii == 0) ? cs_K90 : cs_Km90;
+		pole [2] = 0.0;
+		st = CS_ll2cs (src_ptr,poleXY,pole);
+		if ((st & cs_CNVRT_DOMN) != 0) continue;
+		if (poleXY [0] < srcMin [0] || poleXY [0] > srcMax [0] ||
+			poleXY [1] < srcMin [1] || poleXY [1] > srcMax [1])
+		{
+			continue;
+		}
+		if (period > 0.0)
+		{
+			/* Geographic result: all longitudes, and the pole latitude. */
+			dstMin [0] = dst_ptr->proj_prms.unity.usr_min;
+			dstMax [0] = dst_ptr->proj_prms.unity.usr_min + period;
+			pole [LNG] = dst_ptr->cent_mer;
+			CS_ll2cs (dst_ptr,poleXY,pole);
+		}
+		else
+		{
+			pole [LNG] = dst_ptr->cent_mer;
+			st = CS_ll2cs (dst_ptr,poleXY,pole);
+			if ((st & cs_CNVRT_DOMN) != 0) continue;
+			if (poleXY [0] < dstMin [0]) dstMin [0] = poleXY [0];
+			if (poleXY [0] > dstMax [0]) dstMax [0] = poleXY [0];
+		}
+		if (poleXY [1] < dstMin [1]) dstMin [1] = poleXY [1];
+		if (poleXY [1] > dstMax [1]) dstMax [1] = poleXY [1];
+	}
+	return (status);
+}
+int EXP_LVL1 CS_cnvrtExtent (Const char *src_cs,Const char *dst_cs,Const double srcMin [2],Const double srcMax [2],
+															 double tolerance,double dstMin [2],double dstMax [2])
+{
+	int status;
+
+	CStraceBgn (cs_TRACE_BATCH,"CS_cnvrtExtent");
+	status = CScnvrtExtent (src_cs,dst_cs,srcMin,srcMax,tolerance,dstMin,dstMax);
+	CStraceEnd (cs_TRACE_BATCH,"CS_cnvrtExtent",status);
+	return (status);
+}
+
+/**********************************************************************
+**	st = CS_cnvrtLine (src_cs,dst_cs,cnt,srcPnts,closed,tolerance,
+**														dstPnts,dstAlloc,dstCnt);
+**
+**	char *src_cs;				name of the source coordinate system.
+**	char *dst_cs;				name of the destination coordinate system.
+**	int cnt;					number of vertices in srcPnts.
+**	double srcPnts [][3];		the vertices of the linestring, or polygon
+**								ring, to be converted.
+**	int closed;					non-zero if srcPnts is a ring, in which case
+**								the segment from the last vertex back to the
+**								first is densified as well.  The ring may,
+**								or may not, repeat the first vertex; the
+**								result always does (for a geographic
+**								destination, a ring about a pole closes on
+**								the first longitude plus or minus a whole
+**								period).
+**	double tolerance;			maximum deviation, in destination system
+**								units, of a straight line between two
+**								adjacent output points from the true image
+**								of the source segment; must be greater than
+**								zero, else cs_INV_ARG6 is reported.
+**	double (**dstPnts)[3];		pointer to the caller's output buffer; the
+**								buffer is grown with CS_ralc as necessary,
+**								so it must be NULL or a block obtained from
+**								CS_malc/CS_ralc, and the caller releases it
+**								with CS_free.
+**	int *dstAlloc;				capacity, in points, of *dstPnts; updated
+**								whenever the buffer is grown.
+**	int *dstCnt;				the number of points returned is returned
+**								here.
+**	int st;						the cs_BASIC_XXXX bits of CS_cnvrt, or'ed
+**								over all points converted, or -cs_Error.
+**
+**	Every source vertex appears in the output, converted exactly as
+**	CS_cnvrt would, with points inserted between them only where the
+**	image of a segment midpoint deviates from the chord by more than
+**	tolerance (to a maximum of cs_EXTENT_DEPTH levels).  The Z value is
+**	interpolated linearly in the source system and passed through, as
+**	CS_cnvrt does.
+**
+**	Each source segment is first given to the destination projection's
+**	segment check.  A segment which crosses a singularity or the edge
+**	of the mathematical domain is densified to the maximum depth, so
+**	that the discontinuity is bracketed as closely as possible, and
+**	cs_BASIC_DSTRNG is returned.  When the destination is geographic,
+**	longitudes are kept continuous along the line (i.e. may exceed the
+**	normal range) so that lines crossing the edge of the longitude
+**	range can be drawn directly.  The buffer is reused across calls;
+**	no allocation occurs per vertex.
+**********************************************************************/
+
+struct csLineSeg_
+{
+	double src0 [3];
+	double dst0 [2];
+	double src1 [3];
+	double dst1 [2];
+	int depth;
+};
+
+/* Appends a point to the caller's buffer, growing it geometrically. */
+static int CSlineAppend (double (**dstPnts)[3],int *dstAlloc,int *dstCnt,Const double xy [2],double zz)
+{
+	extern int cs_Error;
+
+	int newAlloc;
+	double (*newPnts)[3];
+
+	if (*dstCnt >= *dstAlloc || *dstPnts == NULL)
+	{
+		newAlloc = (*dstAlloc < 64) ? 64 : (*dstAlloc * 2);
+		newPnts = (double (*)[3])CS_ralc (*dstPnts,(size_t)newAlloc * sizeof (double [3]));
+		if (newPnts == NULL)
+		{
+			CS_erpt (cs_NO_MEM);
+			return (-1);
+		}
+		*dstPnts = newPnts;
+		*dstAlloc = newAlloc;
+	}
+	(*dstPnts)[*dstCnt][0] = xy [0];
+	(*dstPnts)[*dstCnt][1] = xy [1];
+	(*dstPnts)[*dstCnt][2] = zz;
+	*dstCnt += 1;
+	return (0);
+}
+
+static int CScnvrtLine (Const char *src_cs,Const char *dst_cs,int cnt,Const double srcPnts [][3],int closed,
+						double tolerance,double (**dstPnts)[3],int *dstAlloc,int *dstCnt)
+{
+	extern int cs_Error;
+
+	int ii;
+	int st;
+	int status;
+	int stkIdx;
+	int segCnt;
+	int forced;
+
+	struct cs_Csprm_ *src_ptr;
+	struct cs_Csprm_ *dst_ptr;
+	struct cs_Dtcprm_ *dtc_ptr;
+
+	Const double *vtx0;
+	Const double *vtx1;
+
+	double period;
+	double devX, devY;
+	double srcMid [3];
+	double dstMid [2];
+	double dst0 [2];
+	double dst1 [2];
+	double first [2];
+	double segLL [2][3];
+	struct csLineSeg_ *segPtr;
+	struct csLineSeg_ stack [cs_EXTENT_DEPTH + 2];
+
+	status = 0;
+	*dstCnt = 0;
+	if (tolerance <= 0.0)
+	{
+		CS_erpt (cs_INV_ARG6);
+		return (-cs_Error);
+	}
+	if (cnt <= 0) return (status);
+
+	src_ptr = CSbcclu (src_cs);
+	if (src_ptr == NULL) return (-cs_Error);
+	dst_ptr = CSbcclu (dst_cs);
+	if (dst_ptr == NULL) return (-cs_Error);
+	dtc_ptr = CSbdclu (src_ptr,dst_ptr,cs_DTCFLG_DAT_F,cs_DTCFLG_BLK_W);
+	if (dtc_ptr == NULL) return (-cs_Error);
+
+	period = 0.0;
+	if (dst_ptr->prj_code == cs_PRJCOD_UNITY && dst_ptr->proj_prms.unity.quad <= 1)
+	{
+		period = dst_ptr->proj_prms.unity.usr_2pi;
+	}
+
+	/* The first vertex. */
+	st = CSextentPnt (src_ptr,dtc_ptr,dst_ptr,period,NULL,srcPnts [0],dst0,segLL [0]);
+	if (st < 0) return (-cs_Error);
+	status |= st;
+	first [0] = dst0 [0];
+	first [1] = dst0 [1];
+	if (CSlineAppend (dstPnts,dstAlloc,dstCnt,dst0,srcPnts [0][2]) != 0) return (-cs_Error);
+
+	segCnt = cnt - 1;
+	if (closed && cnt > 2 && (srcPnts [cnt - 1][0] != srcPnts [0][0] || srcPnts [cnt - 1][1] != srcPnts [0][1]))
+	{
+		segCnt = cnt;
+	}
+	for (ii = 0;ii < segCnt;ii += 1)
+	{
+		vtx0 = srcPnts [ii];
+		vtx1 = srcPnts [(ii + 1) % cnt];
+		st = CSextentPnt (src_ptr,dtc_ptr,dst_ptr,period,dst0,vtx1,dst1,segLL [1]);
+		if (st < 0) return (-cs_Error);
+		status |= st;
+
+		/* Closing a ring, the last point must duplicate the first
+		   exactly, whether or not the caller repeated the first vertex.
+		   When the destination is geographic, a ring about a pole
+		   unwraps to a whole number of periods away from the first
+		   point; it is closed there, keeping the longitudes continuous,
+		   rather than with a jump of a full period. */
+		if (closed && cnt > 2 && ii == segCnt - 1)
+		{
+			if (period > 0.0)
+			{
+				dst1 [0] = first [0] + period * floor ((dst1 [0] - first [0]) / period + 0.5);
+			}
+			else
+			{
+				dst1 [0] = first [0];
+			}
+			dst1 [1] = first [1];
+		}
+
+		/* The projection knows where its singularities are. */
+		forced = FALSE;
+		if (dst_ptr->llchk != NULL)
+		{
+			st = (*dst_ptr->llchk)(&dst_ptr->proj_prms.trmer,2,(Const double (*)[3])segLL);
+			if ((st & cs_CNVRT_DOMN) != 0)
+			{
+				forced = TRUE;
+				status |= cs_BASIC_DSTRNG;
+			}
+		}
+
+		stkIdx = 0;
+		segPtr = &stack [0];
+		segPtr->src0 [0] = vtx0 [0]; segPtr->src0 [1] = vtx0 [1]; segPtr->src0 [2] = vtx0 [2];
+		segPtr->src1 [0] = vtx1 [0]; segPtr->src1 [1] = vtx1 [1]; segPtr->src1 [2] = vtx1 [2];
+		segPtr->dst0 [0] = dst0 [0]; segPtr->dst0 [1] = dst0 [1];
+		segPtr->dst1 [0] = dst1 [0]; segPtr->dst1 [1] = dst1 [1];
+		segPtr->depth = 0;
+		while (stkIdx >= 0)
+		{
+			segPtr = &stack [stkIdx];
+			if (segPtr->depth < cs_EXTENT_DEPTH)
+			{
+				srcMid [0] = (segPtr->src0 [0] + segPtr->src1 [0]) * 0.5;
+				srcMid [1] = (segPtr->src0 [1] + segPtr->src1 [1]) * 0.5;
+				srcMid [2] = (segPtr->src0 [2] + segPtr->src1 [2]) * 0.5;
+				st = CSextentPnt (src_ptr,dtc_ptr,dst_ptr,period,segPtr->dst0,srcMid,dstMid,NULL);
+				if (st < 0) return (-cs_Error);
+				status |= st;
+				devX = dstMid [0] - (segPtr->dst0 [0] + segPtr->dst1 [0]) * 0.5;
+				devY = dstMid [1] - (segPtr->dst0 [1] + segPtr->dst1 [1]) * 0.5;
+				if (forced || (devX * devX + devY * devY) > (tolerance * tolerance))
+				{
+					/* Split: the second half replaces this entry, the first
+					   half goes on top of it and is processed next. */
+					stack [stkIdx + 1] = *segPtr;
+					segPtr->src0 [0] = srcMid [0]; segPtr->src0 [1] = srcMid [1]; segPtr->src0 [2] = srcMid [2];
+					segPtr->dst0 [0] = dstMid [0]; segPtr->dst0 [1] = dstMid [1];
+					segPtr->depth += 1;
+					segPtr = &stack [++stkIdx];
+					segPtr->src1 [0] = srcMid [0]; segPtr->src1 [1] = srcMid [1]; segPtr->src1 [2] = srcMid [2];
+					segPtr->dst1 [0] = dstMid [0]; segPtr->dst1 [1] = dstMid [1];
+					segPtr->depth += 1;
+					continue;
+				}
+			}
+
+			/* This segment is good enough; emit its end point. */
+			if (CSlineAppend (dstPnts,dstAlloc,dstCnt,segPtr->dst1,segPtr->src1 [2]) != 0) return (-cs_Error);
+			stkIdx -= 1;
+		}
+		dst0 [0] = dst1 [0];
+		dst0 [1] = dst1 [1];
+		segLL [0][LNG] = segLL [1][LNG];
+		segLL [0][LAT] = segLL [1][LAT];
+	}
+	return (status);
+}
+int EXP_LVL1 CS_cnvrtLine (Const char *src_cs,Const char *dst_cs,int cnt,Const double srcPnts [][3],int closed,
+						   double tolerance,double (**dstPnts)[3],int *dstAlloc,int *dstCnt)
+{
+	int status;
+
+	CStraceBgn (cs_TRACE_BATCH,"CS_cnvrtLine");
+	status = CScnvrtLine (src_cs,dst_cs,cnt,srcPnts,closed,tolerance,dstPnts,dstAlloc,dstCnt);
+	CStraceEnd (cs_TRACE_BATCH,"CS_cnvrtLine",status);
+	return (status);
+}
+
+/**********************************************************************
+**	st = CS_cnvrtTile (tile_cs,src_cs,zoom,tileX,tileY,tileSize,tolerance,grid);
+**
+**	char *tile_cs;				name of the coordinate system of the tile;
+**								this must be a Mercator (usually the
+**								Popular Visualization Pseudo-Mercator,
+**								e.g. WGS84.PseudoMercator) with the normal
+**								quadrant.
+**	char *src_cs;				name of the coordinate system of the source
+**								raster.
+**	int zoom;					zoom level of the tile, 0 thru 30.
+**	long32_t tileX;				column of the tile, 0 at the west edge.
+**	long32_t tileY;				row of the tile, 0 at the north edge.
+**	int tileSize;				width and height of the tile in pixels.
+**	double tolerance;			maximum error, in src_cs units, permitted
+**								for interpolated values.  Zero (or less)
+**								requests that every pixel be converted.
+**	double grid [][2];			tileSize * tileSize src_cs coordinates are
+**								returned here, row by row starting at the
+**								north west corner; one for the center of
+**								each pixel.
+**	int st;						the cs_BASIC_XXXX bits of CS_cnvrt, or'ed
+**								over all points converted, or -cs_Error.
+**								SRCRNG refers to tile_cs, DSTRNG to src_cs.
+**
+**	Produces the map from the pixels of a z/x/y tile back to the source
+**	raster, as used to reproject a raster into tiles.  The tile world is
+**	the square of side 2 * pi * R (the equator at the scale of the tile
+**	system) centered on the false origin, divided into 2^zoom tiles in
+**	each direction.
+**
+**	The Mercator longitude depends only on the column and the latitude
+**	only on the row, so the tile system inverse is computed once for each
+**	row and column rather than for each pixel.  Each pixel is then
+**	shifted to the source datum and projected as CS_cnvrt would do it.
+**
+**	With a positive tolerance, only the pixels of a lattice with a
+**	spacing of cs_TILE_STEP pixels are converted at first.  The center
+**	and the midpoints of the sides of each lattice cell are converted as
+**	well, and if each of these lies within tolerance of the bilinear
+**	interpolation of the corners, and no conversion of the cell produced
+**	a warning, the remainder of the cell is interpolated.  Otherwise,
+**	every pixel of the cell is converted.
+**********************************************************************/
+
+#define cs_TILE_STEP 16			/* Interpolation lattice spacing, pixels. */
+
+static int CStilePnt (struct cs_Dtcprm_ *dtc_ptr,struct cs_Csprm_ *src_ptr,double lng,double lat,double srcXY [2])
+{
+	int st;
+	int status;
+	double my_ll [3];
+	double my_xy [3];
+
+	status = 0;
+	my_ll [LNG] = lng;
+	my_ll [LAT] = lat;
+	my_ll [2] = 0.0;
+	st = CS_dtcvt (dtc_ptr,my_ll,my_ll);
+	if (st != 0)
+	{
+		if (st < 0) return -1;
+		status |= cs_BASIC_DTCWRN;
+	}
+	st = CS_ll2cs (src_ptr,my_xy,my_ll);
+	if (st != cs_CNVRT_NRML) status |= cs_BASIC_DSTRNG;
+	srcXY [0] = my_xy [0];
+	srcXY [1] = my_xy [1];
+	return status;
+}
+
+/* Converts every pixel of a block, other than its corners, exactly. */
+static int CStileBlk (struct cs_Dtcprm_ *dtc_ptr,struct cs_Csprm_ *src_ptr,Const double lngs [],Const double lats [],
+					  Const unsigned char colSt [],Const unsigned char rowSt [],double grid [][2],int tileSize,
+					  int row0,int row1,int col0,int col1)
+{
+	int st;
+	int row;
+	int col;
+	int status;
+
+	status = 0;
+	for (row = row0;row <= row1;row += 1)
+	{
+		for (col = col0;col <= col1;col += 1)
+		{
+			if ((row == row0 || row == row1) && (col == col0 || col == col1)) continue;
+			st = CStilePnt (dtc_ptr,src_ptr,lngs [col],lats [row],grid [row * tileSize + col]);
+			if (st < 0) return -1;
+			status |= st | colSt [col] | rowSt [row];
+		}
+	}
+	return status;
+}
+
+struct csTileCell_
+{
+	int row0;
+	int row1;
+	int col0;
+	int col1;
+};
+
+static int CScnvrtTile (Const char *tile_cs,Const char *src_cs,int zoom,long32_t tileX,long32_t tileY,int tileSize,
+														double tolerance,double grid [][2])
+{
+	extern int cs_Error;
+	extern double cs_Pi;
+
+	int ii;
+	int jj;
+	int kk;
+	int st;
+	int status;
+	int cellSt;
+	int tooFar;
+	int row, col;
+	int row0, row1;
+	int col0, col1;
+	int nodeCnt;
+	int chkIdx;
+	int stkIdx;
+	long32_t tileCnt;
+
+	struct cs_Csprm_ *tile_ptr;
+	struct cs_Csprm_ *src_ptr;
+	struct cs_Dtcprm_ *dtc_ptr;
+	Const struct cs_Mrcat_ *mrcat;
+
+	char *block;
+	double *lngs;
+	double *lats;
+	int *nodes;
+	unsigned char *cellExact;
+	unsigned char *colSt;
+	unsigned char *rowSt;
+
+	double span;
+	double west;
+	double north;
+	double uu, vv;
+	double devX, devY;
+	double interp [2];
+	double chkXY [5][2];
+	int chkRow [5];
+	int chkCol [5];
+	double xy [3];
+	double ll [3];
+	struct csTileCell_ stack [32];		/* 3 per level of subdivision, plus 4 */
+
+	if (grid == NULL)
+	{
+		CS_erpt (cs_INV_ARG8);
+		return (-cs_Error);
+	}
+	if (zoom < 0 || zoom > 30)
+	{
+		CS_erpt (cs_INV_ARG3);
+		return (-cs_Error);
+	}
+	tileCnt = (long32_t)1 << zoom;
+	if (tileX < 0 || tileX >= tileCnt)
+	{
+		CS_erpt (cs_INV_ARG4);
+		return (-cs_Error);
+	}
+	if (tileY < 0 || tileY >= tileCnt)
+	{
+		CS_erpt (cs_INV_ARG5);
+		return (-cs_Error);
+	}
+	if (tileSize <= 0 || tileSize > 32768)
+	{
+		CS_erpt (cs_INV_ARG6);
+		return (-cs_Error);
+	}
+
+	tile_ptr = CSbcclu (tile_cs);
+	if (tile_ptr == NULL) return (-cs_Error);
+	if ((tile_ptr->prj_code != cs_PRJCOD_MRCAT &&
+		 tile_ptr->prj_code != cs_PRJCOD_MRCATK &&
+		 tile_ptr->prj_code != cs_PRJCOD_MRCATPV) ||
+		tile_ptr->proj_prms.mrcat.quad != 0)
+	{
+		CS_erpt (cs_INV_ARG1);
+		return (-cs_Error);
+	}
+	src_ptr = CSbcclu (src_cs);
+	if (src_ptr == NULL) return (-cs_Error);
+	dtc_ptr = CSbdclu (tile_ptr,src_ptr,cs_DTCFLG_DAT_F,cs_DTCFLG_BLK_W);
+	if (dtc_ptr == NULL) return (-cs_Error);
+
+	/* Working storage: the longitude of each column, the latitude of
+	   each row, their statuses, the lattice and the cell decisions. */
+	nodeCnt = (tileSize - 1) / cs_TILE_STEP + 1;
+	if (((tileSize - 1) % cs_TILE_STEP) != 0) nodeCnt += 1;
+	block = (char *)CS_malc ((size_t)tileSize * (2 * sizeof (double) + 2) +
+							 (size_t)nodeCnt * sizeof (int) +
+							 (size_t)nodeCnt * (size_t)nodeCnt);
+	if (block == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		return (-cs_Error);
+	}
+	lngs = (double *)block;
+	lats = lngs + tileSize;
+	nodes = (int *)(lats + tileSize);
+	colSt = (unsigned char *)(nodes + nodeCnt);
+	rowSt = colSt + tileSize;
+	cellExact = rowSt + tileSize;
+
+	/* Tile geometry. */
+	mrcat = &tile_ptr->proj_prms.mrcat;
+	span = (cs_Pi * 2.0 * mrcat->Rfact) / (double)tileCnt;
+	west  = mrcat->x_off - cs_Pi * mrcat->Rfact + (double)tileX * span;
+	north = mrcat->y_off + cs_Pi * mrcat->Rfact - (double)tileY * span;
+	span /= (double)tileSize;
+
+	/* The separable part of the tile system inverse. */
+	status = 0;
+	for (ii = 0;ii < tileSize;ii += 1)
+	{
+		xy [0] = west + ((double)ii + 0.5) * span;
+		xy [1] = mrcat->y_off;
+		xy [2] = 0.0;
+		st = CS_cs2ll (tile_ptr,ll,xy);
+		lngs [ii] = ll [LNG];
+		colSt [ii] = (unsigned char)((st != cs_CNVRT_NRML) ? cs_BASIC_SRCRNG : 0);
+
+		xy [0] = mrcat->x_off;
+		xy [1] = north - ((double)ii + 0.5) * span;
+		st = CS_cs2ll (tile_ptr,ll,xy);
+		lats [ii] = ll [LAT];
+		rowSt [ii] = (unsigned char)((st != cs_CNVRT_NRML) ? cs_BASIC_SRCRNG : 0);
+	}
+
+	if (tolerance <= 0.0 || nodeCnt < 2)
+	{
+		for (row = 0;row < tileSize;row += 1)
+		{
+			for (col = 0;col < tileSize;col += 1)
+			{
+				st = CStilePnt (dtc_ptr,src_ptr,lngs [col],lats [row],grid [row * tileSize + col]);
+				if (st < 0) goto error;
+				status |= st | colSt [col] | rowSt [row];
+			}
+		}
+		CS_free (block);
+		return (status);
+	}
+
+	/* The lattice. */
+	for (ii = 0;ii < nodeCnt;ii += 1)
+	{
+		nodes [ii] = ii * cs_TILE_STEP;
+	}
+	nodes [nodeCnt - 1] = tileSize - 1;
+	for (ii = 0;ii < nodeCnt * nodeCnt;ii += 1)
+	{
+		cellExact [ii] = 0;
+	}
+	for (ii = 0;ii < nodeCnt;ii += 1)
+	{
+		row = nodes [ii];
+		for (jj = 0;jj < nodeCnt;jj += 1)
+		{
+			col = nodes [jj];
+			st = CStilePnt (dtc_ptr,src_ptr,lngs [col],lats [row],grid [row * tileSize + col]);
+			if (st < 0) goto error;
+			st |= colSt [col] | rowSt [row];
+			status |= st;
+			if (st != 0)
+			{
+				/* Every cell sharing this node is converted exactly. */
+				if (ii > 0 && jj > 0) cellExact [(ii - 1) * nodeCnt + (jj - 1)] = 1;
+				if (ii > 0 && jj < nodeCnt - 1) cellExact [(ii - 1) * nodeCnt + jj] = 1;
+				if (ii < nodeCnt - 1 && jj > 0) cellExact [ii * nodeCnt + (jj - 1)] = 1;
+				if (ii < nodeCnt - 1 && jj < nodeCnt - 1) cellExact [ii * nodeCnt + jj] = 1;
+			}
+		}
+	}
+
+	/* Interpolate the cells which are well enough behaved.  A cell
+	   which is not is split into quarters, the check points becoming
+	   the corners of the quarters, until the quarters are too small to
+	   be worth interpolating. */
+	for (ii = 0;ii < nodeCnt - 1;ii += 1)
+	{
+		for (jj = 0;jj < nodeCnt - 1;jj += 1)
+		{
+			if (cellExact [ii * nodeCnt + jj]) continue;
+			stkIdx = 0;
+			stack [0].row0 = nodes [ii];
+			stack [0].row1 = nodes [ii + 1];
+			stack [0].col0 = nodes [jj];
+			stack [0].col1 = nodes [jj + 1];
+			while (stkIdx >= 0)
+			{
+				row0 = stack [stkIdx].row0;
+				row1 = stack [stkIdx].row1;
+				col0 = stack [stkIdx].col0;
+				col1 = stack [stkIdx].col1;
+				stkIdx -= 1;
+				if ((row1 - row0) < 2 || (col1 - col0) < 2)
+				{
+					st = CStileBlk (dtc_ptr,src_ptr,lngs,lats,colSt,rowSt,grid,tileSize,row0,row1,col0,col1);
+					if (st < 0) goto error;
+					status |= st;
+					continue;
+				}
+				chkRow [0] = (row0 + row1) / 2; chkCol [0] = (col0 + col1) / 2;
+				chkRow [1] = row0;              chkCol [1] = chkCol [0];
+				chkRow [2] = row1;              chkCol [2] = chkCol [0];
+				chkRow [3] = chkRow [0];        chkCol [3] = col0;
+				chkRow [4] = chkRow [0];        chkCol [4] = col1;
+				cellSt = 0;
+				tooFar = FALSE;
+				for (chkIdx = 0;chkIdx < 5;chkIdx += 1)
+				{
+					row = chkRow [chkIdx];
+					col = chkCol [chkIdx];
+					st = CStilePnt (dtc_ptr,src_ptr,lngs [col],lats [row],chkXY [chkIdx]);
+					if (st < 0) goto error;
+					cellSt |= st | colSt [col] | rowSt [row];
+					uu = (double)(col - col0) / (double)(col1 - col0);
+					vv = (double)(row - row0) / (double)(row1 - row0);
+					for (kk = 0;kk < 2;kk += 1)
+					{
+						interp [kk] = (1.0 - vv) * ((1.0 - uu) * grid [row0 * tileSize + col0][kk] + uu * grid [row0 * tileSize + col1][kk]) +
+											 vv  * ((1.0 - uu) * grid [row1 * tileSize + col0][kk] + uu * grid [row1 * tileSize + col1][kk]);
+					}
+					devX = chkXY [chkIdx][0] - interp [0];
+					devY = chkXY [chkIdx][1] - interp [1];
+					if ((devX * devX + devY * devY) > (tolerance * tolerance)) tooFar = TRUE;
+				}
+				if (cellSt != 0)
+				{
+					st = CStileBlk (dtc_ptr,src_ptr,lngs,lats,colSt,rowSt,grid,tileSize,row0,row1,col0,col1);
+					if (st < 0) goto error;
+					status |= st;
+					continue;
+				}
+				if (!tooFar)
+				{
+					for (row = row0;row <= row1;row += 1)
+					{
+						vv = (double)(row - row0) / (double)(row1 - row0);
+						for (col = col0;col <= col1;col += 1)
+						{
+							if ((row == row0 || row == row1) && (col == col0 || col == col1)) continue;
+							uu = (double)(col - col0) / (double)(col1 - col0);
+							for (kk = 0;kk < 2;kk += 1)
+							{
+								grid [row * tileSize + col][kk] =
+									(1.0 - vv) * ((1.0 - uu) * grid [row0 * tileSize + col0][kk] + uu * grid [row0 * tileSize + col1][kk]) +
+										   vv  * ((1.0 - uu) * grid [row1 * tileSize + col0][kk] + uu * grid [row1 * tileSize + col1][kk]);
+							}
+						}
+					}
+				}
+				for (chkIdx = 0;chkIdx < 5;chkIdx += 1)
+				{
+					grid [chkRow [chkIdx] * tileSize + chkCol [chkIdx]][0] = chkXY [chkIdx][0];
+					grid [chkRow [chkIdx] * tileSize + chkCol [chkIdx]][1] = chkXY [chkIdx][1];
+				}
+				if (tooFar)
+				{
+					stack [++stkIdx].row0 = row0;       stack [stkIdx].row1 = chkRow [0];
+					stack [stkIdx].col0 = col0;         stack [stkIdx].col1 = chkCol [0];
+					stack [++stkIdx].row0 = row0;       stack [stkIdx].row1 = chkRow [0];
+					stack [stkIdx].col0 = chkCol [0];   stack [stkIdx].col1 = col1;
+					stack [++stkIdx].row0 = chkRow [0]; stack [stkIdx].row1 = row1;
+					stack [stkIdx].col0 = col0;         stack [stkIdx].col1 = chkCol [0];
+					stack [++stkIdx].row0 = chkRow [0]; stack [stkIdx].row1 = row1;
+					stack [stkIdx].col0 = chkCol [0];   stack [stkIdx].col1 = col1;
+				}
+			}
+		}
+	}
+
+	/* Then the cells with a troublesome corner, exactly.  These are done
+	   last so that the edges such a cell shares with an interpolated
+	   neighbor are exact. */
+	for (ii = 0;ii < nodeCnt - 1;ii += 1)
+	{
+		for (jj = 0;jj < nodeCnt - 1;jj += 1)
+		{
+			if (!cellExact [ii * nodeCnt + jj]) continue;
+			st = CStileBlk (dtc_ptr,src_ptr,lngs,lats,colSt,rowSt,grid,tileSize,
+										nodes [ii],nodes [ii + 1],nodes [jj],nodes [jj + 1]);
+			if (st < 0) goto error;
+			status |= st;
+		}
+	}
+	CS_free (block);
+	return (status);
+
+error:
+	CS_free (block);
+	return (-cs_Error);
+}
+int EXP_LVL1 CS_cnvrtTile (Const char *tile_cs,Const char *src_cs,int zoom,long32_t tileX,long32_t tileY,int tileSize,
+															double tolerance,double grid [][2])
+{
+	int status;
+
+	CStraceBgn (cs_TRACE_BATCH,"CS_cnvrtTile");
+	status = CScnvrtTile (tile_cs,src_cs,zoom,tileX,tileY,tileSize,tolerance,grid);
+	CStraceEnd (cs_TRACE_BATCH,"CS_cnvrtTile",status);
+	return (status);
+}
+
 /**********************************************************************
 	The following function maintains the coordinate system
 	cache.  This is nothing more than a linked list of
@@ -232,6 +1173,7 @@ struct cs_Csprm_ * EXP_LVL9 CSbcclu (Const char *cs_name)
 {
 	extern struct csCscach_ *csCscachP;
 	extern int csCscachI;
+	extern struct cs_Metrics_ csMetrics;
 
 	cs_Register struct csCscach_ *ch_ptr;
 
@@ -306,6 +1248,8 @@ struct cs_Csprm_ * EXP_LVL9 CSbcclu (Const char *cs_name)
 	/* If cs_ptr is NULL, we havn't found the one we are looking
 	   for.  We must add it to the cache. */
 
+	if (cs_ptr != NULL) csMetrics.csCacheHits += 1;
+	else				csMetrics.csCacheMisses += 1;
 	if (cs_ptr == NULL)
 	{
 		/* If ch_ptr is not NULL, it must point to the
@@ -436,6 +1380,7 @@ struct cs_Dtcprm_ * EXP_LVL9 CSbdclu (	Const struct cs_Csprm_ *src_cs,
 {
 	extern struct csDtcach_ *csDtcachP;
 	extern int csDtcachI;
+	extern struct cs_Metrics_ csMetrics;
 
 	unsigned short srcPrjCode;
 	unsigned short dstPrjCode;
@@ -518,6 +1463,8 @@ struct cs_Dtcprm_ * EXP_LVL9 CSbdclu (	Const struct cs_Csprm_ *src_cs,
 		ch_ptr = ch_ptr->next;
 	}
 
+	if (dtc_ptr != NULL) csMetrics.dtcCacheHits += 1;
+	else				 csMetrics.dtcCacheMisses += 1;
 	if (dtc_ptr == NULL)
 	{
 		/* Didn't find one. */
@@ -791,6 +1738,9 @@ void EXP_LVL1 CS_recvr (void)
 		CS_free (cs_CsLlEnum);
 		cs_CsLlEnum = NULL;
 	}
+	CScsRangeIdxRls ();
+	CSdtlocRls ();
+	CSrlsNameIdx ();
 	if (cs_CsGrpList != NULL)
 	{
 		CS_csgrpf (cs_CsGrpList);
@@ -58,8 +58,12 @@
 
 int EXP_LVL3 CS_cs2ll (Const struct cs_Csprm_ *csprm,double ll [3],Const double xy [3])
 {
+	extern struct cs_Metrics_ csMetrics;
+
 	int rtn_val;
 
+	csMetrics.cs2llPnts += 1;
+
 	/* Convert the cartesian coordinates to latitude and
 	   longitude.  A pointer to the appropriate function is
 	   in the csprm structure.  We don't have to know anything
@@ -75,8 +79,12 @@ int EXP_LVL3 CS_cs2ll (Const struct cs_Csprm_ *csprm,double ll [3],Const double
 
 int EXP_LVL3 CS_cs3ll (Const struct cs_Csprm_ *csprm,double ll [3],Const double xy [3])
 {
+	extern struct cs_Metrics_ csMetrics;
+
 	int rtn_val;
 
+	csMetrics.cs2llPnts += 1;
+
 	/* Convert the cartesian coordinates to latitude and
 	   longitude.  A pointer to the appropriate function is
 	   in the csprm structure.  We don't have to know anything
@@ -132,9 +140,12 @@ int EXP_LVL3 CS_ll2cs (Const struct cs_Csprm_ *csprm,double xy [3],Const double
 
 {
 	extern double cs_Zero;			/* 0.0 */
+	extern struct cs_Metrics_ csMetrics;
 
 	int rtn_val;
 
+	csMetrics.ll2csPnts += 1;
+
 	/* Convert the latitude and longitude to cartesian coordinates.
 	   The csprm structure has a pointer to a function which will
 	   do this for me.  I don't have to know anything about exactly
@@ -157,9 +168,12 @@ int EXP_LVL3 CS_ll2cs (Const struct cs_Csprm_ *csprm,double xy [3],Const double
 int EXP_LVL3 CS_ll3cs (Const struct cs_Csprm_ *csprm,double xy [3],Const double ll [3])
 {
 	extern double cs_Zero;			/* 0.0 */
+	extern struct cs_Metrics_ csMetrics;
 
 	int rtn_val;
 
+	csMetrics.ll2csPnts += 1;
+
 	rtn_val = (*csprm->ll2cs)(&csprm->proj_prms,xy,ll);
 
 	/* Convert Z from meters to the real unit.  Until we have a means of
@@ -370,6 +384,94 @@ double EXP_LVL3 CS_cssch (Const struct cs_Csprm_ *csprm,Const double ll [3])
 	return (h);
 }
 
+/**********************************************************************
+**	count = CS_csDistortion (csprm,ll,cnt,rslt);
+**
+**	struct cs_Csprm_ *csprm;	coordinate system definition structure as
+**								returned by CS_csloc.
+**	double ll [][3];			the longitude ([0]), latitude ([1]), and
+**								height ([2]) of each point at which the
+**								distortion is to be computed.
+**	int cnt;					the number of points in the ll array.
+**	struct cs_Distortion_ rslt [];
+**								the K and H scale factors, the scale
+**								and the convergence angle of each point
+**								are returned here.
+**	int count;					returns cnt.
+**
+**	Each element of rslt holds the values CS_cssck, CS_cssch, CS_csscl
+**	and CS_cscnv would return for the corresponding point.  Each of
+**	those functions is often the same function as one of the others
+**	(for all conformal projections, K, H and the scale are identical),
+**	and each such function is called only once here.  Projections which
+**	provide a cs_dstrt function (currently the Transverse Mercator and
+**	the Robinson) compute K, H and the convergence in a single call,
+**	sharing the work that the individual functions each do on their
+**	own.  For the Robinson, the convergence so computed may differ from
+**	CS_cscnv in the tenth significant digit or so.
+**********************************************************************/
+
+int EXP_LVL3 CS_csDistortion (Const struct cs_Csprm_ *csprm,Const double ll [][3],int cnt,struct cs_Distortion_ rslt [])
+{
+	int idx;
+	int sclIsK;
+	int sclIsH;
+	int hIsK;
+
+	Const void *prjPrms;
+	double (*sclkFunc)(Const void *prj_prms,Const double *ll);
+	double (*sclhFunc)(Const void *prj_prms,Const double *ll);
+	double (*scaleFunc)(Const void *prj_prms,Const double *ll);
+	double (*cnvrgFunc)(Const void *prj_prms,Const double *ll);
+	void (*dstrtFunc)(Const void *prj_prms,Const double *ll,double *khc);
+
+	double khc [3];
+
+	prjPrms   = &csprm->proj_prms;
+	sclkFunc  = csprm->cs_sclk;
+	sclhFunc  = csprm->cs_sclh;
+	scaleFunc = csprm->cs_scale;
+	cnvrgFunc = csprm->cs_cnvrg;
+	dstrtFunc = csprm->cs_dstrt;
+
+	hIsK   = (sclhFunc == sclkFunc);
+	sclIsK = (scaleFunc == sclkFunc);
+	sclIsH = (scaleFunc == sclhFunc);
+
+	CStraceBgn (cs_TRACE_BATCH,"CS_csDistortion");
+
+	for (idx = 0;idx < cnt;idx += 1)
+	{
+		if (dstrtFunc != NULL)
+		{
+			(*dstrtFunc)(prjPrms,ll [idx],khc);
+			rslt [idx].k = khc [0];
+			rslt [idx].h = khc [1];
+			rslt [idx].cnvrg = khc [2];
+		}
+		else
+		{
+			rslt [idx].k = (*sclkFunc)(prjPrms,ll [idx]);
+			rslt [idx].h = hIsK ? rslt [idx].k : (*sclhFunc)(prjPrms,ll [idx]);
+			rslt [idx].cnvrg = (*cnvrgFunc)(prjPrms,ll [idx]);
+		}
+		if (sclIsK)
+		{
+			rslt [idx].scale = rslt [idx].k;
+		}
+		else if (sclIsH)
+		{
+			rslt [idx].scale = rslt [idx].h;
+		}
+		else
+		{
+			rslt [idx].scale = (*scaleFunc)(prjPrms,ll [idx]);
+		}
+	}
+	CStraceEnd (cs_TRACE_BATCH,"CS_csDistortion",cnt);
+	return (cnt);
+}
+
 /**********************************************************************
 **	st = CS_cschk (cs_def,chk_flg,err_list,list_sz);
 **
@@ -413,7 +515,6 @@ int EXP_LVL3 CS_cschk (	Const struct cs_Csdef_ *cs_def,unsigned short chk_flg,
 {
 	extern unsigned short cs_ErrSup;	/* Error report suppression
 										   bit map */
-	extern struct cs_Prjtab_ cs_Prjtab [];	/* Projection Table */
 	extern char csErrnam [];		/* Dimensioned at MAXPATH */
 	extern short cs_QuadMin;		/* Minimum acceptable value
 									   for quad. */
@@ -445,13 +546,7 @@ int EXP_LVL3 CS_cschk (	Const struct cs_Csdef_ *cs_def,unsigned short chk_flg,
 	   pointer to the check function, and then check the
 	   projection specific values. */
 
-	for (pp = cs_Prjtab;pp->key_nm [0] != '\0';pp += 1)
-	{
-		if (!CS_stricmp (cs_def->prj_knm,pp->key_nm))
-		{
-			break;
-		}
-	}
+	pp = CSprjtabLu (cs_def->prj_knm);
 	if (pp->check == NULL)
 	{
 		/* We have an invalid projection specification. */
@@ -831,6 +926,109 @@ int EXP_LVL3 CS_xychk (Const struct cs_Csprm_ *csprm,int cnt,Const double pnts [
 	return (status);
 }
 
+/**********************************************************************
+**	badCnt = CS_llchkArray (csprm,cnt,pnts,status);
+**	badCnt = CS_xychkArray (csprm,cnt,pnts,status);
+**
+**	struct cs_Csprm_ *csprm;	the coordinate system.
+**	int cnt;					number of points in the pnts array.
+**	double pnts [][3];			the points to be checked.
+**	unsigned char status [];	the cs_CNVRT_USFL/cs_CNVRT_DOMN bit map
+**								for each individual point is returned
+**								here; zero (cs_CNVRT_OK) says the point
+**								is fine.
+**	int badCnt;					returns the number of points which have
+**								a non-zero status.
+**
+**	These are the point by point versions of CS_llchk and CS_xychk.
+**	Each element of status is exactly what CS_llchk (or CS_xychk)
+**	would return for the corresponding point alone, but the entire
+**	array is checked; there is no stopping at the first problem point.
+**	Thus, a large set of points can be filtered, and only the
+**	problem points routed to whatever special handling is required.
+**
+**	The useful range test is done for all points in a single branch
+**	free loop first.  The mathematical domain test, which takes
+**	precedence, is then applied to each point.
+**********************************************************************/
+
+int EXP_LVL3 CS_llchkArray (Const struct cs_Csprm_ *csprm,int cnt,Const double pnts [][3],unsigned char status [])
+{
+	int ii;
+	int badCnt;
+	int domStat;
+
+	double cent_mer;
+	double minLng, maxLng;
+	double minLat, maxLat;
+	double del_lng, lat;
+
+	cent_mer = csprm->cent_mer;
+	minLng = csprm->min_ll [LNG];
+	maxLng = csprm->max_ll [LNG];
+	minLat = csprm->min_ll [LAT];
+	maxLat = csprm->max_ll [LAT];
+
+	/* Useful range first.  Written this way so that the compiler has a
+	   reasonable chance of vectorizing the loop. */
+	for (ii = 0;ii < cnt;ii++)
+	{
+		lat     = pnts [ii][LAT];
+		del_lng = pnts [ii][LNG] - cent_mer;
+		status [ii] = (unsigned char)(cs_CNVRT_USFL * ((del_lng < minLng) | (del_lng > maxLng) |
+													   (lat     < minLat) | (lat     > maxLat)));
+	}
+
+	/* Now the mathematical domain, which takes precedence. */
+	badCnt = 0;
+	for (ii = 0;ii < cnt;ii++)
+	{
+		if (csprm->llchk != NULL)
+		{
+			domStat = (*csprm->llchk)(&csprm->proj_prms.trmer,1,&pnts [ii]);
+			if (domStat != cs_CNVRT_OK) status [ii] = (unsigned char)domStat;
+		}
+		if (status [ii] != cs_CNVRT_OK) badCnt += 1;
+	}
+	return badCnt;
+}
+
+int EXP_LVL3 CS_xychkArray (Const struct cs_Csprm_ *csprm,int cnt,Const double pnts [][3],unsigned char status [])
+{
+	int ii;
+	int badCnt;
+	int domStat;
+
+	double minX, maxX;
+	double minY, maxY;
+	double xx, yy;
+
+	minX = csprm->min_xy [XX];
+	maxX = csprm->max_xy [XX];
+	minY = csprm->min_xy [YY];
+	maxY = csprm->max_xy [YY];
+
+	for (ii = 0;ii < cnt;ii++)
+	{
+		xx = pnts [ii][XX];
+		yy = pnts [ii][YY];
+		status [ii] = (unsigned char)(cs_CNVRT_USFL * ((xx < minX) | (yy < minY) |
+													   (xx > maxX) | (yy > maxY)));
+	}
+
+	badCnt = 0;
+	for (ii = 0;ii < cnt;ii++)
+	{
+		if (csprm->xychk != NULL)
+		{
+			domStat = (*csprm->xychk)(&csprm->proj_prms,1,&pnts [ii]);
+			if (domStat != cs_CNVRT_OK) status [ii] = (unsigned char)domStat;
+		}
+		if (status [ii] != cs_CNVRT_OK) badCnt += 1;
+	}
+	return badCnt;
+}
+
 /* Returns TRUE (i.e. non-zero) if the conversion represented by the provided
    cs_Csprm_ structure is reentrant. */
 int	EXP_LVL1 CS_isCsPrmReentrant (Const struct cs_Csprm_ *prjConversion)
@@ -221,18 +221,42 @@ int CSjapanF3 (struct cs_Japan_ *japan,double *ll_trg,Const double *ll_src)
 	}
 	return status;
 }
+/* Builds the shift cell which CSjapanF2 used at the point most recently
+   converted from the grid cells left behind by CSextractJgd2kGridFile.
+   Only valid immediately after a successful CSjapanF2. */
+static void CSjapanShiftCell (struct cs_Japan_ *japan,struct csGridShiftCell_ *shiftCell)
+{
+	extern double cs_Sec2Deg;
+
+	struct csGridCell_ *lngCell;
+	struct csGridCell_ *latCell;
+
+	lngCell = &japan->lngCell;
+	latCell = &japan->latCell;
+	shiftCell->origin [LNG] = lngCell->coverage.southWest [LNG];
+	shiftCell->origin [LAT] = lngCell->coverage.southWest [LAT];
+	shiftCell->delta [LNG] = lngCell->deltaLng;
+	shiftCell->delta [LAT] = lngCell->deltaLat;
+	shiftCell->lngCoef [0] = lngCell->currentAA * cs_Sec2Deg;
+	shiftCell->lngCoef [1] = lngCell->currentBB * cs_Sec2Deg;
+	shiftCell->lngCoef [2] = lngCell->currentCC * cs_Sec2Deg;
+	shiftCell->lngCoef [3] = lngCell->currentDD * cs_Sec2Deg;
+	shiftCell->latCoef [0] = latCell->currentAA * cs_Sec2Deg;
+	shiftCell->latCoef [1] = latCell->currentBB * cs_Sec2Deg;
+	shiftCell->latCoef [2] = latCell->currentCC * cs_Sec2Deg;
+	shiftCell->latCoef [3] = latCell->currentDD * cs_Sec2Deg;
+}
 int CSjapanI2 (struct cs_Japan_ *japan,double *ll_trg,Const double *ll_src)
 {
 	extern double cs_Zero;
 
-	short lng_ok;
-	short lat_ok;
 	int ii;
 	int status;
 
 	double guess [3];
 	double epsilon [2];
 	double newResult [3];
+	struct csGridShiftCell_ shiftCell;
 
 	status = csGRIDI_ST_OK;
 	epsilon [0] = epsilon [1] = cs_Zero;		/* keep lint happy */
@@ -246,9 +270,6 @@ int CSjapanI2 (struct cs_Japan_ *japan,double *ll_trg,Const double *ll_src)
 	   this is an inverse, we'll do a little better than they do. */
 	for (ii = 1;ii < japan->maxIterations;ii++)
 	{
-		/* Assume we are done until we know different. */
-		lng_ok = lat_ok = TRUE;
-
 		/* Compute the NAD83 lat/long for our current guess. */
 		status = CSjapanF2 (japan,newResult,guess);
 		if (status != csGRIDI_ST_OK)
@@ -263,27 +284,29 @@ int CSjapanI2 (struct cs_Japan_ *japan,double *ll_trg,Const double *ll_src)
 		/* See how far we are off. */
 		epsilon [LNG] = CS_lngEpsilon (ll_src [LNG],newResult [LNG]);
 		epsilon [LAT] = ll_src [LAT] - newResult [LAT];
-
-		/* If our guess at the longitude is off by more than 'small', we adjust
-		 our guess by the amount we are off. */
-		if (fabs (epsilon [LNG]) > japan->cnvrgValue)
+		if (fabs (epsilon [LNG]) <= japan->cnvrgValue &&
+			fabs (epsilon [LAT]) <= japan->cnvrgValue)
 		{
-			lng_ok = FALSE;
-			guess [LNG] += epsilon [LNG];
+			break;
 		}
-		if (fabs (epsilon [LAT]) > japan->cnvrgValue)
+
+		/* Newton's method within the grid cell the forward just used.  If
+		   the solution lies within that same cell, the forward would
+		   reproduce ll_src as the solution predicts and we are done.
+		   Otherwise, the solution is our next guess.  The cells are always
+		   complete after a successful forward, so unlike the other formats
+		   there is no need for the fixed point step here. */
+		CSjapanShiftCell (japan,&shiftCell);
+		if (CSinvertShiftCell (&shiftCell,guess,ll_src,japan->cnvrgValue))
 		{
-			lat_ok = FALSE;
-			guess [LAT] += epsilon [LAT];
+			epsilon [LNG] = epsilon [LAT] = cs_Zero;
+			break;
 		}
-
-		/* If our current guess produces a newResult that is within
-		   small of original, we are done. */
-		if (lng_ok && lat_ok) break;
 	}
 
 	if (status == csGRIDI_ST_OK)
 	{
+		CSmetricsItr (ii,japan->maxIterations);
 		if (ii >= japan->maxIterations)
 		{
 			status = csGRIDI_ST_COVERAGE;
@@ -399,6 +422,10 @@ struct cs_Japan_* CSnewJgd2kGridFile (Const char *path,long32_t bufferSize,ulong
 	thisPtr->bufferSize = 64 * sizeof (struct csJgd2kGridRecord_);
 	if (bufferSize > 0L) thisPtr->bufferSize = bufferSize;
 	thisPtr->dataBuffer = NULL;
+	thisPtr->meshHash = NULL;
+	thisPtr->hashMask = 0UL;
+	thisPtr->cellHits = 0UL;
+	thisPtr->cellMisses = 0UL;
 	CSinitGridCell (&thisPtr->lngCell);
 	CSinitGridCell (&thisPtr->latCell);
 	thisPtr->lngCell.deltaLng = thisPtr->ewDelta;
@@ -432,7 +459,9 @@ struct cs_Japan_* CSnewJgd2kGridFile (Const char *path,long32_t bufferSize,ulong
 	/* If we're still here, we have a binary image of the named .par file.
 	   We open it and extract the first two records which should be the
 	   min and max of the coverage of the file. */
+	CStraceBgn (cs_TRACE_GRIDOPEN,thisPtr->binaryPath);
 	bStrm = CS_fopen (thisPtr->binaryPath,_STRM_BINRD);
+	CStraceEnd (cs_TRACE_GRIDOPEN,thisPtr->binaryPath,(bStrm != NULL) ? 0 : -1);
 	if (bStrm == NULL)
 	{
 		CS_stncp (csErrnam,thisPtr->binaryPath,MAXPATH);
@@ -504,6 +533,11 @@ void CSdeleteJgd2kGridFile (struct cs_Japan_ *thisPtr)
 			CS_free (thisPtr->dataBuffer);
 			thisPtr->dataBuffer = NULL;
 		}
+		if (thisPtr->meshHash != NULL)
+		{
+			CS_free (thisPtr->meshHash);
+			thisPtr->meshHash = NULL;
+		}
 		CS_free (thisPtr);
 	}
 	return;
@@ -527,9 +561,164 @@ void CSreleaseJgd2kGridFile (struct cs_Japan_ *thisPtr)
 			CS_free (thisPtr->dataBuffer);
 			thisPtr->dataBuffer = NULL;
 		}
+		if (thisPtr->meshHash != NULL)
+		{
+			CS_free (thisPtr->meshHash);
+			thisPtr->meshHash = NULL;
+		}
 	}
 	return;
 }
+/* Hash table slot for a given mesh code.  Mesh codes are decimal encodings,
+   so we scramble them a bit before masking off the low order bits. */
+static ulong32_t CSjgd2kMeshHashSlot (ulong32_t meshCode,ulong32_t hashMask)
+{
+	ulong32_t hash;
+
+	hash = (meshCode * 2654435761UL) & 0xFFFFFFFFUL;
+	hash ^= hash >> 16;
+	return hash & hashMask;
+}
+/* Loads the entire binary file into an open addressed hash table if the
+   buffer size specified for this object is large enough to hold the entire
+   file.  The binary file must be open.  Returns 1 if the table was loaded,
+   in which case the file is closed; zero if the table is not to be used; and
+   -1 on a hard error. */
+static int CSloadJgd2kMeshHash (struct cs_Japan_ *thisPtr)
+{
+	extern struct cs_Metrics_ csMetrics;
+
+	size_t rdCnt;
+	long32_t fileSize;
+	ulong32_t recIdx;
+	ulong32_t recCount;
+	ulong32_t hashSize;
+	ulong32_t slot;
+
+	struct csJgd2kGridRecord_ gridRec;
+
+	if (CS_fseek (thisPtr->strm,0L,SEEK_END) != 0)
+	{
+		CS_erpt (cs_IOERR);
+		return -1;
+	}
+	fileSize = (long32_t)CS_ftell (thisPtr->strm);
+	if (fileSize < 0L || thisPtr->bufferSize < fileSize)
+	{
+		return 0;
+	}
+
+	/* The first two records are the min/max records, which are not part of
+	   the grid. */
+	recCount = (ulong32_t)fileSize / sizeof (struct csJgd2kGridRecord_);
+	if (recCount < 2UL)
+	{
+		CS_erpt (cs_INV_FILE);
+		return -1;
+	}
+	recCount -= 2UL;
+
+	/* Keep the load factor at or below one half. */
+	hashSize = 16UL;
+	while (hashSize < (recCount + recCount)) hashSize += hashSize;
+	thisPtr->meshHash = (struct csJgd2kGridRecord_ *)CS_malc (hashSize * sizeof (struct csJgd2kGridRecord_));
+	if (thisPtr->meshHash == NULL)
+	{
+		/* Not fatal, we simply continue to use the file. */
+		return 0;
+	}
+	memset (thisPtr->meshHash,'\0',hashSize * sizeof (struct csJgd2kGridRecord_));
+	thisPtr->hashMask = hashSize - 1UL;
+
+	if (CS_fseek (thisPtr->strm,(long)(2 * sizeof (struct csJgd2kGridRecord_)),SEEK_SET) != 0)
+	{
+		CS_erpt (cs_IOERR);
+		goto error;
+	}
+	for (recIdx = 0UL;recIdx < recCount;recIdx += 1UL)
+	{
+		rdCnt = CS_fread (&gridRec,1,sizeof (gridRec),thisPtr->strm);
+		csMetrics.gridReads += 1;
+		csMetrics.gridBytes += rdCnt;
+		if (rdCnt != sizeof (gridRec))
+		{
+			CS_erpt (cs_IOERR);
+			goto error;
+		}
+		if (gridRec.meshCode == 0UL) continue;
+		slot = CSjgd2kMeshHashSlot (gridRec.meshCode,thisPtr->hashMask);
+		while (thisPtr->meshHash [slot].meshCode != 0UL &&
+			   thisPtr->meshHash [slot].meshCode != gridRec.meshCode)
+		{
+			slot = (slot + 1UL) & thisPtr->hashMask;
+		}
+		thisPtr->meshHash [slot] = gridRec;
+	}
+
+	/* Everything we need is in memory now. */
+	CS_fclose (thisPtr->strm);
+	thisPtr->strm = NULL;
+	return 1;
+
+error:
+	CS_free (thisPtr->meshHash);
+	thisPtr->meshHash = NULL;
+	thisPtr->hashMask = 0UL;
+	return -1;
+}
+/* Locates the record for the given mesh code, either in the hash table if it
+   has been loaded, or in the binary file.  Returns 1 if found, 0 if the mesh
+   code is not in the file, -1 on error. */
+static int CSfindJgd2kGridRecord (struct cs_Japan_ *thisPtr,ulong32_t meshCode,struct csJgd2kGridRecord_ *gridRec)
+{
+	extern struct cs_Metrics_ csMetrics;
+
+	int flag;
+	size_t rdCnt;
+	long32_t startFP;
+	ulong32_t slot;
+
+	struct csJgd2kGridRecord_ srchKey;
+
+	csMetrics.gridLookups += 1;
+	if (thisPtr->meshHash != NULL)
+	{
+		slot = CSjgd2kMeshHashSlot (meshCode,thisPtr->hashMask);
+		while (thisPtr->meshHash [slot].meshCode != 0UL)
+		{
+			if (thisPtr->meshHash [slot].meshCode == meshCode)
+			{
+				*gridRec = thisPtr->meshHash [slot];
+				return 1;
+			}
+			slot = (slot + 1UL) & thisPtr->hashMask;
+		}
+		return 0;
+	}
+
+	/* The first two records in the binary image are the min/max of the file
+	   coverage.  Thus, we instruct the binary search function to use the
+	   third record as the front end of the binary search using the startFP
+	   variable. */
+	csMetrics.gridMisses += 1;
+	startFP = sizeof (struct csJgd2kGridRecord_) + sizeof (struct csJgd2kGridRecord_);
+	srchKey.meshCode = meshCode;
+	CStraceBgn (cs_TRACE_GRIDREAD,thisPtr->binaryPath);
+	flag = CS_bins (thisPtr->strm,startFP,-1L,sizeof (struct csJgd2kGridRecord_),&srchKey,(CMPFUNC_CAST)CScompareJgd2kGridRecord);
+	if (flag > 0)
+	{
+		rdCnt = CS_fread (gridRec,1,sizeof (struct csJgd2kGridRecord_),thisPtr->strm);
+		csMetrics.gridReads += 1;
+		csMetrics.gridBytes += rdCnt;
+		if (rdCnt != sizeof (struct csJgd2kGridRecord_))
+		{
+			CS_erpt (cs_IOERR);
+			flag = -1;
+		}
+	}
+	CStraceEnd (cs_TRACE_GRIDREAD,thisPtr->binaryPath,(flag < 0) ? -1 : 0);
+	return flag;
+}
 /* Given a lat/long, we extract the grid cell which covers the point. */
 int CSextractJgd2kGridFile (struct cs_Japan_ *thisPtr,Const double* sourceLL)
 {
@@ -537,16 +726,13 @@ int CSextractJgd2kGridFile (struct cs_Japan_ *thisPtr,Const double* sourceLL)
 	extern double cs_Sec2Deg;
 
 	int flag;
-	size_t rdCnt;
 
-	long32_t startFP;
 	ulong32_t meshCode;
 	ulong32_t iLng, iLat;
 
 	double density;
 	double swLL [2], seLL [2], neLL [2], nwLL [2];
 
-	struct csJgd2kGridRecord_ srchKey;
 	struct csJgd2kGridRecord_ swRec, seRec, neRec, nwRec;
 
 	/* If the cuirrent grid cell objects saved within this object cover
@@ -561,8 +747,10 @@ int CSextractJgd2kGridFile (struct cs_Japan_ *thisPtr,Const double* sourceLL)
 		   
 		   Since we already have the appropriate grid cell available, we're
 		   done.  */
+		thisPtr->cellHits += 1UL;
 		return csGRIDI_ST_OK;
 	}
+	thisPtr->cellMisses += 1UL;
 
 	/* Ok, the provided point is not in the same cell as the last point.  We
 	   have lots of work to do; but only if the point provided is within the
@@ -578,31 +766,39 @@ int CSextractJgd2kGridFile (struct cs_Japan_ *thisPtr,Const double* sourceLL)
 		return csGRIDI_ST_COVERAGE;
 	}
 
-	/* Open the binary image file if is isn't open already. */
-	if (thisPtr->strm == NULL)
+	/* Open the binary image file if is isn't open already, and we haven't
+	   loaded the whole thing into memory. */
+	if (thisPtr->strm == NULL && thisPtr->meshHash == NULL)
 	{
 		/* Open the binary file, since it isn't open already. */
+		CStraceBgn (cs_TRACE_GRIDOPEN,thisPtr->binaryPath);
 		thisPtr->strm = CS_fopen (thisPtr->binaryPath,_STRM_BINRD);
+		CStraceEnd (cs_TRACE_GRIDOPEN,thisPtr->binaryPath,(thisPtr->strm != NULL) ? 0 : -1);
 		if (thisPtr->strm == NULL)
 		{
 			CS_stncp (csErrnam,thisPtr->binaryPath,MAXPATH);
 			CS_erpt (cs_DTC_FILE);
 			return csGRIDI_ST_SYSTEM;
 		} 
-	}
 
-	/* Note, we don't use a buffer (anymore, we used to).  If bufferSize
-	   is not zero, we instuct the OS to use a buffer of the indicated size. */
-	if (thisPtr->bufferSize > 128L /*&& thisPtr->dataBuffer == NULL*/)
-	{
-		setvbuf (thisPtr->strm,NULL,_IOFBF,(size_t)thisPtr->bufferSize);
-	}
+		/* Note, we don't use a buffer (anymore, we used to).  If bufferSize
+		   is not zero, we instuct the OS to use a buffer of the indicated
+		   size. */
+		if (thisPtr->bufferSize > 128L /*&& thisPtr->dataBuffer == NULL*/)
+		{
+			setvbuf (thisPtr->strm,NULL,_IOFBF,(size_t)thisPtr->bufferSize);
+		}
 
-	/* The first two records in the binary image are the min/max of the file
-	   coverage.  Thus, we instruct the binary search function to use the
-	   thrid record as the front end of the binary search using the startFP
-	   variable. */
-	startFP = sizeof (struct csJgd2kGridRecord_) + sizeof (struct csJgd2kGridRecord_);
+		/* If the buffer size is large enough to hold the entire file, we
+		   load it into a hash table and no further I/O is required. */
+		CStraceBgn (cs_TRACE_GRIDREAD,thisPtr->binaryPath);
+		flag = CSloadJgd2kMeshHash (thisPtr);
+		CStraceEnd (cs_TRACE_GRIDREAD,thisPtr->binaryPath,(flag < 0) ? -1 : 0);
+		if (flag < 0)
+		{
+			return csGRIDI_ST_SYSTEM;
+		}
+	}
 
 	/* Locate and read the four corners.  This is quite brutal, but
 	   this is the only general way to determine coverage is to see
@@ -627,16 +823,9 @@ int CSextractJgd2kGridFile (struct cs_Japan_ *thisPtr,Const double* sourceLL)
 	iLng = (ulong32_t)CS_degToSec (swLL [0]);
 	iLat = (ulong32_t)CS_degToSec (swLL [1]);
 
-	srchKey.meshCode = meshCode;
-	flag = CS_bins (thisPtr->strm,startFP,-1L,sizeof (struct csJgd2kGridRecord_),&srchKey,(CMPFUNC_CAST)CScompareJgd2kGridRecord);
+	flag = CSfindJgd2kGridRecord (thisPtr,meshCode,&swRec);
 	if (flag < 0) return -1;
 	if (!flag) return 1;			/* mesh code does not exist in the file, thus no coverage for this point */
-	rdCnt = CS_fread (&swRec,1,sizeof (swRec),thisPtr->strm);
-	if (rdCnt != sizeof (swRec))
-	{
-		CS_erpt (cs_IOERR);
-		return csGRIDI_ST_SYSTEM;
-	}
 
 	/* Now for the southeast corner of the cell. */
 	iLng += 45;
@@ -644,16 +833,9 @@ int CSextractJgd2kGridFile (struct cs_Japan_ *thisPtr,Const double* sourceLL)
 	seLL [1] = (double)iLat * cs_Sec2Deg;
 	meshCode = CSjpnLlToMeshCode (seLL);
 	if (meshCode == 0UL) return -1;
-	srchKey.meshCode = meshCode;
-	flag = CS_bins (thisPtr->strm,0L,-1L,sizeof (struct csJgd2kGridRecord_),&srchKey,(CMPFUNC_CAST)CScompareJgd2kGridRecord);
+	flag = CSfindJgd2kGridRecord (thisPtr,meshCode,&seRec);
 	if (flag < 0) return -1;
 	if (!flag) return 1;			/* mesh code does not exist in the file, thus no coverage for this point */
-	rdCnt = CS_fread (&seRec,1,sizeof (seRec),thisPtr->strm);
-	if (rdCnt != sizeof (seRec))
-	{
-		CS_erpt (cs_IOERR);
-		return csGRIDI_ST_SYSTEM;
-	}
 
 	/* The northeast corner of the grid cell. */
 	iLat += 30;
@@ -661,16 +843,9 @@ int CSextractJgd2kGridFile (struct cs_Japan_ *thisPtr,Const double* sourceLL)
 	neLL [1] = (double)iLat * cs_Sec2Deg;
 	meshCode = CSjpnLlToMeshCode (neLL);
 	if (meshCode == 0UL) return -1;
-	srchKey.meshCode = meshCode;
-	flag = CS_bins (thisPtr->strm,0L,-1L,sizeof (struct csJgd2kGridRecord_),&srchKey,(CMPFUNC_CAST)CScompareJgd2kGridRecord);
+	flag = CSfindJgd2kGridRecord (thisPtr,meshCode,&neRec);
 	if (flag < 0) return -1;
 	if (!flag) return 1;			/* mesh code does not exist in the file, thus no coverage for this point */
-	rdCnt = CS_fread (&neRec,1,sizeof (neRec),thisPtr->strm);
-	if (rdCnt != sizeof (neRec))
-	{
-		CS_erpt (cs_IOERR);
-		return csGRIDI_ST_SYSTEM;
-	}
 
 	/* Finally, the northwest corner of the grid cell. */
 	iLng -= 45;
@@ -678,16 +853,9 @@ int CSextractJgd2kGridFile (struct cs_Japan_ *thisPtr,Const double* sourceLL)
 	nwLL [1] = (double)iLat * cs_Sec2Deg;
 	meshCode = CSjpnLlToMeshCode (nwLL);
 	if (meshCode == 0UL) return -1;
-	srchKey.meshCode = meshCode;
-	flag = CS_bins (thisPtr->strm,0L,-1L,sizeof (struct csJgd2kGridRecord_),&srchKey,(CMPFUNC_CAST)CScompareJgd2kGridRecord);
+	flag = CSfindJgd2kGridRecord (thisPtr,meshCode,&nwRec);
 	if (flag < 0) return -1;
 	if (!flag) return 1;			/* mesh code does not exist in the file, thus no coverage for this point */
-	rdCnt = CS_fread (&nwRec,1,sizeof (nwRec),thisPtr->strm);
-	if (rdCnt != sizeof (nwRec))
-	{
-		CS_erpt (cs_IOERR);
-		return csGRIDI_ST_SYSTEM;
-	}
 
 	/* If we're still here, we have all four corners and finally, at last,
 	   know that we have coverage for the provided point. */
@@ -155,14 +155,29 @@ double EXP_LVL9 CSkrovkB3 (Const struct cs_Krovk_ *krovk,double latS)
 	int itrMax;
 	double latE;
 	double lastLatE;
+	double chi;
+	double e4, e6, e8;
 	double Q;
 	double tmp1;
 	double tmp2;
 
 	tmp1 = tan (cs_Pi_o_4 + latS * cs_Half);
 	tmp1 = (log (tmp1) - krovk->logK) / krovk->alpha;
-	latE = krovk->orgLat;
-	itrMax = 10;			/* usually 4 or 5 does it */
+
+	/* tmp1 is the isometric latitude.  Rather than start the iteration at
+	   the origin latitude, we start with the conformal latitude adjusted by
+	   the usual series expansion for the geodetic latitude.  This is good
+	   to better than 1.0E-12 radians for the Bessel ellipsoid, so the
+	   iteration below normally terminates after a single pass. */
+	chi = cs_Two * atan (exp (tmp1)) - cs_Pi_o_2;
+	e4 = krovk->e_sq * krovk->e_sq;
+	e6 = e4 * krovk->e_sq;
+	e8 = e4 * e4;
+	latE = chi + (krovk->e_sq * cs_Half + e4 * (5.0 / 24.0) + e6 / 12.0 + e8 * (13.0 / 360.0)) * sin (cs_Two * chi)
+			   + (e4 * (7.0 / 48.0) + e6 * (29.0 / 240.0) + e8 * (811.0 / 11520.0)) * sin (4.0 * chi)
+			   + (e6 * (7.0 / 120.0) + e8 * (81.0 / 1120.0)) * sin (6.0 * chi)
+			   + (e8 * (4279.0 / 161280.0)) * sin (8.0 * chi);
+	itrMax = 10;
 	do
 	{
 		lastLatE = latE;
@@ -56,6 +56,9 @@
 	Calculations:
 		int CScalcMgrsFromLl (struct cs_Mgrs_ *__This,char *result,int size,double latLng [2],int prec)
 		int CScalcLlFromMgrs (struct cs_Mgrs_ *__This,double latLng [2],Const char *mgrsString)
+		int CScalcMgrsFromLlArray (struct cs_Mgrs_ *__This,char *results,int size,Const double latLng [][2],int cnt,int prec,int status [])
+		int CScalcLlFromMgrsArray (struct cs_Mgrs_ *__This,double latLng [][2],Const char *mgrsStrings [],int cnt,short grdSqrPos,int status [])
+		int CScalcUtmUpsArray (struct cs_Mgrs_ *__This,double utmUps [][2],Const double latLng [][2],int cnt,int utmZones [])
 
 
 	Internal Support:
@@ -75,17 +78,29 @@
 		double latLng [2];			longitude [0] and latitude [1] in degrees.
 		char *mgrsString;			MGRS string to be converted.
 		double utmUPS [2];			X [0] and Y [1] of either UTM or UPS coordinates.
+		int utmZones [];			utmZone of each point returned here; zero for failure.
 		int utmZone;				carries UTM zone number: positive for northern hemisphere,
 									negative for southern hemisphere, +61 for North UPS, and
 									-61 of south UPS.  Zero is an invalid number.
 		int prec;					number of digits in each element of MGRS numeric portion,
 									0 thru 5.
+		int cnt;					number of points/strings in the array arguments.
+		char *results;				array of cnt result slots, each size characters long.
+		char *mgrsStrings [];		array of cnt MGRS strings to be converted.
+		int status [];				status of each individual conversion returned here, the
+									same value the single point function returns; may be NULL.
 
 	Note, CScalcUtmUps returns a utmZone value; zero to indicate an error.  Constructors
 	return NULL for an error.  All other functions return zero for OK, -1 for error.
 
 	CScalcLlFromMgrs will return a +1 if the resulting longitude is not in the
 	same zone as the string indicates.
+
+	The array functions return the number of points which could not be
+	converted.  An MGRS object carries no state from one conversion to the
+	next, so separate objects may be used concurrently; all results other
+	than the error reporting (CS_erpt) are confined to the object and the
+	caller's arguments.
 */
 
 /*lint -e784 */ /* Nul character truncated from caracater array */
@@ -136,6 +151,23 @@ static const char csMgrsPolarNorth [2][15] =
 };
 static const char csMgrsBaseLat [21] = "CDEFGHJKLMNPQRSTUVWX";
 
+/* With the exception of the polar tables, the above letter sets are all
+   consecutive runs of the 24 letter MGRS alphabet (i.e. A thru Z, skipping
+   I and O).  Thus, a letter can be converted to its table index with a
+   little arithmetic rather than a search.  This function returns the
+   position of a letter in the MGRS alphabet, -1 if the character is not
+   an MGRS letter. */
+static int CSmgrsLtrIdx (char cc)
+{
+	int idx;
+
+	if (cc < 'A' || cc > 'Z' || cc == 'I' || cc == 'O') return -1;
+	idx = cc - 'A';
+	if (cc > 'I') idx -= 1;
+	if (cc > 'O') idx -= 1;
+	return idx;
+}
+
 /* Round off value for the different possible precision values. */
 static const double csMgrsRoundOff [6] =
 {
@@ -183,6 +215,8 @@ struct cs_Mgrs_ *CSnewMgrs (double e_rad,double e_sq,short bessel)
 	extern double cs_Two;					/* 2.0    */
 	extern double cs_Degree;				/* 2 * Pi / 180.0 */
 
+	int idx;
+
 	struct cs_Mgrs_ *__This;
 
 	double tmp1, tmp2;
@@ -289,6 +323,17 @@ struct cs_Mgrs_ *CSnewMgrs (double e_rad,double e_sq,short bessel)
 	__This->SouthHemi.delta3 = cs_Zero;
 	__This->SouthHemi.delta4 = cs_Zero;
 
+	/* Northing of the southern edge of each latitude band, at the central
+	   meridian.  Used to choose the starting 2,000,000 meter cycle when
+	   converting an MGRS string. */
+	for (idx = 0;idx < 20;idx += 1)
+	{
+		tmp1 = (double)((idx * 8) - 80) * cs_Degree;
+		tmp2 = CSmmFcal (&__This->NorthHemi.mmcofF,tmp1,sin (tmp1),cos (tmp1)) - __This->NorthHemi.M0;
+		__This->BandNorthing [idx] = tmp2 * 0.9996;
+		if (idx < 10) __This->BandNorthing [idx] += 10000000.0;
+	}
+
 	/* North polar UPS */
 	__This->NorthPole.org_lng =  0.0;
 	__This->NorthPole.org_lat = 90.0 * cs_Degree;
@@ -382,6 +427,39 @@ void CSdeleteMgrs (struct cs_Mgrs_ *__This)
 	}
 }
 
+/* Returns the signed UTM zone number, or +/-61 for UPS, appropriate for
+   the given geographic coordinate; zero if it is not a valid
+   geographic coordinate. */
+static int CSmgrsUtmZone (Const double latLng [2])
+{
+	int utmZone;
+
+	if (latLng [LAT] <  -90.0 || latLng [LAT] >  90.0 ||
+		latLng [LNG] < -180.0 || latLng [LNG] > 180.0)
+	{
+		return 0;
+	}
+	if (latLng [LAT] < -80.0) return -61;
+	if (latLng [LAT] >  84.0) return  61;
+
+	utmZone = CS_utmzon (latLng [LNG]);
+
+	/* Apply the Norway/Svaldberg kludge. */
+	if (latLng [LAT] >= 56.0 && latLng [LAT] < 64.0 &&
+		latLng [LNG] >=  3.0 && latLng [LNG] < 12.0)
+	{
+		utmZone = 32;
+	}
+	if (latLng [LAT] >= 72.0 && latLng [LNG] >= 0.0 && latLng [LNG] < 42.0)
+	{
+		if      (latLng [LNG] <  9.0) utmZone = 31;
+		else if (latLng [LNG] < 21.0) utmZone = 33;
+		else if (latLng [LNG] < 33.0) utmZone = 35;
+		else						  utmZone = 37;
+	}
+	return (latLng [LAT] >= 0.0) ? utmZone : -utmZone;
+}
+
 int CScalcUtmUps (struct cs_Mgrs_ *__This,double utmUps [2],double latLng [2])
 {
 	extern int csErrlng;
@@ -391,9 +469,9 @@ int CScalcUtmUps (struct cs_Mgrs_ *__This,double utmUps [2],double latLng [2])
 	int status;
 	int utmZone;
 
-	/* Check the input arguments. */
-	if (latLng [LAT] <  -90.0 || latLng [LAT] >  90.0 ||
-		latLng [LNG] < -180.0 || latLng [LNG] > 180.0)
+	/* Check the input arguments, and figure out the zone. */
+	utmZone = CSmgrsUtmZone (latLng);
+	if (utmZone == 0)
 	{
 		csErrlng = (fabs (latLng [LNG]) >= 1000.0) ? 999 : (int)latLng [LNG];
 		csErrlat = (fabs (latLng [LAT]) >= 1000.0) ? 999 : (int)latLng [LAT];
@@ -401,52 +479,26 @@ int CScalcUtmUps (struct cs_Mgrs_ *__This,double utmUps [2],double latLng [2])
 		return 0;
 	}
 
-	/* Four different cases, depends upon the latitude of the point to
-	   be converted. */
-	if (latLng [LAT] < -80.0)
+	/* Four different cases, depends upon the zone. */
+	if (utmZone == -61)
 	{
 		/* South polar UPS */
 		status = CSpstroF (&__This->SouthPole,utmUps,latLng);
-		utmZone = -61;
 	}
-	else if (latLng [LAT] > 84.0)
+	else if (utmZone == 61)
 	{
 		/* North polar UPS */
 		status = CSpstroF (&__This->NorthPole,utmUps,latLng);
-		utmZone = 61;
+	}
+	else if (utmZone > 0)
+	{
+		__This->NorthHemi.cent_lng = (double)(-183 + (6 * utmZone)) * cs_Degree;
+		status = CStrmerF (&__This->NorthHemi,utmUps,latLng);
 	}
 	else
 	{
-		/* Transverse Mercator.  This one is a little harder.
-		   Figure out the appropriate central meridian. */
-		utmZone = CS_utmzon (latLng [LNG]);
-
-		/* Apply the Norway/Svaldberg kludge. */
-		if (latLng [LAT] >= 56.0 && latLng [LAT] < 64.0 &&
-		    latLng [LNG] >=  3.0 && latLng [LNG] < 12.0)
-		{
-			utmZone = 32;
-		}
-		if (latLng [LAT] >= 72.0 && latLng [LNG] >= 0.0 && latLng [LNG] < 42.0)
-		{
-			if      (latLng [LNG] <  9.0) utmZone = 31;
-			else if (latLng [LNG] < 21.0) utmZone = 33;
-			else if (latLng [LNG] < 33.0) utmZone = 35;
-			else						  utmZone = 37;
-		}   
-
-		/* Do the calculation. */
-		if (latLng [LAT] >= 0.0)
-		{
-			__This->NorthHemi.cent_lng = (double)(-183 + (6 * utmZone)) * cs_Degree;
-			status = CStrmerF (&__This->NorthHemi,utmUps,latLng);
-		}
-		else
-		{
-			__This->SouthHemi.cent_lng = (double)(-183 + (6 * utmZone)) * cs_Degree;
-			status = CStrmerF (&__This->SouthHemi,utmUps,latLng);
-			utmZone = -utmZone;
-		}
+		__This->SouthHemi.cent_lng = (double)(-183 - (6 * utmZone)) * cs_Degree;
+		status = CStrmerF (&__This->SouthHemi,utmUps,latLng);
 	}
 	if (status != 0)
 	{
@@ -647,8 +699,17 @@ int CScalcMgrsFromLlUtm (struct cs_Mgrs_ *__This,char *result,int size,double la
 		*rsltPtr++ = setPtr [setIdx].easting [idxX];
 		*rsltPtr++ = setPtr [setIdx].northing [idxY];
 	}
-	sprintf (utmXascii,"%05d",(int)(intUtmX % 100000));
-	sprintf (utmYascii,"%05d",(int)(intUtmY % 100000));
+	/* Equivalent to sprintf ("%05d") and taking the first prec digits;
+	   the coordinates are known to be positive at this point. */
+	intUtmX %= 100000;
+	intUtmY %= 100000;
+	for (ii = 4;ii >= 0;ii -= 1)
+	{
+		utmXascii [ii] = (char)('0' + (intUtmX % 10));
+		utmYascii [ii] = (char)('0' + (intUtmY % 10));
+		intUtmX /= 10;
+		intUtmY /= 10;
+	}
 	for (ii = 0;ii < prec;ii += 1)
 	{
 		*rsltPtr++ = utmXascii [ii];
@@ -682,11 +743,12 @@ int CScalcLlFromMgrsEx (struct cs_Mgrs_ *__This,double latLng [2],Const char *mg
 	int utmZone, utmZone1;
 	int idx, idxX, idxY;
 	int baseLat, maximumLat;
+	int bandIdx;
+	long32_t cycles;
 	long32_t multiplier;
 	long32_t xBase, yBase;
 	char *mgrsPtr;
 	const char *chrPtr;
-	const struct csMgrsSet_ *setPtr;
 	double utmUps [2];
 	double grdSqrVector [2];
 	char mgrs [64];
@@ -932,8 +994,7 @@ int CScalcLlFromMgrsEx (struct cs_Mgrs_ *__This,double latLng [2],Const char *mg
 	} 
 	else if (cc >= '0' && cc <= '9')
 	{
-		/* This is where the real fun begins.  Select the character set to use. */
-		setPtr = (__This->Bessel) ? csMgrsSetsBessel : csMgrsSetsNormal;
+		/* This is where the real fun begins. */
 
 		/* Extract the zone number. Can be one or two digits, possible
 		   zero fill.  Note, that it is expected that the zone number
@@ -958,6 +1019,15 @@ int CScalcLlFromMgrsEx (struct cs_Mgrs_ *__This,double latLng [2],Const char *mg
 			mgrsPtr = &mgrs [1];
 		}
 
+		/* A zero zone number, or one greater than 60, would cause the
+		   cycle search below to loop forever. */
+		if (utmZone < 1 || utmZone > 60)
+		{
+			CS_stncp (csErrnam,mgrs,sizeof (mgrs));
+			CS_erpt (cs_MGRS_STRB);
+			goto error;
+		}
+
 		/* We check for the strange stuff.  */
 		if (*mgrsPtr == 'X' &&
 		    (utmZone == 32 || utmZone == 34 || utmZone == 36)
@@ -970,13 +1040,10 @@ int CScalcLlFromMgrsEx (struct cs_Mgrs_ *__This,double latLng [2],Const char *mg
 
 		/* Resolve the 8 degree latitude block designation.  That is, the
 		   base latitude for the specific cell. */
-		for (idx = 0;idx < 20;idx += 1)
-		{
-			if (csMgrsBaseLat [idx] == *mgrsPtr) break;
-		}
+		idx = CSmgrsLtrIdx (*mgrsPtr) - 2;		/* 'C' is the first band */
 
 		/* Throw an error if the first non-zone char is not legit. */
-		if (idx >= 20)
+		if (idx < 0 || idx >= 20)
 		{
 			CS_stncp (csErrnam,mgrs,sizeof (mgrs));
 			CS_erpt (cs_MGRS_STR6);
@@ -995,17 +1062,15 @@ int CScalcLlFromMgrsEx (struct cs_Mgrs_ *__This,double latLng [2],Const char *mg
 			goto error;
 		}
 		maximumLat = (baseLat == 72) ? baseLat + 12 : baseLat + 8;
+		bandIdx = idx;
 		mgrsPtr += 1;
 
 		/* Locate the zone codes and adjust xBase and yBase appropriately.
 		   Note, xBase and yBase are eventually multipled by 100,000 to
 		   form the base for the UTM coordinate. */
 		setIdx = (utmZone - 1) % 6;
-		for (idxX = 0;idxX < 8;idxX += 1)
-		{
-			if (setPtr [setIdx].easting [idxX] == *mgrsPtr) break;
-		}
-		if (idxX >= 8)
+		idxX = (setIdx < 0) ? -1 : CSmgrsLtrIdx (*mgrsPtr) - ((setIdx % 3) * 8);
+		if (idxX < 0 || idxX >= 8)
 		{
 			/* Oops!!! Invalid letter.  Could be a zone screw up,
 			   Perhaps we're using the wrong character set. */
@@ -1016,10 +1081,18 @@ int CScalcLlFromMgrsEx (struct cs_Mgrs_ *__This,double latLng [2],Const char *mg
 		mgrsPtr += 1;
 		idxX += 1;					/* A/F == 100,000.00 */
 
-		/* Now for idxY. */
-		for (idxY = 0;idxY < 20;idxY += 1)
+		/* Now for idxY.  The northing letters are A thru V, and each set
+		   starts at a different letter (see the tables above). */
+		idxY = CSmgrsLtrIdx (*mgrsPtr);
+		if (idxY >= 0 && idxY < 20)
+		{
+			idxY -= (__This->Bessel) ? 10 : 0;
+			idxY -= (setIdx & 1) ? 5 : 0;
+			if (idxY < 0) idxY += 20;
+		}
+		else
 		{
-			if (setPtr [setIdx].northing [idxY] == *mgrsPtr) break;
+			idxY = 20;
 		}
 		if (idxY >= 20)
 		{
@@ -1107,6 +1180,16 @@ int CScalcLlFromMgrsEx (struct cs_Mgrs_ *__This,double latLng [2],Const char *mg
 		   to get the resulting latitude to fall in the right cell
 		   per the first letter of the MGRS string. */
 		if (baseLat < 0.0) utmZone = -utmZone;
+
+		/* Skip the cycles which cannot possibly reach the base latitude;
+		   each one costs an inverse Transverse Mercator calculation.  We
+		   stop one cycle short of the estimate as the northing of the base
+		   latitude varies a bit across the zone. */
+		cycles = (long32_t)((__This->BandNorthing [bandIdx] - utmUps [YY]) / 2000000.0) - 1;
+		if (cycles > 0)
+		{
+			utmUps [YY] += (double)cycles * 2000000.00;
+		}
 		for (;;)
 		{
 			/* Use our own little function which knows about the
@@ -1171,3 +1254,115 @@ int CScalcLlFromMgrsEx (struct cs_Mgrs_ *__This,double latLng [2],Const char *mg
 error:
 	return -1;
 }
+
+/* Array versions of CScalcMgrsFromLl and CScalcLlFromMgrsEx.  The results
+   of each element are the same as those of the single point function.
+   The results argument of CScalcMgrsFromLlArray is an array of cnt slots,
+   each size characters long.  Returns the number of elements which
+   failed, i.e. those for which the single point function would have
+   returned a negative value. */
+int CScalcMgrsFromLlArray (struct cs_Mgrs_ *__This,char *results,int size,Const double latLng [][2],int cnt,int prec,int status [])
+{
+	int idx;
+	int st;
+	int errCnt;
+	double lclLatLng [2];
+
+	errCnt = 0;
+	for (idx = 0;idx < cnt;idx += 1)
+	{
+		lclLatLng [LNG] = latLng [idx][LNG];
+		lclLatLng [LAT] = latLng [idx][LAT];
+		st = CScalcMgrsFromLl (__This,&results [idx * size],size,lclLatLng,prec);
+		if (st < 0) errCnt += 1;
+		if (status != NULL) status [idx] = st;
+	}
+	return errCnt;
+}
+
+/* Converts an array of geographic coordinates each to its own UTM zone,
+   or UPS, as CScalcUtmUps does, returning the signed zone number of each
+   point in utmZones (zero for a point which could not be converted).
+   The object holds set up Transverse Mercator parameters for each
+   hemisphere and polar stereographic parameters for each pole, so a
+   change of zone is a single store of the central meridian; this is
+   done only when the zone differs from that of the previous point. */
+int CScalcUtmUpsArray (struct cs_Mgrs_ *__This,double utmUps [][2],Const double latLng [][2],int cnt,int utmZones [])
+{
+	extern int csErrlng;
+	extern int csErrlat;
+	extern double cs_Degree;
+
+	int idx;
+	int st;
+	int zone;
+	int northZone;
+	int southZone;
+	int errCnt;
+	double lclLatLng [2];
+
+	errCnt = 0;
+	northZone = southZone = 0;
+	for (idx = 0;idx < cnt;idx += 1)
+	{
+		lclLatLng [LNG] = latLng [idx][LNG];
+		lclLatLng [LAT] = latLng [idx][LAT];
+		zone = CSmgrsUtmZone (lclLatLng);
+		if (zone == 0)
+		{
+			st = -1;
+		}
+		else if (zone == 61)
+		{
+			st = CSpstroF (&__This->NorthPole,utmUps [idx],lclLatLng);
+		}
+		else if (zone == -61)
+		{
+			st = CSpstroF (&__This->SouthPole,utmUps [idx],lclLatLng);
+		}
+		else if (zone > 0)
+		{
+			if (zone != northZone)
+			{
+				__This->NorthHemi.cent_lng = (double)(-183 + (6 * zone)) * cs_Degree;
+				northZone = zone;
+			}
+			st = CStrmerF (&__This->NorthHemi,utmUps [idx],lclLatLng);
+		}
+		else
+		{
+			if (zone != southZone)
+			{
+				__This->SouthHemi.cent_lng = (double)(-183 - (6 * zone)) * cs_Degree;
+				southZone = zone;
+			}
+			st = CStrmerF (&__This->SouthHemi,utmUps [idx],lclLatLng);
+		}
+		if (st != 0)
+		{
+			csErrlng = (fabs (lclLatLng [LNG]) >= 1000.0) ? 999 : (int)lclLatLng [LNG];
+			csErrlat = (fabs (lclLatLng [LAT]) >= 1000.0) ? 999 : (int)lclLatLng [LAT];
+			CS_erpt (cs_MGRS_LL);
+			zone = 0;
+			errCnt += 1;
+		}
+		utmZones [idx] = zone;
+	}
+	return errCnt;
+}
+
+int CScalcLlFromMgrsArray (struct cs_Mgrs_ *__This,double latLng [][2],Const char *mgrsStrings [],int cnt,short grdSqrPos,int status [])
+{
+	int idx;
+	int st;
+	int errCnt;
+
+	errCnt = 0;
+	for (idx = 0;idx < cnt;idx += 1)
+	{
+		st = CScalcLlFromMgrsEx (__This,latLng [idx],mgrsStrings [idx],grdSqrPos);
+		if (st < 0) errCnt += 1;
+		if (status != NULL) status [idx] = st;
+	}
+	return errCnt;
+}
@@ -374,6 +374,7 @@ int EXP_LVL7 CSmolodI2 (struct csMolod_* molod,double* trgLl,Const double* srcLl
 
 	/* If we didn't resolve in maxIteration tries, we issue a warning
 	   message.  Usually, three or four iterations does the trick. */
+	CSmetricsItr (ii,molod->maxIterations);
 	if (ii >= molod->maxIterations )
 	{
 		CS_erpt (cs_MO_CNVRG);
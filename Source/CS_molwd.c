@@ -273,6 +273,7 @@ int EXP_LVL9 CSmolwdF ( Const struct cs_Molwd_ *molwd,double xy [2],Const double
 	extern double cs_Pi_o_2;			/*  Pi over 2 */
 	extern double cs_Mpi_o_2;			/* -Pi over 2 */
 	extern double cs_Degree;			/*  1.0 / 57.23.... */
+	extern double cs_Third;				/*  1.0 / 3.0 */
 	extern double cs_NPTest;			/* 0.001 seconds of arc
 										   short of the north pole,
 										   in radians. */
@@ -286,6 +287,8 @@ int EXP_LVL9 CSmolwdF ( Const struct cs_Molwd_ *molwd,double xy [2],Const double
 	double del_lng;
 	double lat;				/* Provided latitude in radians. */
 	double sin_lat;
+	double abs_sin;
+	double tmp;
 
 	double xx;
 	double yy;
@@ -362,8 +365,26 @@ int EXP_LVL9 CSmolwdF ( Const struct cs_Molwd_ *molwd,double xy [2],Const double
 	}
 	else
 	{
+		/* The loop below solves for twice theta.  Rather than starting
+		   with the latitude, we start with the leading terms of the
+		   series for 2T + sin (2T) = pi * sin (lat) at the equator, and
+		   near the poles, respectively.  With t = pi * sin (lat) / 2, the
+		   equatorial series is 2T = t + t^3 / 12 + ...  This reduces the
+		   typical iteration count from five to three, and the worst
+		   case (near the poles) from eighteen to four. */
+		abs_sin = fabs (sin_lat);
+		if (abs_sin > 0.7)
+		{
+			theta = cs_Pi - pow (6.0 * cs_Pi * (cs_One - abs_sin),cs_Third);
+		}
+		else
+		{
+			tmp = cs_Half * cs_Pi * abs_sin;
+			theta = tmp + (tmp * tmp * tmp) / 12.0;
+		}
+		if (lat < 0.0) theta = -theta;
+
 		itr_cnt = 0;
-		theta = lat;
 		for (;;)
 		{
 			if (itr_cnt++ > 20)
@@ -57,14 +57,11 @@ int EXP_LVL9 CSmulrgS (struct cs_GxXform_* gxXfrm)
 	short uu;
 	short vv;
 	short idx;
-	short wrdIdx;
-	short bitNbr;
 	
 	int flag;
 
-	ulong32_t mask;
-
 	struct csMulrg_ *mulrg;
+	struct csMulrgTerm_ *term;
 
 	mulrg = &gxXfrm->xforms.mulrg;
 
@@ -80,12 +77,8 @@ int EXP_LVL9 CSmulrgS (struct cs_GxXform_* gxXfrm)
 
 	mulrg->max_uu = 0;
 	mulrg->max_vv = 0;
-	for (idx = 0;idx < 4;idx += 1)
-	{
-		mulrg->phiMap [idx]    = (ulong32_t)0;
-		mulrg->lambdaMap [idx] = (ulong32_t)0;
-		mulrg->heightMap [idx] = (ulong32_t)0;
-	}
+	mulrg->phiCnt = mulrg->lambdaCnt = mulrg->heightCnt = 0;
+	mulrg->fill02 = 0;
 
 	for (uu = 0;uu < 10;uu += 1)
 	{
@@ -97,27 +90,32 @@ int EXP_LVL9 CSmulrgS (struct cs_GxXform_* gxXfrm)
 			mulrg->lambdaCoefs [idx] = gxXfrm->gxDef.parameters.dmaMulRegParameters.coeffLambda [idx];
 			mulrg->heightCoefs [idx] = gxXfrm->gxDef.parameters.dmaMulRegParameters.coeffHeight [idx];
 
-			wrdIdx = idx >> 5;
-			bitNbr = idx & 0x1F;
-			mask = (ulong32_t)0x80000000L >> bitNbr;
-
 			if (mulrg->phiCoefs [idx] != 0.0)
 			{
 				if (uu > mulrg->max_uu) mulrg->max_uu = uu;
 				if (vv > mulrg->max_vv) mulrg->max_vv = vv;
-				mulrg->phiMap [wrdIdx] |= mask;
+				term = &mulrg->phiTerms [mulrg->phiCnt++];
+				term->idx = (unsigned char)idx;
+				term->uu = (unsigned char)uu;
+				term->vv = (unsigned char)vv;
 			}
 			if (mulrg->lambdaCoefs [idx] != 0.0)
 			{
 				if (uu > mulrg->max_uu) mulrg->max_uu = uu;
 				if (vv > mulrg->max_vv) mulrg->max_vv = vv;
-				mulrg->lambdaMap [wrdIdx] |= mask;
+				term = &mulrg->lambdaTerms [mulrg->lambdaCnt++];
+				term->idx = (unsigned char)idx;
+				term->uu = (unsigned char)uu;
+				term->vv = (unsigned char)vv;
 			}
 			if (mulrg->heightCoefs [idx] != 0.0)
 			{
 				if (uu > mulrg->max_uu) mulrg->max_uu = uu;
 				if (vv > mulrg->max_vv) mulrg->max_vv = vv;
-				mulrg->heightMap [wrdIdx] |= mask;
+				term = &mulrg->heightTerms [mulrg->heightCnt++];
+				term->idx = (unsigned char)idx;
+				term->uu = (unsigned char)uu;
+				term->vv = (unsigned char)vv;
 			}
 		}
 	}
@@ -209,25 +207,21 @@ int EXP_LVL9 CSmulrgF3 (struct csMulrg_ *mulrg,double* trgLl,Const double* srcLl
 	extern double cs_Sec2Deg;
 
 	short ii;
-	short jj;
-	short idx;
-	short wrdIdx;
-	short bitNbr;
 
 	int fbStatus;
 
-	ulong32_t mask;
-
 	double uu;
 	double vv;
-	double uu_pwr = 0.0;		// initialization to keep gcc compiler happy
-	double vv_pwr = 0.0;		// initialization to keep gcc compiler happy
 
 	double lngSum;
 	double latSum;
 	double hgtSum;
 
 	double myLl [3];
+	double uuPwr [cs_MULRG_MAXPWR];
+	double vvPwr [cs_MULRG_MAXPWR];
+
+	Const struct csMulrgTerm_ *term;
 
 	/* The default result is no conversion.  We also get a copy of the
 	   source coordinates in an array which we can modify. */
@@ -276,46 +270,33 @@ int EXP_LVL9 CSmulrgF3 (struct csMulrg_ *mulrg,double* trgLl,Const double* srcLl
 	   the delta values. */
 	lngSum = latSum = hgtSum = 0.0;
 
-	/* Start the loops necessary to perform the calculation. */
-	for (ii = 0;ii <= mulrg->max_uu;ii++)
+	/* Compute the powers of uu and vv once, by successive multiplication
+	   as always.  Then simply walk the lists of non-zero terms which
+	   CSmulrgS compiled for us.  The terms are in the order the original
+	   double loop visited them, so the sums are the same, bit for bit. */
+	uuPwr [0] = vvPwr [0] = cs_One;
+	for (ii = 1;ii <= mulrg->max_uu;ii++)
 	{
-		/* Compute the necessary uu power term for this
-		   iteration of the loop. */
-		if (ii == 0) uu_pwr  = cs_One;
-		else	     uu_pwr *= uu;						/*lint !e644 */
-		for (jj = 0;jj <= mulrg->max_vv;jj++)
-		{
-			/* Compute the necessary vv power term for this
-			   iteration of the loop. */
-			if (jj == 0) vv_pwr  = cs_One;
-			else	     vv_pwr *= vv;					/*lint !e644 */
-
-			/* Compute the bit map bit number for this
-			   iteration for both loops. */
-			idx = ii * 10 + jj;		/*lint !e734   too many bits for a short,  This works for MULREG! */
-			bitNbr = (idx & 0x1F);
-			wrdIdx = idx >> 5;
-			mask = (ulong32_t)0x80000000L >> bitNbr;
-
-			/* See if this term is in the longitude calculation. */
-			if ((mulrg->lambdaMap [wrdIdx] & mask) != 0)
-			{
-				/* Yes it is, compute the value. */
-				lngSum += mulrg->lambdaCoefs [idx] * uu_pwr * vv_pwr;
-			}
-
-			/* Same for the latitude. */
-			if ((mulrg->phiMap [wrdIdx] & mask) != 0)
-			{
-				latSum += mulrg->phiCoefs [idx] * uu_pwr * vv_pwr;
-			}
-
-			/* Same for the height. */
-			if ((mulrg->heightMap [wrdIdx] & mask) != 0)
-			{
-				hgtSum += mulrg->heightCoefs [idx] * uu_pwr * vv_pwr;
-			}
-		}
+		uuPwr [ii] = uuPwr [ii - 1] * uu;
+	}
+	for (ii = 1;ii <= mulrg->max_vv;ii++)
+	{
+		vvPwr [ii] = vvPwr [ii - 1] * vv;
+	}
+	term = mulrg->lambdaTerms;
+	for (ii = 0;ii < mulrg->lambdaCnt;ii++,term++)
+	{
+		lngSum += mulrg->lambdaCoefs [term->idx] * uuPwr [term->uu] * vvPwr [term->vv];
+	}
+	term = mulrg->phiTerms;
+	for (ii = 0;ii < mulrg->phiCnt;ii++,term++)
+	{
+		latSum += mulrg->phiCoefs [term->idx] * uuPwr [term->uu] * vvPwr [term->vv];
+	}
+	term = mulrg->heightTerms;
+	for (ii = 0;ii < mulrg->heightCnt;ii++,term++)
+	{
+		hgtSum += mulrg->heightCoefs [term->idx] * uuPwr [term->uu] * vvPwr [term->vv];
 	}
 
 	/* Compute the final results. */
@@ -428,6 +409,7 @@ int EXP_LVL9 CSmulrgI3 (struct csMulrg_ *mulrg,double* trgLl,Const double* srcLl
 	{
 		/* If we didn't resolve in maxIteration tries, we issue a warning
 		   message. */
+		CSmetricsItr (ii,mulrg->maxIterations);
 		if (ii >= mulrg->maxIterations)
 		{
 			CS_erpt (cs_WGS_CNVRG);
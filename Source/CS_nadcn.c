@@ -387,8 +387,49 @@ int CSnadcnF3 (struct cs_Nadcn_ *nadcn,double *ll_trg,Const double *ll_src)
 
 	return status;
 }
+/* Builds the shift cell which CSnadcnF2 used at the point ll from the
+   cells left behind in the two grid files.  Returns FALSE if they are not
+   usable, in which case the inverse takes the fixed point step. */
+static int CSnadcnShiftCell (struct cs_Nadcn_ *nadcn,struct csGridShiftCell_ *shiftCell,Const double *ll)
+{
+	extern double cs_K360;
+	extern double cs_Sec2Deg;
+
+	struct csGridCell_ *lngCell;
+	struct csGridCell_ *latCell;
+
+	if (nadcn->lngShift == NULL || nadcn->latShift == NULL) return FALSE;
+	if (!nadcn->lngShift->cellIsValid || !nadcn->latShift->cellIsValid) return FALSE;
+	lngCell = &nadcn->lngShift->currentCell;
+	latCell = &nadcn->latShift->currentCell;
+	if (lngCell->coverage.southWest [LNG] != latCell->coverage.southWest [LNG] ||
+		lngCell->coverage.southWest [LAT] != latCell->coverage.southWest [LAT] ||
+		lngCell->deltaLng != latCell->deltaLng || lngCell->deltaLat != latCell->deltaLat)
+	{
+		return FALSE;
+	}
+
+	/* The Alaska kludge, see CSnadcnF2. */
+	shiftCell->origin [LNG] = lngCell->coverage.southWest [LNG];
+	if (ll [LNG] >= 166.0) shiftCell->origin [LNG] += cs_K360;
+	shiftCell->origin [LAT] = lngCell->coverage.southWest [LAT];
+	shiftCell->delta [LNG] = lngCell->deltaLng;
+	shiftCell->delta [LAT] = lngCell->deltaLat;
+
+	/* NADCON longitude shifts are west positive, in seconds. */
+	shiftCell->lngCoef [0] = -lngCell->currentAA * cs_Sec2Deg;
+	shiftCell->lngCoef [1] = -lngCell->currentBB * cs_Sec2Deg;
+	shiftCell->lngCoef [2] = -lngCell->currentCC * cs_Sec2Deg;
+	shiftCell->lngCoef [3] = -lngCell->currentDD * cs_Sec2Deg;
+	shiftCell->latCoef [0] =  latCell->currentAA * cs_Sec2Deg;
+	shiftCell->latCoef [1] =  latCell->currentBB * cs_Sec2Deg;
+	shiftCell->latCoef [2] =  latCell->currentCC * cs_Sec2Deg;
+	shiftCell->latCoef [3] =  latCell->currentDD * cs_Sec2Deg;
+	return TRUE;
+}
 int CSnadcnI2 (struct cs_Nadcn_ *nadcn,double *ll_trg,Const double *ll_src)
 {
+	extern double cs_Zero;
 	extern double cs_LlNoise;
 
 	short lng_ok;
@@ -400,6 +441,7 @@ int CSnadcnI2 (struct cs_Nadcn_ *nadcn,double *ll_trg,Const double *ll_src)
 	double guess [3];
 	double epsilon [2];
 	double newResult [3];
+	struct csGridShiftCell_ shiftCell;
 
 	status = -1;			/* Defensive, until we know differently. */
 
@@ -428,6 +470,25 @@ int CSnadcnI2 (struct cs_Nadcn_ *nadcn,double *ll_trg,Const double *ll_src)
 		/* See how far we are off. */
 		epsilon [LNG] = CS_lngEpsilon (ll_src [LNG],newResult [LNG]);
 		epsilon [LAT] = ll_src [LAT] - newResult [LAT];
+		if (fabs (epsilon [LNG]) <= nadcn->cnvrgValue &&
+			fabs (epsilon [LAT]) <= nadcn->cnvrgValue)
+		{
+			break;
+		}
+
+		/* Newton's method within the grid cell the forward just used.  The
+		   solution usually lies within that same cell, in which case the
+		   forward would reproduce ll_src exactly as the solution predicts
+		   and we are done.  Otherwise, the solution is our next guess. */
+		if (CSnadcnShiftCell (nadcn,&shiftCell,guess))
+		{
+			if (CSinvertShiftCell (&shiftCell,guess,ll_src,nadcn->cnvrgValue))
+			{
+				epsilon [LNG] = epsilon [LAT] = cs_Zero;
+				break;
+			}
+			continue;
+		}
 
 		/* If our guess at the longitude is off by more than
 		   small, we adjust our guess by the amount we are off. */
@@ -458,6 +519,7 @@ int CSnadcnI2 (struct cs_Nadcn_ *nadcn,double *ll_trg,Const double *ll_src)
 		   what we started with, we do maxIterations iterations, instead of the
 		   four that GRIDINT does.  Thus, there is room for a slight discrepancy
 		   between the two programs. */
+		CSmetricsItr (ii,nadcn->maxIterations);
 		if (ii >= nadcn->maxIterations)
 		{
 			status = csGRIDI_ST_COVERAGE;
@@ -668,7 +730,9 @@ struct cs_NadconFile_* CSnewNadconFile (Const char* filePath,long32_t bufferSize
 	}
 
 	/* Get the file information header. */
+	CStraceBgn (cs_TRACE_GRIDOPEN,thisPtr->filePath);
 	fstr = CS_fopen (thisPtr->filePath,_STRM_BINRD);
+	CStraceEnd (cs_TRACE_GRIDOPEN,thisPtr->filePath,(fstr != NULL) ? 0 : -1);
 	if (fstr == NULL)
 	{
 		CS_stncp (csErrnam,thisPtr->filePath,MAXPATH);
@@ -859,6 +923,7 @@ int CSextractNadconFile (struct cs_NadconFile_* thisPtr,Const double* sourceLL)
 {
 	extern double cs_LlNoise;			/* 1.0E-12 */
 	extern char csErrnam [MAXPATH];
+	extern struct cs_Metrics_ csMetrics;
 
 	int eleNbr;
 	int recNbr;
@@ -954,13 +1019,17 @@ int CSextractNadconFile (struct cs_NadconFile_* thisPtr,Const double* sourceLL)
 
 	/* See if the stuff we want is in the buffer.  Careful here, all of the intended
 	   range must be in the buffer, not just a portion of it. */
+	csMetrics.gridLookups += 1;
 	if (fposBegin < thisPtr->bufferBeginPosition || fposBegin > thisPtr->bufferEndPosition ||
 		fposEnd   < thisPtr->bufferBeginPosition || fposEnd   > thisPtr->bufferEndPosition)
 	{
 		/* The data we need is not there; we need to read it in.  Is the file open? */
+		csMetrics.gridMisses += 1;
 		if (thisPtr->strm == NULL)
 		{
+			CStraceBgn (cs_TRACE_GRIDOPEN,thisPtr->filePath);
 			thisPtr->strm = CS_fopen (thisPtr->filePath,_STRM_BINRD);
+			CStraceEnd (cs_TRACE_GRIDOPEN,thisPtr->filePath,(thisPtr->strm != NULL) ? 0 : -1);
 			if (thisPtr->strm == NULL)
 			{
 				CS_stncp (csErrnam,thisPtr->filePath,MAXPATH);
@@ -1062,7 +1131,11 @@ int CSextractNadconFile (struct cs_NadconFile_* thisPtr,Const double* sourceLL)
 			CS_erpt (cs_IOERR);
 			goto error;
 		}
+		CStraceBgn (cs_TRACE_GRIDREAD,thisPtr->filePath);
 		checkCount = (long32_t)CS_fread (thisPtr->dataBuffer,1,(size_t)readCount,thisPtr->strm);
+		CStraceEnd (cs_TRACE_GRIDREAD,thisPtr->filePath,(checkCount == readCount) ? 0 : -1);
+		csMetrics.gridReads += 1;
+		csMetrics.gridBytes += (size_t)checkCount;
 		if (checkCount != readCount)
 		{
 			CS_stncp (csErrnam,thisPtr->filePath,MAXPATH);
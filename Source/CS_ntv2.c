@@ -173,6 +173,37 @@ int CScntv2F3 (struct cs_NTv2_ *cntv2,double *ll_trg,Const double *ll_src)
 	}
 	return status;
 }
+/* Builds the shift cell which CScntv2F2 used at the point most recently
+   converted from the grid cells left behind by CScalcNTv2.  Returns FALSE
+   if there is no such cell, in which case the inverse takes the fixed point
+   step. */
+static int CScntv2ShiftCell (struct cs_NTv2_ *cntv2,struct csGridShiftCell_ *shiftCell)
+{
+	extern double cs_Sec2Deg;
+
+	struct csNTv2GridCell_ *lngCell;
+	struct csNTv2GridCell_ *latCell;
+
+	if (!cntv2->CellIsValid) return FALSE;
+	lngCell = &cntv2->longitudeCell;
+	latCell = &cntv2->latitudeCell;
+
+	/* NTv2 cells are referenced to the southeast corner, and longitude
+	   (including the longitude shift) is west positive. */
+	shiftCell->origin [LNG] = -lngCell->seCorner [LNG];
+	shiftCell->origin [LAT] =  lngCell->seCorner [LAT];
+	shiftCell->delta [LNG] = -lngCell->deltaLng;
+	shiftCell->delta [LAT] =  lngCell->deltaLat;
+	shiftCell->lngCoef [0] = -lngCell->currentAA * cs_Sec2Deg;
+	shiftCell->lngCoef [1] = -lngCell->currentBB * cs_Sec2Deg;
+	shiftCell->lngCoef [2] = -lngCell->currentCC * cs_Sec2Deg;
+	shiftCell->lngCoef [3] = -lngCell->currentDD * cs_Sec2Deg;
+	shiftCell->latCoef [0] =  latCell->currentAA * cs_Sec2Deg;
+	shiftCell->latCoef [1] =  latCell->currentBB * cs_Sec2Deg;
+	shiftCell->latCoef [2] =  latCell->currentCC * cs_Sec2Deg;
+	shiftCell->latCoef [3] =  latCell->currentDD * cs_Sec2Deg;
+	return TRUE;
+}
 /* The NTv2 format specifies the shift from one datum to another datum.  The
    only way to go the other way is the iterative technique used below.  As
    long as the transformation is continuous with out any sharp deviations,
@@ -191,6 +222,7 @@ int CScntv2I2 (struct cs_NTv2_ *cntv2,double *ll_trg,Const double *ll_src)
 	double guess [3];
 	double epsilon [2];
 	double newResult [3];
+	struct csGridShiftCell_ shiftCell;
 
 	epsilon [0] = epsilon [1] = cntv2->errorValue + cs_LlNoise;
 
@@ -235,6 +267,21 @@ int CScntv2I2 (struct cs_NTv2_ *cntv2,double *ll_trg,Const double *ll_src)
 		/* See how far we are off. */
 		epsilon [LNG] = CS_lngEpsilon (ll_src [LNG],newResult [LNG]);
 		epsilon [LAT] = ll_src [LAT] - newResult [LAT];
+		if (fabs (epsilon [LNG]) <= cntv2->cnvrgValue &&
+			fabs (epsilon [LAT]) <= cntv2->cnvrgValue)
+		{
+			break;
+		}
+
+		/* Newton's method within the grid cell the forward just used.  As
+		   the solution may fall within a sub-grid of this cell, we do not
+		   accept it directly; it becomes our next guess, and the next
+		   forward verifies it. */
+		if (CScntv2ShiftCell (cntv2,&shiftCell))
+		{
+			(void)CSinvertShiftCell (&shiftCell,guess,ll_src,cntv2->cnvrgValue);
+			continue;
+		}
 
 		/* If our guess at the longitude is off by more than
 		   small, we adjust our guess by the amount we are off. */
@@ -265,6 +312,7 @@ int CScntv2I2 (struct cs_NTv2_ *cntv2,double *ll_trg,Const double *ll_src)
 		   what we started with, we do maxIterations iterations, instead of the
 		   four that GRIDINT does.  Thus, there is room for a slight discrepancy
 		   between the two programs. */
+		CSmetricsItr (ii,cntv2->maxIterations);
 		if (ii >= cntv2->maxIterations)
 		{
 			status = csGRIDI_ST_COVERAGE;
@@ -458,7 +506,9 @@ int CSinitNTv2 (struct cs_NTv2_* thisPtr,Const char *filePath,long32_t bufferSiz
 	CS_stncp (thisPtr->FileName,cp,sizeof (thisPtr->FileName));
 
 	/* Open the file. */
+	CStraceBgn (cs_TRACE_GRIDOPEN,thisPtr->FilePath);
 	stream = CS_fopen (thisPtr->FilePath,_STRM_BINRD);
+	CStraceEnd (cs_TRACE_GRIDOPEN,thisPtr->FilePath,(stream != NULL) ? 0 : -1);
 	if (stream == NULL)
 	{
 		CS_erpt (cs_DTC_FILE);
@@ -1020,6 +1070,7 @@ int CScalcNTv2 (struct cs_NTv2_* thisPtr,double deltaLL [2],Const double source
 	extern double cs_Zero;				/* 0.0 */
 	extern double cs_LlNoise;			/* 1.0E-12 */
 	extern char csErrnam [MAXPATH];
+	extern struct cs_Metrics_ csMetrics;
 
 	short onLimit;
 	unsigned short eleNbr, rowNbr;
@@ -1080,9 +1131,13 @@ int CScalcNTv2 (struct cs_NTv2_* thisPtr,double deltaLL [2],Const double source
 		if (fabs (wpLL [LAT] - cvtPtr->NwReference [LAT]) <= cs_LlNoise) onLimit |= 1;
 		if (fabs (wpLL [LNG] - cvtPtr->NwReference [LNG]) <= cs_LlNoise) onLimit |= 2;
 
+		csMetrics.gridLookups += 1;
 		if (thisPtr->fileImage == NULL)
 		{
+			csMetrics.gridMisses += 1;
+			CStraceBgn (cs_TRACE_GRIDOPEN,thisPtr->FilePath);
 			stream = CS_fopen (thisPtr->FilePath,_STRM_BINRD);
+			CStraceEnd (cs_TRACE_GRIDOPEN,thisPtr->FilePath,(stream != NULL) ? 0 : -1);
 			if (stream == NULL)
 			{
 				CS_stncp (csErrnam,thisPtr->FilePath,MAXPATH);
@@ -1121,7 +1176,11 @@ int CScalcNTv2 (struct cs_NTv2_* thisPtr,double deltaLL [2],Const double source
 			}
 
 			// Copy everything into the memory
+			CStraceBgn (cs_TRACE_GRIDREAD,thisPtr->FilePath);
 			readCnt = CS_fread(thisPtr->fileImage,1,(unsigned int)thisPtr->fileImageSize,stream);
+			CStraceEnd (cs_TRACE_GRIDREAD,thisPtr->FilePath,(readCnt == (size_t)thisPtr->fileImageSize) ? 0 : -1);
+			csMetrics.gridReads += 1;
+			csMetrics.gridBytes += readCnt;
 			if (CS_ferror(stream))
 			{
 				CS_erpt (cs_IOERR);
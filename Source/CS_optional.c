@@ -509,6 +509,53 @@ long32_t EXP_LVL7 CSatof (double *result,Const char *value,char rdxChr,char sepC
 	return (rtn_val);
 }
 
+/**********************************************************************
+**	count = CS_atofArray (results,values,count,flags);
+**
+**	double results [];			returns the processed results, one for each
+**								element of the values array.
+**	char *values [];			array of pointers to the ASCII strings
+**								which are to be converted.
+**	int count;					number of elements in the values array.
+**	long32_t flags [];			returns the format information for each
+**								value, exactly as CS_atof would; may be
+**								the NULL pointer if not of interest.
+**	int count;					returns the number of values for which
+**								CS_atof would have returned a negative
+**								value, i.e. an error.
+**
+**	The locale dependent radix, digit separator, and ratio characters
+**	are obtained once for the entire array.  Each result is exactly
+**	what CS_atof would produce for the same string.
+**********************************************************************/
+int EXP_LVL1 CS_atofArray (double results [],Const char *values [],int count,long32_t flags [])
+{
+	extern char cs_DecpntC;
+	extern char cs_DigsepC;
+	extern char cs_RatioC;
+
+	char rdxChr;
+	char sepChr;
+	char ratioChr;
+
+	int idx;
+	int errCnt;
+	long32_t dblFrmt;
+
+	rdxChr = cs_DecpntC;
+	sepChr = cs_DigsepC;
+	ratioChr = cs_RatioC;
+
+	errCnt = 0;
+	for (idx = 0;idx < count;idx += 1)
+	{
+		dblFrmt = CSatof (&results [idx],values [idx],rdxChr,sepChr,ratioChr);
+		if (dblFrmt < 0L) errCnt += 1;
+		if (flags != NULL) flags [idx] = dblFrmt;
+	}
+	return errCnt;
+}
+
 /**********************************************************************
 **	actual = CS_ftoa (bufr,size,value,frmt);
 **
@@ -522,21 +569,151 @@ long32_t EXP_LVL7 CSatof (double *result,Const char *value,char rdxChr,char sepC
 **								output the value.
 **********************************************************************/
 
-long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
+/* The rounding value used in degrees/minutes/seconds formatting is
+   one half of a unit in the last place of the requested precision.
+   Precision is limited to 14 digits, so the values are computed once
+   and kept in a table.  They are computed with the very same
+   expression CS_ftoa always used, so results are identical. */
+static int csFtoaRndInit = FALSE;
+static double csFtoaRndTbl [15];
+
+static Const double* CSftoaRndTbl (void)
 {
-	extern double cs_Zero;
-	extern double cs_Half;
-	extern double cs_One;
 	extern double cs_Ten;
-	extern double cs_K60;
-	extern double cs_K360;
+	extern double cs_Half;
+
+	int prec;
+
+	if (!csFtoaRndInit)
+	{
+		for (prec = 0;prec < 15;prec += 1)
+		{
+			csFtoaRndTbl [prec] = pow (cs_Ten,(double)(-prec)) * cs_Half;
+		}
+		csFtoaRndInit = TRUE;
+	}
+	return csFtoaRndTbl;
+}
+
+/* The portion of a CS_ftoa format specification which does not depend
+   upon the value being formatted, decoded into a form which CSftoa can
+   use directly.  The locale dependent characters are captured at the
+   same time.  CS_ftoaArray decodes the format once for the entire
+   array. */
+struct csFtoaFrmt_
+{
+	long32_t frmt;				/* the format as supplied */
+	long32_t ratioFrmt;			/* format used when a ratio value is
+								   out of range and output as decimal */
+	int blank0;					/* output zero as a null string */
+	int rng360;					/* use the 0 <--> 360 range */
+	int cmaFlg;					/* digit separators requested */
+	int ratio;					/* ratio output requested */
+	int dirChr;					/* directional character requested */
+	int secFlg;					/* degrees, minutes, and seconds */
+	int minFlg;					/* degrees and minutes (set with secFlg) */
+	int force3;					/* always three degree digits */
+	char degLead;				/* fill character for degrees */
+	char minLead;				/* fill character for minutes and seconds */
+	char decpntC;				/* locale decimal point */
+	char digsepC;				/* locale digit separator */
+	char ratioC;				/* locale ratio character */
+	char dirPos;				/* directional character, positive values */
+	char dirNeg;				/* directional character, negative values */
+	Const double *rndTbl;		/* round off values, by precision */
+};
 
+static void CSftoaDecode (struct csFtoaFrmt_ *dcd,long32_t frmt)
+{
 	extern char cs_DecpntC;
 	extern char cs_DigsepC;
 	extern char cs_RatioC;
 	extern char cs_LngDir [4];
 	extern char cs_LatDir [4];
 
+	dcd->frmt = frmt;
+	dcd->ratioFrmt = frmt & cs_ATOF_PRCMSK;
+	if (dcd->ratioFrmt < 6L) dcd->ratioFrmt = 6L;
+
+	dcd->blank0 = ((frmt & cs_ATOF_0BLNK) != 0);
+	dcd->rng360 = ((frmt & cs_ATOF_RNG360) != 0);
+	dcd->cmaFlg = ((frmt & cs_ATOF_COMMA) != 0);
+	dcd->ratio  = ((frmt & cs_ATOF_RATIO) != 0);
+	dcd->dirChr = ((frmt & cs_ATOF_DIRCHR) != 0);
+	dcd->secFlg = ((frmt & cs_ATOF_MINSEC) != 0);
+	dcd->minFlg = dcd->secFlg | ((frmt & cs_ATOF_MINUTE) != 0);		/*lint !e514 */
+	dcd->force3 = ((frmt & cs_ATOF_FORCE3) != 0);
+	dcd->degLead = ((frmt & cs_ATOF_DEG0) != 0) ? '0' : ' ';
+	dcd->minLead = ((frmt & cs_ATOF_MINSEC0) != 0) ? '0' : ' ';
+
+	dcd->decpntC = cs_DecpntC;
+	dcd->digsepC = cs_DigsepC;
+	dcd->ratioC  = cs_RatioC;
+	dcd->dirPos = (frmt & cs_ATOF_XEAST) ? cs_LngDir [0] : cs_LatDir [0];
+	dcd->dirNeg = (frmt & cs_ATOF_XEAST) ? cs_LngDir [2] : cs_LatDir [2];
+	dcd->rndTbl = CSftoaRndTbl ();
+}
+
+static long32_t CSftoa (char *bufr,int size,double value,Const struct csFtoaFrmt_ *dcd);
+
+long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
+{
+	struct csFtoaFrmt_ dcd;
+
+	CSftoaDecode (&dcd,frmt);
+	return CSftoa (bufr,size,value,&dcd);
+}
+
+/**********************************************************************
+**	count = CS_ftoaArray (bufr,size,values,count,frmt,actual);
+**
+**	char *bufr;					the buffer in which the results are to be
+**								returned; must be at least size * count
+**								characters in size.
+**	int size;					the space allotted to each result, i.e. the
+**								size argument of CS_ftoa.  Result 'n' is
+**								returned, null terminated, at bufr + n * size.
+**	double values [];			the values to be converted.
+**	int count;					number of values to be converted.
+**	long32_t frmt;				a bit map of options according to the
+**								format returned by CS_atof.  The same
+**								format is used for all values.
+**	long32_t actual [];			returns the actual format used to output
+**								each value; may be the NULL pointer.
+**	int count;					returns the number of values converted.
+**
+**	Intended for formatting an entire column of values, e.g. all of
+**	the latitudes of a report, in one call.  The format, and the
+**	locale dependent characters, are decoded once for the entire
+**	array.  Each result is exactly, byte for byte, what CS_ftoa would
+**	produce for the same value.
+**********************************************************************/
+int EXP_LVL1 CS_ftoaArray (char *bufr,int size,Const double values [],int count,long32_t frmt,long32_t actual [])
+{
+	int idx;
+	long32_t rtnFrmt;
+	struct csFtoaFrmt_ dcd;
+
+	if (size < 1 || count <= 0) return 0;
+
+	CSftoaDecode (&dcd,frmt);
+	for (idx = 0;idx < count;idx += 1)
+	{
+		rtnFrmt = CSftoa (bufr,size,values [idx],&dcd);
+		if (actual != NULL) actual [idx] = rtnFrmt;
+		bufr += size;
+	}
+	return count;
+}
+
+static long32_t CSftoa (char *bufr,int size,double value,Const struct csFtoaFrmt_ *dcd)
+{
+	extern double cs_Zero;
+	extern double cs_One;
+	extern double cs_Ten;
+	extern double cs_K60;
+	extern double cs_K360;
+
 	char lead_ch;
 
 	int ii;
@@ -547,7 +724,6 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 	int ratio;
 	int dummy;
 	int exponent;
-	int sgn_idx;
 	int dec_pnt;
 	int dir_chr;
 	int ch_req;
@@ -570,8 +746,11 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 	double prec_d;
 	double dbl_tmp;
 
+	long32_t frmt;
+
 	char local [32];
 
+	frmt = dcd->frmt;
 	dir_chr = FALSE;
 	sec_flg = FALSE;
 	min_flg = FALSE;
@@ -581,7 +760,7 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 	/* Handle the easy cases first. */
 
 	if (size < 1) return (0x80000000L);				/*lint !e569 */
-	if ((frmt & cs_ATOF_0BLNK) && value == 0.0)
+	if (dcd->blank0 && value == 0.0)
 	{
 		return ((long32_t)cs_ATOF_0BLNK);
 	}
@@ -589,7 +768,7 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 	/* If range 0 <--> 360 is indicated, and appropriate, do that
 	   adjustment now. */
 
-	if (((frmt & cs_ATOF_RNG360) != 0) && value >= -180.0 && value < 0.0)
+	if (dcd->rng360 && value >= -180.0 && value < 0.0)
 	{
 		value += cs_K360;
 	}
@@ -603,19 +782,18 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 		value = -value;
 	}
 
-	/* Extract the essential information from the requested
-	   format. */
+	/* The essential information from the requested format has
+	   already been extracted by CSftoaDecode. */
 
-	cma_flg = ((frmt & cs_ATOF_COMMA) != 0);
-	ratio   = ((frmt & cs_ATOF_RATIO) != 0);
+	cma_flg = dcd->cmaFlg;
+	ratio   = dcd->ratio;
 	if (ratio)
 	{
 		value = fabs (value);
 		if (value <= 0.5 || value >= 0.99999999)
 		{
 			ratio = FALSE;
-			frmt = frmt & cs_ATOF_PRCMSK;
-			if (frmt < 6L) frmt = 6L;
+			frmt = dcd->ratioFrmt;
 		}
 		else
 		{
@@ -624,11 +802,10 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 	}
 	else
 	{
-		dir_chr = ((frmt & cs_ATOF_DIRCHR) != 0);
-		sec_flg = ((frmt & cs_ATOF_MINSEC) != 0);
-		min_flg = sec_flg | ((frmt & cs_ATOF_MINUTE) != 0);		/*lint !e514 */
-		lng_flg = (min_flg || sec_flg) &&
-		          (((frmt & cs_ATOF_FORCE3) != 0) || (value >= 100.0));
+		dir_chr = dcd->dirChr;
+		sec_flg = dcd->secFlg;
+		min_flg = dcd->minFlg;
+		lng_flg = (min_flg || sec_flg) && (dcd->force3 || (value >= 100.0));
 	}
 
 	/* The log (base 10) tells us how many digits we need on the
@@ -808,7 +985,7 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 	if (ratio)
 	{
 		*bufr++ = '1';
-		*bufr++ = cs_RatioC;
+		*bufr++ = dcd->ratioC;
 	}
 
 	/* Now the value. */
@@ -819,7 +996,7 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 		   an overflow indication. */
 
 		if (size > 3) *bufr++ = '*';
-		if (size > 2) *bufr++ = cs_DecpntC;
+		if (size > 2) *bufr++ = dcd->decpntC;
 		if (size > 1) *bufr++ = '*';
 	}
 	else if ((frmt & cs_ATOF_EXPNT) != 0)
@@ -846,7 +1023,7 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 
 		if (minus) *bufr++ = '-';
 		*bufr++ = *cp++;
-		*bufr++ = cs_DecpntC;
+		*bufr++ = dcd->decpntC;
 		while (*cp != '\0') *bufr++ = *cp++;
 		*bufr++ = 'E';
 		if (exponent >= 0) *bufr++ = '+';
@@ -886,14 +1063,13 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 		minutes = -10;
 		if (sec_flg || min_flg)
 		{
-			prec_d = pow (cs_Ten,(double)(-prec)) * cs_Half;
+			prec_d = dcd->rndTbl [prec];
 			degrees = (int)value;
 			value = (value - (double)degrees) * cs_K60;
 			if (!sec_flg)
 			{
 				/* Minutes round off. */
 
-				prec_d = pow (cs_Ten,(double)(-prec)) * cs_Half;
 				dbl_tmp = value + prec_d;
 				if (dbl_tmp >= cs_K60)
 				{
@@ -943,7 +1119,7 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 
 		if (degrees >= 0)
 		{
-			lead_ch = ((frmt & cs_ATOF_DEG0) != 0) ? '0' : ' ';
+			lead_ch = dcd->degLead;
 			dig_cnt = (lng_flg) ? 3 : 2;
 
 			/* Insert the appropriate number of fill
@@ -977,7 +1153,7 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 			   digit cont (dig_cnt) is always 2 in this
 			   case. */
 
-			lead_ch = ((frmt & cs_ATOF_MINSEC0) != 0) ? '0' : ' ';
+			lead_ch = dcd->minLead;
 			*bufr++ = (minutes >= 10) ? (char)(minutes / 10) + '0' : lead_ch;
 			*bufr++ = (char)(minutes % 10) + '0';
 
@@ -1088,7 +1264,7 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 			*bufr++ = '0';
 			if (dec_pnt < 0)
 			{
-				*bufr++ = cs_DecpntC;
+				*bufr++ = dcd->decpntC;
 				for (ii = dec_pnt;ii < 0;ii++)
 				{
 					*bufr++ = '0';
@@ -1113,14 +1289,14 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 				jj = dec_pnt - ii;
 				if (jj > 0 && (jj % 3) == 0)
 				{
-					*bufr++ = cs_DigsepC;
+					*bufr++ = dcd->digsepC;
 				}
 			}
 
 			/* Output the decimal point if this is the
 			   spot for it. */
 
-			if (ii == dec_pnt) *bufr++ = cs_DecpntC;
+			if (ii == dec_pnt) *bufr++ = dcd->decpntC;
 
 			/* Now, we can copy the actual digit. */
 
@@ -1132,8 +1308,7 @@ long32_t EXP_LVL1 CS_ftoa (char *bufr,int size,double value,long32_t frmt)
 
 		if (dir_chr)
 		{
-			sgn_idx = (minus) ? 2 : 0;
-			*bufr++ = (frmt & cs_ATOF_XEAST) ? cs_LngDir [sgn_idx] : cs_LatDir [sgn_idx];
+			*bufr++ = (minus) ? dcd->dirNeg : dcd->dirPos;
 		}
 	}
 	if (size > 0) *bufr = '\0';
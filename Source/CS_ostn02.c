@@ -196,6 +196,7 @@ int CSprivateOstn02 (struct cs_Ostn02_ *__This,double result [2],const double et
 {
 	extern double cs_Mhuge;
 	extern char csErrnam [];
+	extern struct cs_Metrics_ csMetrics;
 	extern double cs_Zero;
 
 	long32_t readCount;
@@ -253,14 +254,18 @@ int CSprivateOstn02 (struct cs_Ostn02_ *__This,double result [2],const double et
 	/* Is the necessary data in the buffer already? */
 	fposBegin = recNbr * __This->recordSize + eleNbr * __This->elementSize;
 	fposEnd   = fposBegin + __This->recordSize + __This->elementSize;
+	csMetrics.gridLookups += 1;
 	if (fposBegin < __This->bufferBeginPosition || fposBegin > __This->bufferEndPosition ||
 		fposEnd   < __This->bufferBeginPosition || fposEnd   > __This->bufferEndPosition)
 	{
 		/* The data we need is not in the buffer.  If the file has been released,
 		   open it again now. */
+		csMetrics.gridMisses += 1;
 		if (__This->strm == NULL)
 		{
+			CStraceBgn (cs_TRACE_GRIDOPEN,__This->binaryPath);
 			__This->strm = CS_fopen (__This->binaryPath,_STRM_BINRD);
+			CStraceEnd (cs_TRACE_GRIDOPEN,__This->binaryPath,(__This->strm != NULL) ? 0 : -1);
 			if (__This->strm == NULL)
 			{
 				CS_stncp (csErrnam,__This->binaryPath,MAXPATH);
@@ -310,7 +315,11 @@ int CSprivateOstn02 (struct cs_Ostn02_ *__This,double result [2],const double et
 			CS_erpt (cs_IOERR);
 			goto error;
 		}
+		CStraceBgn (cs_TRACE_GRIDREAD,__This->binaryPath);
 		checkCount = (long32_t)CS_fread (__This->dataBuffer,1,(size_t)readCount,__This->strm);
+		CStraceEnd (cs_TRACE_GRIDREAD,__This->binaryPath,(checkCount == readCount) ? 0 : -1);
+		csMetrics.gridReads += 1;
+		csMetrics.gridBytes += (size_t)checkCount;
 		if (checkCount != readCount)
 		{
 			CS_stncp (csErrnam,__This->binaryPath,MAXPATH);
@@ -233,6 +233,7 @@ int EXP_LVL9 CSparm3I2 (struct csParm3_ *parm3,double* trgLl,Const double* srcLl
 
 	/* If we didn't resolve in maxIteration tries, we issue a warning
 	   message.  Usually, three or four iterations does the trick. */
+	CSmetricsItr (ii,parm3->maxIterations);
 	if (ii >= parm3->maxIterations )
 	{
 		CS_erpt (cs_3P_CNVRG);
@@ -249,6 +249,7 @@ int EXP_LVL9 CSparm4I2 (struct csParm4_ *parm4,double* trgLl,Const double* srcLl
 
 	/* If we didn't resolve in maxIteration tries, we issue a warning
 	   message.  Usually, three or four iterations does the trick. */
+	CSmetricsItr (ii,parm4->maxIterations);
 	if (ii >= parm4->maxIterations )
 	{
 		CS_erpt (cs_4P_CNVRG);
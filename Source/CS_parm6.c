@@ -252,6 +252,7 @@ int EXP_LVL9 CSparm6I2 (struct csParm6_* parm6,double* trgLl,Const double* srcLl
 
 	/* If we didn't resolve in maxIteration tries, we issue a warning
 	   message.  Usually, three or four iterations does the trick. */
+	CSmetricsItr (ii,parm6->maxIterations);
 	if (ii >= parm6->maxIterations )
 	{
 		CS_erpt (cs_6P_CNVRG);
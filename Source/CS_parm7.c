@@ -274,10 +274,30 @@ int EXP_LVL9 CSparm7I3 (struct csParm7_ *parm7,double* trgLl,Const double* srcLl
 	return status;
 }
 
+/* Applies the exact inverse of the linear portion (rotation and scale) of
+   the forward transformation to a geocentric vector. */
+static void CSparm7LinInv (Const struct csParm7_ *parm7,double rslt [3],Const double vec [3])
+{
+	/* The rotation matrix is orthogonal, its transpose is its inverse. */
+	rslt [XX] = (parm7->rt11 * vec [XX] + parm7->rt21 * vec [YY] + parm7->rt31 * vec [ZZ]) / parm7->scale;
+	rslt [YY] = (parm7->rt12 * vec [XX] + parm7->rt22 * vec [YY] + parm7->rt32 * vec [ZZ]) / parm7->scale;
+	rslt [ZZ] = (parm7->rt13 * vec [XX] + parm7->rt23 * vec [YY] + parm7->rt33 * vec [ZZ]) / parm7->scale;
+	return;
+}
+
 /******************************************************************************
+	This is a precise inverse of CSparm7F2, used in the two dimensional case
+	as we don't know what the ellipsoid elevation is.  The forward is affine
+	in geocentric space.  The points sharing the target latitude and
+	longitude lie on the normal to the target ellipsoid, which maps back to a
+	line in the source system.  Where that line pierces the source ellipsoid
+	is the exact inverse.  The iterative exercise of CSparm7F2 which follows
+	is only a fallback.
 */
 int EXP_LVL9 CSparm7I2 (struct csParm7_ *parm7,double* trgLl,Const double* srcLl)
 {
+	extern double cs_Zero;				/* 0.0 */
+
 	int ii;
 	int lngOk;
 	int latOk;
@@ -286,6 +306,10 @@ int EXP_LVL9 CSparm7I2 (struct csParm7_ *parm7,double* trgLl,Const double* srcLl
 	double guess [3];
 	double newLl [3];
 	double epsilon [3];
+	double xyz [3];
+	double nrm [3];
+	double pnt [3];
+	double dir [3];
 
 	/* Assume everything goes OK until we know different. */
 	rtnVal = 0;
@@ -299,9 +323,23 @@ int EXP_LVL9 CSparm7I2 (struct csParm7_ *parm7,double* trgLl,Const double* srcLl
 	trgLl [LAT] = guess [LAT] = srcLl [LAT];
 	trgLl [HGT] = srcLl [HGT];
 
-	/* To improve performancce, we could use CS_bw3dInvrs here to
-	   get our guess.  That function will probably reduce the
-	   number of iterations require below substantially. */
+	/* The closed form solution, see above. */
+	guess [HGT] = cs_Zero;
+	CS_llhToXyz (xyz,guess,parm7->trgERad,parm7->trgESqr);
+	CS_llhNormal (nrm,guess);
+	xyz [XX] -= parm7->deltaX;
+	xyz [YY] -= parm7->deltaY;
+	xyz [ZZ] -= parm7->deltaZ;
+	CSparm7LinInv (parm7,pnt,xyz);
+	CSparm7LinInv (parm7,dir,nrm);
+	rtnVal = CS_xyzLineToLlh (newLl,pnt,dir,parm7->srcERad,parm7->srcESqr);
+	if (rtnVal == 0)
+	{
+		trgLl [LNG] = newLl [LNG];
+		trgLl [LAT] = newLl [LAT];
+		return rtnVal;
+	}
+	rtnVal = 0;
 
 	/* Start a loop which will iterate as many as maxIteration times. */
 	for (ii = 0;ii < parm7->maxIterations;ii++)
@@ -350,6 +388,7 @@ int EXP_LVL9 CSparm7I2 (struct csParm7_ *parm7,double* trgLl,Const double* srcLl
 
 	/* If we didn't resolve in maxIteration tries, we issue a warning
 	   message.  Usually, three or four iterations does the trick. */
+	CSmetricsItr (ii,parm7->maxIterations);
 	if (ii >= parm7->maxIterations )
 	{
 		CS_erpt (cs_7P_CNVRG);
@@ -254,6 +254,7 @@ void EXP_LVL9 CSrobinS (struct cs_Csprm_ *csprm)
 	csprm->cs_sclk  = (cs_SCALK_CAST)CSrobinK;
 	csprm->cs_sclh  = (cs_SCALH_CAST)CSrobinH;
 	csprm->cs_cnvrg = (cs_CNVRG_CAST)CSrobinC;
+	csprm->cs_dstrt = (cs_DSTRT_CAST)CSrobinD;
 	csprm->llchk    = (cs_LLCHK_CAST)CSrobinL;
 	csprm->xychk    = (cs_XYCHK_CAST)CSrobinX;
 
@@ -448,6 +449,7 @@ int EXP_LVL9 CSrobinI (	Const struct cs_Robin_ *robin,double ll [2],Const double
 	double term1;
 	double term2;
 	double term3;
+	double slope;
 
 	rtn_val = cs_CNVRT_NRML;
 
@@ -537,11 +539,11 @@ int EXP_LVL9 CSrobinI (	Const struct cs_Robin_ *robin,double ll [2],Const double
 
 	/* Now we iterate through the forward equation and adjust our
 	   latitude to the desired precision.  As a safety precaution,
-	   we use nn to break out of an unconverging loop after 25
-	   iterations. Typically, four or five iterations is all that
-	   is necessary.  Since Robinson is used only for full world
-	   maps, the one_cm limit used here may be too small.  For
-	   higher performance, raise this value (in CSrobinS). */
+	   we use nn to break out of an unconverging loop after 35
+	   iterations.  Each adjustment is a Newton step using the
+	   derivative of the interpolating polynomial for the current
+	   interval, so one or two iterations is all that is typically
+	   necessary. */
 
 	nn = 0;
 	for (;;)
@@ -573,9 +575,21 @@ int EXP_LVL9 CSrobinI (	Const struct cs_Robin_ *robin,double ll [2],Const double
 		if (fabs (yy1 - yy) <= robin->one_cm || nn > 35) break;
 
 		/* We have an approximate yy.  Adjust our approximate latitude relative
-		   to the difference in the true Y and our approximate Y. */
-
-		pd -= cs_K90 * (yy1 - yy) * robin->inv_kay;
+		   to the difference in the true Y and our approximate Y, and the
+		   slope of the interpolating polynomial, in Y units per degree.  The
+		   tabulated values increase monotonically, so the slope should never
+		   be zero; we fall back to the nominal slope just in case. */
+
+		slope = robin->kay * cs_Fifth * (cs_Half * (cs_RobinPR [ip3] - cs_RobinPR [ip1]) +
+										 p2 * (cs_RobinPR [ip3] - cs_Two * cs_RobinPR [ip2] + cs_RobinPR [ip1]));
+		if (slope > 0.0)
+		{
+			pd -= (yy1 - yy) / slope;
+		}
+		else
+		{
+			pd -= cs_K90 * (yy1 - yy) * robin->inv_kay;
+		}
 		nn += 1;
 	}
 	if (fabs (pd) > cs_MaxLatFz)
@@ -891,6 +905,97 @@ double EXP_LVL9 CSrobinH (Const struct cs_Robin_ *robin,Const double ll [2])
 	return (hh);
 }
 
+/**********************************************************************
+**	CSrobinD (robin,ll,khc);
+**
+**	struct cs_Robin_ *robin;	structure which carries all parameters
+**								in effect for the coordinate system
+**								being used, assuming the Robinson projection.
+**	double ll [2];				the longitude ([0]) and the latitude ([1])
+**								of the point at which the distortion is
+**								to be computed.  Values are in degrees.
+**	double khc [3];				the K and H scale factors and the
+**								convergence angle in degrees are
+**								returned here, in that order.
+**
+**	CSrobinK, CSrobinH and CSrobinC each sample the projection
+**	at two points; six evaluations in all.  The same values are
+**	obtained here from four: the point itself and the point one
+**	second east of it for K, and the points one half second north
+**	and south of it for both H and the convergence.  The latter
+**	differs from CSrobinC only in the length of the (very short)
+**	line segment used.
+**********************************************************************/
+
+void EXP_LVL9 CSrobinD (Const struct cs_Robin_ *robin,Const double ll [2],double khc [3])
+{
+	extern double cs_Radian;			/* 57.2957... */
+	extern double cs_Degree;			/* 1/RADIAN */
+	extern double cs_Sin1Sec;			/* sine of one arc second */
+	extern double cs_Sec2Deg;			/* 1.0 / 3600.0 */
+	extern double cs_HlfSecDeg;			/* 0.5 / 3600.0 */
+	extern double cs_MaxLatFz;			/* One second of arc less
+										   than 90 in degrees. */
+	extern double cs_SclInf;			/* 9.9E+04, the value we
+										   return for an infinite
+										   scale factor. */
+	extern double cs_Km360;				/* -360.0, the convergence
+										   we return for a bogus
+										   point. */
+	int status1;
+	int status2;
+
+	double del_xx;
+	double del_yy;
+	double dd_ll;
+
+	double xy0 [2];
+	double xy1 [2];
+	double xy2 [2];
+	double xy3 [2];
+	double ll1 [2];
+
+	if (fabs (ll [LAT]) > cs_MaxLatFz)
+	{
+		khc [0] = cs_SclInf;
+		khc [1] = cs_SclInf;
+		khc [2] = CSrobinC (robin,ll);
+		return;
+	}
+
+	/* K, along the parallel. */
+
+	ll1 [LNG] = ll [LNG] + cs_Sec2Deg;
+	ll1 [LAT] = ll [LAT];
+	CSrobinF (robin,xy0,ll);				/*lint !e534 */
+	CSrobinF (robin,xy1,ll1);				/*lint !e534 */
+	del_xx = xy1 [XX] - xy0 [XX];
+	del_yy = xy1 [YY] - xy0 [YY];
+	dd_ll = robin->ka * cs_Sin1Sec * cos (ll [LAT] * cs_Degree);
+	khc [0] = (dd_ll > robin->one_cm) ? sqrt (del_xx * del_xx + del_yy * del_yy) / dd_ll : cs_SclInf;
+
+	/* H and the convergence, along the meridian. */
+
+	ll1 [LNG] = ll [LNG];
+	ll1 [LAT] = ll [LAT] - cs_HlfSecDeg;
+	status1 = CSrobinF (robin,xy2,ll1);
+	ll1 [LAT] = ll [LAT] + cs_HlfSecDeg;
+	status2 = CSrobinF (robin,xy3,ll1);
+	del_xx = xy3 [XX] - xy2 [XX];
+	del_yy = xy3 [YY] - xy2 [YY];
+	khc [1] = sqrt (del_xx * del_xx + del_yy * del_yy) / (robin->ka * cs_Sin1Sec);
+	if (status1 == cs_CNVRT_NRML && status2 == cs_CNVRT_NRML &&
+		(fabs (del_xx) + fabs (del_yy)) > 0.0)
+	{
+		khc [2] = -atan2 (del_xx,del_yy) * cs_Radian;
+	}
+	else
+	{
+		khc [2] = cs_Km360;
+	}
+	return;
+}
+
 /**********************************************************************
 **	status = CSrobinL (robin,cnt,pnts);
 **
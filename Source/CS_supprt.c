@@ -799,11 +799,10 @@ void EXP_LVL5 CS_iisrs0 (Const struct cs_Cmplx_ *xy,Const struct cs_Cmplx_ *AB,i
 **								required to complete the sort, -1 if an
 **								error occurred.
 **
-**	cs_Sortbs external variable which can be set to indicate the
-**		maximum size of the sort buffer to be used.  Initial
-**		value is defined in CSdata.c.  This variable is an
-**		int.   It CANNOT be changed to a long for larger
-**		buffers without rewritting this function.
+**	The entire region to be sorted is read into memory, sorted with
+**	qsort, and written back in a single write.  The cs_Sortbs external
+**	variable, which once limited the size of the sort buffer, is no
+**	longer used by this function.
 **
 **	NOTE:: Only that portion of the file which is between
 **	the current position of the file at the time this
@@ -57,40 +57,136 @@ int EXP_LVL1 CS_unique (int newValue)
 /* Establish definitions for all functions which the application programmer
    did not provide.  Application programmers are expected to make their
    own definitions in the "cs_ClientBeg.h" or "cs_ClientEnd.h" header
-   files. */
+   files.
+
+   In addition, an allocator may be installed at run time with
+   CS_setAllocator, in which case the macros are bypassed.  The counters
+   in csAllocStats are maintained in either case. */
 
-void EXP_LVL5 *CS_malc (size_t blk_size)
-{
 #ifndef _csMalloc
 #	define _csMalloc(_n) malloc(_n)
 #endif
-	return (_csMalloc (blk_size));
+#ifndef _csRealloc
+#	define _csRealloc(_m,_n) realloc(_m,_n)
+#endif
+#ifndef _csCalloc
+#	define _csCalloc(_n,_s) calloc(_n,_s)
+#endif
+#ifndef _csFree
+#	define _csFree(_m) {if (_m) {free(_m); _m = 0;} }
+#endif
+
+static void CSallocLive (long direction,void *ptr)
+{
+	extern struct cs_Allocator_ csAllocHook;
+	extern struct cs_AllocStats_ csAllocStats;
+
+	size_t blkSize;
+
+	if (csAllocHook.sizeFunc == NULL || ptr == NULL) return;
+	blkSize = (*csAllocHook.sizeFunc)(csAllocHook.context,ptr);
+	if (direction > 0)
+	{
+		csAllocStats.liveBytes += blkSize;
+		if (csAllocStats.liveBytes > csAllocStats.peakBytes)
+		{
+			csAllocStats.peakBytes = csAllocStats.liveBytes;
+		}
+	}
+	else
+	{
+		csAllocStats.liveBytes -= (blkSize < csAllocStats.liveBytes) ? blkSize : csAllocStats.liveBytes;
+	}
+}
+
+void EXP_LVL5 *CS_malc (size_t blk_size)
+{
+	extern struct cs_Allocator_ csAllocHook;
+	extern struct cs_AllocStats_ csAllocStats;
+
+	void *rtnPtr;
+
+	csAllocStats.malcCount += 1;
+	csAllocStats.totalBytes += blk_size;
+	if (csAllocHook.malcFunc != NULL)
+	{
+		rtnPtr = (*csAllocHook.malcFunc)(csAllocHook.context,blk_size);
+		CSallocLive (1L,rtnPtr);
+	}
+	else
+	{
+		rtnPtr = _csMalloc (blk_size);
+	}
+	if (rtnPtr == NULL) csAllocStats.failCount += 1;
+	return (rtnPtr);
 }
 
 void EXP_LVL5 *CS_ralc (void *ptr,size_t new_size)
 {
-#ifndef _csRealloc
-#	define _csRealloc(_m,_n) realloc(_m,_n)
-#endif
-	return (_csRealloc (ptr,new_size));
+	extern struct cs_Allocator_ csAllocHook;
+	extern struct cs_AllocStats_ csAllocStats;
+
+	void *rtnPtr;
+
+	csAllocStats.ralcCount += 1;
+	csAllocStats.totalBytes += new_size;
+	if (csAllocHook.malcFunc != NULL)
+	{
+		CSallocLive (-1L,ptr);
+		rtnPtr = (*csAllocHook.ralcFunc)(csAllocHook.context,ptr,new_size);
+		CSallocLive (1L,(rtnPtr != NULL) ? rtnPtr : ptr);
+	}
+	else
+	{
+		rtnPtr = _csRealloc (ptr,new_size);
+	}
+	if (rtnPtr == NULL) csAllocStats.failCount += 1;
+	return (rtnPtr);
 }
 
 void EXP_LVL5 *CS_calc (size_t blk_count,size_t blk_size)
 {
-#ifndef _csCalloc
-#	define _csCalloc(_n,_s) calloc(_n,_s)
-#endif
-	return (_csCalloc (blk_count,blk_size));
+	extern struct cs_Allocator_ csAllocHook;
+	extern struct cs_AllocStats_ csAllocStats;
+
+	void *rtnPtr;
+
+	if (csAllocHook.malcFunc != NULL)
+	{
+		if (blk_size != 0 && blk_count > ((size_t)-1) / blk_size)
+		{
+			csAllocStats.malcCount += 1;
+			csAllocStats.failCount += 1;
+			return (NULL);
+		}
+		rtnPtr = CS_malc (blk_count * blk_size);
+		if (rtnPtr != NULL) memset (rtnPtr,0,blk_count * blk_size);
+	}
+	else
+	{
+		csAllocStats.malcCount += 1;
+		csAllocStats.totalBytes += blk_count * blk_size;
+		rtnPtr = _csCalloc (blk_count,blk_size);
+		if (rtnPtr == NULL) csAllocStats.failCount += 1;
+	}
+	return (rtnPtr);
 }
 
 void EXP_LVL5 CS_free (void *ptr)
 {
-#ifndef _csFree
-#	define _csFree(_m) {if (_m) {free(_m); _m = 0;} }
-#endif
+	extern struct cs_Allocator_ csAllocHook;
+	extern struct cs_AllocStats_ csAllocStats;
 
 	void *lclPtr;
 
+	if (ptr == NULL) return;
+	csAllocStats.freeCount += 1;
+	if (csAllocHook.malcFunc != NULL)
+	{
+		CSallocLive (-1L,ptr);
+		(*csAllocHook.freeFunc)(csAllocHook.context,ptr);
+		return;
+	}
 	lclPtr = ptr;
 	_csFree (lclPtr);
 	return;
@@ -101,6 +197,645 @@ void EXP_LVL3 CS_dllFree (void *ptr)
 	return;
 }
 
+/******************************************************************************
+**	st = CS_setAllocator (newAlloc,oldAlloc);
+**
+**	struct cs_Allocator_ *newAlloc;	the allocator to be used from now on; NULL,
+**									or one with a NULL malcFunc, restores the
+**									system allocator (i.e. the _csMalloc etc.
+**									macros).
+**	struct cs_Allocator_ *oldAlloc;	the allocator previously in effect is
+**									returned here, suitable for restoring it
+**									later; may be NULL.
+**	int st;							returns zero on success, -1 if newAlloc
+**									provides a malc function but not the
+**									ralc and free functions.
+**
+**	Memory must be released through the allocator which allocated it.
+**	Since the library caches coordinate system and datum definitions,
+**	an application which installs an allocator temporarily should call
+**	CS_recvr before restoring the previous one.  The CS_dtloc datum
+**	cache is released here in any case, before the switch, so that it
+**	is always owned by the allocator in effect.
+******************************************************************************/
+int EXP_LVL3 CS_setAllocator (Const struct cs_Allocator_ *newAlloc,struct cs_Allocator_ *oldAlloc)
+{
+	extern struct cs_Allocator_ csAllocHook;
+
+	if (newAlloc != NULL && newAlloc->malcFunc != NULL &&
+		(newAlloc->ralcFunc == NULL || newAlloc->freeFunc == NULL))
+	{
+		CS_erpt (cs_INV_ARG1);
+		return -1;
+	}
+	CSdtlocRls ();
+	if (oldAlloc != NULL)
+	{
+		*oldAlloc = csAllocHook;
+	}
+	if (newAlloc != NULL && newAlloc->malcFunc != NULL)
+	{
+		csAllocHook = *newAlloc;
+	}
+	else
+	{
+		memset (&csAllocHook,0,sizeof (csAllocHook));
+	}
+	return 0;
+}
+
+void EXP_LVL3 CS_allocStats (struct cs_AllocStats_ *stats)
+{
+	extern struct cs_AllocStats_ csAllocStats;
+
+	*stats = csAllocStats;
+}
+
+/* Resets all counters.  The live byte count is preserved, the peak is set
+   to it; i.e. the peak is measured from this point. */
+void EXP_LVL3 CS_allocStatsReset (void)
+{
+	extern struct cs_AllocStats_ csAllocStats;
+
+	size_t liveBytes;
+
+	liveBytes = csAllocStats.liveBytes;
+	memset (&csAllocStats,0,sizeof (csAllocStats));
+	csAllocStats.liveBytes = liveBytes;
+	csAllocStats.peakBytes = liveBytes;
+}
+
+/******************************************************************************
+	Conversion metrics.  The counters in csMetrics are maintained by the
+	functions which do the work; these functions simply make them
+	available.  CS_metricsExport formats the current values either as
+	text in the Prometheus exposition format, or as a single JSON object,
+	for collection by whatever monitoring is in use.
+*/
+void EXP_LVL1 CS_getMetrics (struct cs_Metrics_ *metrics)
+{
+	extern struct cs_Metrics_ csMetrics;
+
+	*metrics = csMetrics;
+}
+void EXP_LVL1 CS_resetMetrics (void)
+{
+	extern struct cs_Metrics_ csMetrics;
+
+	memset (&csMetrics,0,sizeof (csMetrics));
+}
+/* Called by the iterative inverse datum calculations on exit from their
+   loop with the value of the loop counter and the loop limit. */
+void EXP_LVL9 CSmetricsItr (int itrCount,int itrLimit)
+{
+	extern struct cs_Metrics_ csMetrics;
+
+	if (itrCount >= itrLimit)
+	{
+		csMetrics.itrLimit += 1;
+	}
+	else
+	{
+		if (itrCount < 0) itrCount = 0;
+		if (itrCount >= cs_METRICS_ITRBKT) itrCount = cs_METRICS_ITRBKT - 1;
+		csMetrics.itrHist [itrCount] += 1;
+	}
+}
+/* Appends text to the export buffer if all of it fits.  Returns the length
+   the output would have if the buffer were large enough.  Once something
+   did not fit, nothing else is written as used only increases. */
+static int CSmetricsCat (char *bufr,int bufrSize,int used,Const char *text)
+{
+	int length;
+
+	length = (int)strlen (text);
+	if (used + length < bufrSize)
+	{
+		memcpy (bufr + used,text,(size_t)(length + 1));
+	}
+	return used + length;
+}
+/* Appends a single value.  In text format, name and label (which may be
+   empty) make up the metric name; in JSON format, key is the member name
+   and a comma precedes it unless it is the first member of its object. */
+static int CSmetricsVal (char *bufr,int bufrSize,int used,int format,
+						 Const char *name,Const char *label,Const char *key,
+						 int first,size_t value)
+{
+	char line [160];
+
+	/* %.0f as C89 has no conversion for size_t; exact up to 2^53. */
+	if (format == cs_METRICS_JSON)
+	{
+		sprintf (line,"%s\"%s\":%.0f",first ? "" : ",",key,(double)value);
+	}
+	else
+	{
+		sprintf (line,"csmap_%s%s %.0f\n",name,label,(double)value);
+	}
+	return CSmetricsCat (bufr,bufrSize,used,line);
+}
+/* Formats the current metrics into bufr, which is always null terminated
+   if bufrSize is positive.  Returns the length of the complete output, which
+   exceeds bufrSize - 1 if the buffer was too small (nothing is written past
+   the last item which fit), or -1 for an invalid argument. */
+int EXP_LVL1 CS_metricsExport (char *bufr,int bufrSize,int format)
+{
+	extern struct cs_Metrics_ csMetrics;
+	extern struct cs_XfrmTab_ cs_XfrmTab [];
+
+	int idx;
+	int used;
+	int first;
+	unsigned short methodCode;
+	struct cs_Metrics_ *mp;
+	struct cs_XfrmTab_ *xfrmTabPtr;
+	char mthName [64];
+	char label [128];
+
+	static Const char *stages [3] = { "cs2ll", "ll2cs", "dtcvt" };
+	static Const char *dictNames [4] = { "coordsys", "datum", "ellipsoid", "transformation" };
+	static Const char *cacheNames [3] = { "coordsys", "dtcprm", "datum" };
+
+	if (bufr == NULL || bufrSize <= 0 || (format != cs_METRICS_TEXT && format != cs_METRICS_JSON))
+	{
+		CS_erpt (cs_INV_ARG1);
+		return -1;
+	}
+	*bufr = '\0';
+	mp = &csMetrics;
+	used = 0;
+	if (format == cs_METRICS_JSON)
+	{
+		used = CSmetricsCat (bufr,bufrSize,used,"{\"points\":{");
+	}
+	for (idx = 0;idx < 3;idx += 1)
+	{
+		sprintf (label,"{stage=\"%s\"}",stages [idx]);
+		used = CSmetricsVal (bufr,bufrSize,used,format,"points_total",label,stages [idx],(idx == 0),
+							 (idx == 0) ? mp->cs2llPnts : ((idx == 1) ? mp->ll2csPnts : mp->dtcvtPnts));
+	}
+
+	/* Transformation methods, by name; only those which have been used. */
+	if (format == cs_METRICS_JSON)
+	{
+		used = CSmetricsCat (bufr,bufrSize,used,"},\"transformations\":{");
+	}
+	first = TRUE;
+	for (idx = 0;idx < cs_METRICS_MTHSLOT;idx += 1)
+	{
+		if (mp->xfrmPnts [idx] == 0) continue;
+		methodCode = (unsigned short)(((idx & 0x70) << 8) | (idx & 0x0F));
+		sprintf (mthName,"0x%04X",(unsigned)methodCode);
+		if (idx == 0) CS_stncp (mthName,"other",sizeof (mthName));
+		for (xfrmTabPtr = cs_XfrmTab;idx != 0 && xfrmTabPtr->methodCode != cs_DTCMTH_NONE;xfrmTabPtr++)
+		{
+			if (xfrmTabPtr->methodCode == methodCode)
+			{
+				CS_stncp (mthName,xfrmTabPtr->key_nm,sizeof (mthName));
+				break;
+			}
+		}
+		sprintf (label,"{method=\"%s\"}",mthName);
+		used = CSmetricsVal (bufr,bufrSize,used,format,"transformations_total",label,mthName,first,mp->xfrmPnts [idx]);
+		first = FALSE;
+	}
+
+	/* Iterative inverse histogram. */
+	if (format == cs_METRICS_JSON)
+	{
+		used = CSmetricsCat (bufr,bufrSize,used,"},\"inverseIterations\":{");
+	}
+	for (idx = 0;idx < cs_METRICS_ITRBKT;idx += 1)
+	{
+		sprintf (mthName,(idx == cs_METRICS_ITRBKT - 1) ? "%d+" : "%d",idx);
+		sprintf (label,"{iterations=\"%s\"}",mthName);
+		used = CSmetricsVal (bufr,bufrSize,used,format,"inverse_iterations_total",label,mthName,(idx == 0),mp->itrHist [idx]);
+	}
+	used = CSmetricsVal (bufr,bufrSize,used,format,"inverse_iterations_total","{iterations=\"limit\"}","limit",FALSE,mp->itrLimit);
+
+	if (format == cs_METRICS_JSON)
+	{
+		used = CSmetricsCat (bufr,bufrSize,used,"},\"fallback\":{");
+	}
+	used = CSmetricsVal (bufr,bufrSize,used,format,"fallback_total","{result=\"ok\"}","ok",TRUE,mp->fallbackOk);
+	used = CSmetricsVal (bufr,bufrSize,used,format,"fallback_total","{result=\"failed\"}","failed",FALSE,mp->fallbackFail);
+
+	if (format == cs_METRICS_JSON)
+	{
+		used = CSmetricsCat (bufr,bufrSize,used,"},\"blockErrors\":{");
+	}
+	used = CSmetricsVal (bufr,bufrSize,used,format,"block_error_points_total","","points",TRUE,mp->blkErrPnts);
+	used = CSmetricsVal (bufr,bufrSize,used,format,"block_errors_recorded_total","","recorded",FALSE,mp->blkErrNew);
+
+	if (format == cs_METRICS_JSON)
+	{
+		used = CSmetricsCat (bufr,bufrSize,used,"},\"gridFiles\":{");
+	}
+	used = CSmetricsVal (bufr,bufrSize,used,format,"grid_lookups_total","","lookups",TRUE,mp->gridLookups);
+	used = CSmetricsVal (bufr,bufrSize,used,format,"grid_buffer_hits_total","","bufferHits",FALSE,mp->gridLookups - mp->gridMisses);
+	used = CSmetricsVal (bufr,bufrSize,used,format,"grid_reads_total","","reads",FALSE,mp->gridReads);
+	used = CSmetricsVal (bufr,bufrSize,used,format,"grid_bytes_read_total","","bytesRead",FALSE,mp->gridBytes);
+
+	if (format == cs_METRICS_JSON)
+	{
+		used = CSmetricsCat (bufr,bufrSize,used,"},\"dictionaryLookups\":{");
+	}
+	for (idx = 0;idx < 4;idx += 1)
+	{
+		sprintf (label,"{dictionary=\"%s\"}",dictNames [idx]);
+		used = CSmetricsVal (bufr,bufrSize,used,format,"dictionary_lookups_total",label,dictNames [idx],(idx == 0),
+							 (idx == 0) ? mp->csdefCount : ((idx == 1) ? mp->dtdefCount :
+							 ((idx == 2) ? mp->eldefCount : mp->gxdefCount)));
+	}
+
+	if (format == cs_METRICS_JSON)
+	{
+		used = CSmetricsCat (bufr,bufrSize,used,"},\"caches\":{");
+	}
+	for (idx = 0;idx < 3;idx += 1)
+	{
+		if (format == cs_METRICS_JSON)
+		{
+			sprintf (label,"%s\"%s\":{",(idx == 0) ? "" : ",",cacheNames [idx]);
+			used = CSmetricsCat (bufr,bufrSize,used,label);
+		}
+		sprintf (label,"{cache=\"%s\"}",cacheNames [idx]);
+		used = CSmetricsVal (bufr,bufrSize,used,format,"cache_hits_total",label,"hits",TRUE,
+							 (idx == 0) ? mp->csCacheHits : ((idx == 1) ? mp->dtcCacheHits : mp->dtmCacheHits));
+		used = CSmetricsVal (bufr,bufrSize,used,format,"cache_misses_total",label,"misses",FALSE,
+							 (idx == 0) ? mp->csCacheMisses : ((idx == 1) ? mp->dtcCacheMisses : mp->dtmCacheMisses));
+		if (format == cs_METRICS_JSON)
+		{
+			used = CSmetricsCat (bufr,bufrSize,used,"}");
+		}
+	}
+	if (format == cs_METRICS_JSON)
+	{
+		used = CSmetricsCat (bufr,bufrSize,used,"}}\n");
+	}
+	return used;
+}
+
+/******************************************************************************
+**	CS_setTraceHooks (newHooks,oldHooks);
+**
+**	struct cs_TraceHooks_ *newHooks;	the hooks to be called from now on;
+**										NULL removes all hooks.  Either
+**										function may be NULL.
+**	struct cs_TraceHooks_ *oldHooks;	the hooks previously in effect are
+**										returned here, suitable for
+**										restoring them later; may be NULL.
+**
+**	The hooks are called around the setup and conversion stages listed
+**	with the cs_TRACE_XXXX constants, typically to time them.  They must
+**	not call back into the library.
+******************************************************************************/
+void EXP_LVL1 CS_setTraceHooks (Const struct cs_TraceHooks_ *newHooks,struct cs_TraceHooks_ *oldHooks)
+{
+	extern struct cs_TraceHooks_ csTraceHooks;
+
+	if (oldHooks != NULL)
+	{
+		*oldHooks = csTraceHooks;
+	}
+	if (newHooks != NULL)
+	{
+		csTraceHooks = *newHooks;
+	}
+	else
+	{
+		memset (&csTraceHooks,0,sizeof (csTraceHooks));
+	}
+}
+/* Returns TRUE if a hook is installed; for callers which have to build
+   the name of a stage. */
+int EXP_LVL9 CStraceActive (void)
+{
+	extern struct cs_TraceHooks_ csTraceHooks;
+
+	return (csTraceHooks.bgnFunc != NULL || csTraceHooks.endFunc != NULL);
+}
+void EXP_LVL9 CStraceBgn (int stage,Const char *name)
+{
+	extern struct cs_TraceHooks_ csTraceHooks;
+
+	if (csTraceHooks.bgnFunc != NULL)
+	{
+		(*csTraceHooks.bgnFunc)(csTraceHooks.context,stage,name);
+	}
+}
+void EXP_LVL9 CStraceEnd (int stage,Const char *name,int status)
+{
+	extern struct cs_TraceHooks_ csTraceHooks;
+
+	if (csTraceHooks.endFunc != NULL)
+	{
+		(*csTraceHooks.endFunc)(csTraceHooks.context,stage,name,status);
+	}
+}
+
+/******************************************************************************
+	Arena allocator.  An arena obtains memory in large chunks from the
+	allocator in effect when the arena was created (its parent), and
+	hands it out by bumping a pointer.  Blocks released to the arena are
+	kept on a free list per block size, so that the fixed size structures
+	which are repeatedly allocated and released (e.g. the cs_Csdef_ which
+	CS_csloc reads and discards) are recycled rather than returned to the
+	heap.  All memory goes back to the parent in one step when the arena
+	is reset or deleted.
+
+	Typical use, for a short lived setup:
+
+		arena = CS_arenaNew (0);
+		CS_arenaAllocator (arena,&arenaAlloc);
+		CS_setAllocator (&arenaAlloc,&prevAlloc);
+		... use the library ...
+		CS_recvr ();
+		CS_setAllocator (&prevAlloc,NULL);
+		CS_arenaDelete (arena);
+
+	Blocks which were not allocated by the arena (e.g. allocated before
+	it was installed) are passed on to the parent when released or
+	reallocated.  Released blocks of a size for which no pool is
+	available (more than csARENA_POOLS distinct sizes are in use) are
+	kept on a single spill list, which is searched best fit when the
+	pools cannot satisfy a request.  The arena structure itself is
+	obtained from, and returned to, the parent.
+******************************************************************************/
+
+#define csARENA_ALIGN	16			/* alignment, and size of the block header */
+#define csARENA_CHUNK	(64 * 1024)	/* default chunk size */
+#define csARENA_POOLS	16			/* distinct block sizes recycled */
+
+struct csArenaChunk_
+{
+	struct csArenaChunk_ *next;
+	char *base;
+	size_t size;
+	size_t used;
+};
+struct csArenaPool_
+{
+	size_t blkSize;
+	void *head;
+};
+struct cs_Arena_
+{
+	struct csArenaChunk_ *chunks;	/* the chunk at the head is current */
+	size_t chunkSize;
+	struct cs_Allocator_ parent;	/* malcFunc NULL => system */
+	struct csArenaPool_ pools [csARENA_POOLS];
+	void *spill;					/* released blocks of other sizes */
+};
+
+static void *CSarenaParentMalc (Const struct cs_Allocator_ *parent,size_t size)
+{
+	if (parent->malcFunc != NULL) return (*parent->malcFunc)(parent->context,size);
+	return _csMalloc (size);
+}
+static void CSarenaParentFree (Const struct cs_Allocator_ *parent,void *ptr)
+{
+	void *lclPtr;
+
+	if (parent->malcFunc != NULL)
+	{
+		(*parent->freeFunc)(parent->context,ptr);
+		return;
+	}
+	lclPtr = ptr;
+	_csFree (lclPtr);
+}
+static struct csArenaChunk_ *CSarenaOwner (struct cs_Arena_ *arena,void *ptr)
+{
+	struct csArenaChunk_ *chunk;
+
+	for (chunk = arena->chunks;chunk != NULL;chunk = chunk->next)
+	{
+		if ((char *)ptr >= chunk->base && (char *)ptr < (chunk->base + chunk->used)) return chunk;
+	}
+	return NULL;
+}
+
+static void *CSarenaMalc (void *context,size_t blkSize)
+{
+	int ii;
+	size_t need;
+	size_t chunkSize;
+	char *blkPtr;
+	size_t spillSize;
+	size_t bestSize;
+	void **spillPtr;
+	void **bestPtr;
+	struct cs_Arena_ *arena;
+	struct csArenaChunk_ *chunk;
+
+	arena = (struct cs_Arena_ *)context;
+	blkSize = (blkSize + (csARENA_ALIGN - 1)) & ~((size_t)csARENA_ALIGN - 1);
+	if (blkSize == 0) blkSize = csARENA_ALIGN;
+
+	for (ii = 0;ii < csARENA_POOLS && arena->pools [ii].blkSize != 0;ii += 1)
+	{
+		if (arena->pools [ii].blkSize == blkSize && arena->pools [ii].head != NULL)
+		{
+			blkPtr = (char *)arena->pools [ii].head;
+			arena->pools [ii].head = *(void **)blkPtr;
+			return blkPtr;
+		}
+	}
+	bestPtr = NULL;
+	bestSize = 0;
+	for (spillPtr = &arena->spill;*spillPtr != NULL;spillPtr = (void **)*spillPtr)
+	{
+		spillSize = *(size_t *)((char *)*spillPtr - csARENA_ALIGN);
+		if (spillSize >= blkSize && (bestPtr == NULL || spillSize < bestSize))
+		{
+			bestPtr = spillPtr;
+			bestSize = spillSize;
+			if (spillSize == blkSize) break;
+		}
+	}
+	if (bestPtr != NULL)
+	{
+		blkPtr = (char *)*bestPtr;
+		*bestPtr = *(void **)blkPtr;
+		return blkPtr;
+	}
+
+	need = blkSize + csARENA_ALIGN;
+	chunk = arena->chunks;
+	if (chunk == NULL || (chunk->size - chunk->used) < need)
+	{
+		chunkSize = (need > arena->chunkSize) ? need : arena->chunkSize;
+		chunk = (struct csArenaChunk_ *)CSarenaParentMalc (&arena->parent,sizeof (struct csArenaChunk_) + csARENA_ALIGN + chunkSize);
+		if (chunk == NULL) return NULL;
+		chunk->base = (char *)chunk + ((sizeof (struct csArenaChunk_) + (csARENA_ALIGN - 1)) & ~((size_t)csARENA_ALIGN - 1));
+		chunk->size = chunkSize;
+		chunk->used = 0;
+		chunk->next = arena->chunks;
+		arena->chunks = chunk;
+	}
+	blkPtr = chunk->base + chunk->used;
+	chunk->used += need;
+	*(size_t *)blkPtr = blkSize;
+	return blkPtr + csARENA_ALIGN;
+}
+
+static void CSarenaFree (void *context,void *ptr)
+{
+	int ii;
+	size_t blkSize;
+	struct cs_Arena_ *arena;
+
+	arena = (struct cs_Arena_ *)context;
+	if (CSarenaOwner (arena,ptr) == NULL)
+	{
+		CSarenaParentFree (&arena->parent,ptr);
+		return;
+	}
+	blkSize = *(size_t *)((char *)ptr - csARENA_ALIGN);
+	for (ii = 0;ii < csARENA_POOLS;ii += 1)
+	{
+		if (arena->pools [ii].blkSize == 0) arena->pools [ii].blkSize = blkSize;
+		if (arena->pools [ii].blkSize == blkSize)
+		{
+			*(void **)ptr = arena->pools [ii].head;
+			arena->pools [ii].head = ptr;
+			return;
+		}
+	}
+	/* No pool available for this size. */
+	*(void **)ptr = arena->spill;
+	arena->spill = ptr;
+}
+
+static size_t CSarenaSize (void *context,void *ptr)
+{
+	struct cs_Arena_ *arena;
+
+	arena = (struct cs_Arena_ *)context;
+	if (CSarenaOwner (arena,ptr) == NULL)
+	{
+		if (arena->parent.sizeFunc != NULL) return (*arena->parent.sizeFunc)(arena->parent.context,ptr);
+		return 0;
+	}
+	return *(size_t *)((char *)ptr - csARENA_ALIGN);
+}
+
+static void *CSarenaRalc (void *context,void *ptr,size_t newSize)
+{
+	size_t oldSize;
+	void *newPtr;
+	struct cs_Arena_ *arena;
+
+	arena = (struct cs_Arena_ *)context;
+	if (ptr == NULL) return CSarenaMalc (context,newSize);
+	if (CSarenaOwner (arena,ptr) == NULL)
+	{
+		if (arena->parent.malcFunc != NULL) return (*arena->parent.ralcFunc)(arena->parent.context,ptr,newSize);
+		return _csRealloc (ptr,newSize);
+	}
+	oldSize = *(size_t *)((char *)ptr - csARENA_ALIGN);
+	if (newSize <= oldSize) return ptr;
+	newPtr = CSarenaMalc (context,newSize);
+	if (newPtr != NULL)
+	{
+		memcpy (newPtr,ptr,oldSize);
+		CSarenaFree (context,ptr);
+	}
+	return newPtr;
+}
+
+/* Creates an arena which draws chunks of chunkSize bytes (zero selects a
+   default) from the allocator currently in effect.  The library's caches
+   (datum definitions, unit lookup, the CS_cnvrt systems) are built on
+   first use through whatever allocator is installed, so CS_recvr must be
+   called before the arena's allocator is removed and the arena deleted;
+   otherwise those caches are left pointing into released memory. */
+struct cs_Arena_* EXP_LVL3 CS_arenaNew (size_t chunkSize)
+{
+	extern struct cs_Allocator_ csAllocHook;
+
+	struct cs_Arena_ *arena;
+
+	arena = (struct cs_Arena_ *)CSarenaParentMalc (&csAllocHook,sizeof (struct cs_Arena_));
+	if (arena == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		return NULL;
+	}
+	memset (arena,0,sizeof (struct cs_Arena_));
+	arena->chunkSize = (chunkSize != 0) ? chunkSize : csARENA_CHUNK;
+	arena->parent = csAllocHook;
+	return arena;
+}
+
+/* Fills in an allocator structure, suitable for CS_setAllocator, which
+   allocates from the arena. */
+void EXP_LVL3 CS_arenaAllocator (struct cs_Arena_ *arena,struct cs_Allocator_ *allocator)
+{
+	allocator->malcFunc = CSarenaMalc;
+	allocator->ralcFunc = CSarenaRalc;
+	allocator->freeFunc = CSarenaFree;
+	allocator->sizeFunc = CSarenaSize;
+	allocator->context = arena;
+}
+
+/* Releases all memory allocated from the arena at once; the largest chunk
+   is retained for reuse. */
+void EXP_LVL3 CS_arenaReset (struct cs_Arena_ *arena)
+{
+	struct csArenaChunk_ *chunk;
+	struct csArenaChunk_ *keep;
+	struct csArenaChunk_ *next;
+
+	if (arena == NULL) return;
+	keep = NULL;
+	for (chunk = arena->chunks;chunk != NULL;chunk = chunk->next)
+	{
+		if (keep == NULL || chunk->size > keep->size) keep = chunk;
+	}
+	for (chunk = arena->chunks;chunk != NULL;chunk = next)
+	{
+		next = chunk->next;
+		if (chunk != keep) CSarenaParentFree (&arena->parent,chunk);
+	}
+	if (keep != NULL)
+	{
+		keep->next = NULL;
+		keep->used = 0;
+	}
+	arena->chunks = keep;
+	memset (arena->pools,0,sizeof (arena->pools));
+	arena->spill = NULL;
+}
+
+/* Returns all chunks, and the arena itself, to the parent.  Should the
+   arena's own allocator still be installed, the parent is reinstated
+   first so that subsequent CS_malc and CS_free calls do not reach the
+   released arena. */
+void EXP_LVL3 CS_arenaDelete (struct cs_Arena_ *arena)
+{
+	extern struct cs_Allocator_ csAllocHook;
+
+	struct csArenaChunk_ *chunk;
+	struct csArenaChunk_ *next;
+	struct cs_Allocator_ parent;
+
+	if (arena == NULL) return;
+	parent = arena->parent;
+	if (csAllocHook.malcFunc == CSarenaMalc && csAllocHook.context == arena)
+	{
+		CS_setAllocator (&parent,NULL);
+	}
+	for (chunk = arena->chunks;chunk != NULL;chunk = next)
+	{
+		next = chunk->next;
+		CSarenaParentFree (&parent,chunk);
+	}
+	CSarenaParentFree (&parent,arena);
+}
+
 /******************************************************************************
 	The following function is, essentially, a case insensitive file
 	open function.  It was written by a CS-MAP user who distributes
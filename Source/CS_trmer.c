@@ -645,6 +645,7 @@ void EXP_LVL9 CStrmerS (struct cs_Csprm_ *csprm)
 	csprm->cs_sclk  = (cs_SCALK_CAST)CStrmerK;
 	csprm->cs_sclh  = (cs_SCALH_CAST)CStrmerK;
 	csprm->cs_cnvrg = (cs_CNVRG_CAST)CStrmerC;
+	csprm->cs_dstrt = (cs_DSTRT_CAST)CStrmerD;
 	csprm->llchk    = (cs_LLCHK_CAST)CStrmerL;
 	csprm->xychk    = (cs_XYCHK_CAST)CStrmerX;
 
@@ -1680,6 +1681,138 @@ double EXP_LVL9 CStrmerK (Const struct cs_Trmer_ *trmer,Const double ll [2])
 	return (kk);
 }
 
+/**********************************************************************
+**	CStrmerD (trmer,ll,khc);
+**
+**	struct m_Trmer_ *trmer;		structure containing all parameters
+**								necessary for the transformation.
+**	double ll [2];				location of the point to be computed
+**								is given here; longitude ([0]) and
+**								latitude ([1]) in degrees.
+**	double khc [3];				the K and H scale factors and the
+**								convergence angle in degrees are
+**								returned here, in that order.
+**
+**	Produces exactly the results of CStrmerK and CStrmerC, but the
+**	trigonometric terms the two have in common are computed once.
+**********************************************************************/
+
+void EXP_LVL9 CStrmerD (Const struct cs_Trmer_ *trmer,Const double ll [2],double khc [3])
+{
+	extern double cs_Degree;			/* 1.0 / 57.29577... */
+	extern double cs_Radian;			/* 57.29577... */
+	extern double cs_Zero;				/* 0.0 */
+	extern double cs_Third;				/* 0.3333333333333333 */
+	extern double cs_Half;				/* 0.5 */
+	extern double cs_One;				/* 1.0 */
+	extern double cs_Two;				/* 2.0 */
+	extern double cs_Three;				/* 3.0 */
+	extern double cs_Four;				/* 4.0 */
+	extern double cs_Five;				/* 5.0 */
+	extern double cs_Nine;				/* 9.0 */
+	extern double cs_Huge;				/* 1.0E+37 */
+	extern double cs_NPTest;			/* .001 seconds of arc
+										   short of the North Pole,
+										   in radians. */
+	extern double cs_SPTest;			/* .001 seconds of arc
+										   short of the South Pole,
+										   in radians. */
+	extern double cs_EETest;			/* 0.001 seconds of arc
+										   short of +90.00, in
+										   radians. */
+	extern double cs_WETest;			/* 0.001 seconds of arc
+										   short of -90.00, in
+										   radians. */
+	extern double cs_SclInf;			/* 9.9E+04, the value we
+										   return for an infinite
+										   scale factor. */
+
+	double kk;
+	double alpha;
+	double lng;
+	double lat;
+	double del_lng;
+	double cnv_lng;
+
+	double cos_lat;
+	double tan_lat;
+	double cos_lat_sq;
+	double tan_lat_sq;
+
+	double B;
+	double eta_sq;
+	double F2;
+	double F4;
+	double C3;
+	double C5;
+	double L;
+	double L_sq;
+
+	double tmp1;
+
+	lng = ll [LNG] * cs_Degree;
+	lat = ll [LAT] * cs_Degree;
+	del_lng = CS_adj2pi (lng - trmer->cent_lng);
+
+	if (lat > cs_NPTest)
+	{
+		tan_lat = cs_Huge;
+		cos_lat = cs_Zero;
+	}
+	else if (lat < cs_SPTest)
+	{
+		tan_lat = -cs_Huge;
+		cos_lat = cs_Zero;
+	}
+	else
+	{
+		cos_lat = cos (lat);
+		tan_lat = tan (lat);
+	}
+	cos_lat_sq = cos_lat * cos_lat;
+	eta_sq = (trmer->ecent == 0.0) ? cs_Zero : trmer->eprim_sq * cos_lat_sq;
+
+	/* The scale factor, as in CStrmerK. */
+
+	if (trmer->ecent == 0.0)
+	{
+		B = cos_lat * sin (del_lng);
+		tmp1 = cs_One - (B * B);
+		kk = (tmp1 > 1.0E-05) ? trmer->k0 / sqrt (tmp1) : cs_SclInf;
+	}
+	else
+	{
+		tan_lat_sq = (cos_lat > 0.0) ? tan_lat * tan_lat : cs_Huge;
+		F2 = cs_Half * (cs_One + eta_sq);
+		F4 = (1.0 / 12.0) * (cs_Five - cs_Four * tan_lat_sq + eta_sq * (cs_Nine - 24.0 * tan_lat_sq));
+		L_sq = (del_lng * del_lng) * cos_lat_sq;
+		kk = trmer->k0 * (cs_One + F2 * L_sq * (cs_One + F4 * L_sq));
+	}
+
+	/* The convergence, as in CStrmerC. */
+
+	cnv_lng = del_lng;
+	if (cnv_lng < cs_WETest) cnv_lng = cs_WETest;
+	if (cnv_lng > cs_EETest) cnv_lng = cs_EETest;
+	tan_lat_sq = tan_lat * tan_lat;
+	L = cnv_lng * cos_lat;
+	L_sq = L * L;
+	C3 = cs_Third * (cs_One + eta_sq * (cs_Three + cs_Two * eta_sq));
+	C5 = (1.0 / 15.0) * (cs_Two - tan_lat_sq);
+	alpha = tan_lat * L * (cs_One + L_sq * (C3 + (C5 * L_sq)));
+
+	if ((trmer->quad & csTRMER_AFFINE) != 0)
+	{
+		kk *= trmer->affineK;
+		alpha -= trmer->affineGamma;
+	}
+
+	khc [0] = kk;
+	khc [1] = kk;
+	khc [2] = alpha * cs_Radian;
+	return;
+}
+
 /**********************************************************************
 **	status = CStrmerL (trmer,cnt,pnts);
 **
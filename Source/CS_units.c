@@ -76,8 +76,47 @@ extern double (*CS_usrUnitPtr) (short type,Const char *unitName);
 **	structure of the table and the search technique is
 **	subject to change as the size of the table grows.
 **
+**	Full unit names are located through a hashed index of the
+**	table, built on first use and discarded by CS_unitAdd and
+**	CS_unitDel.  Abbreviations, and any name the index does not
+**	hold, are found by searching the table as before.
+**
 **********************************************************************/
 
+#define cs_UNITIDX_SIZE 256
+static short csUnitIdx [cs_UNITIDX_SIZE];
+static int csUnitIdxOk = FALSE;
+
+static void CSunitIdxBld (void)
+{
+	extern struct cs_Unittab_ cs_Unittab [];
+
+	int ii;
+	int slot;
+	int count;
+
+	struct cs_Unittab_ *tp;
+
+	for (slot = 0;slot < cs_UNITIDX_SIZE;slot++)
+	{
+		csUnitIdx [slot] = 0;
+	}
+	count = 0;
+	for (ii = 0;cs_Unittab [ii].type != cs_UTYP_END && count < (cs_UNITIDX_SIZE / 2);ii++)
+	{
+		tp = &cs_Unittab [ii];
+		if (tp->type != cs_UTYP_LEN && tp->type != cs_UTYP_ANG) continue;
+		slot = (int)(CSkeyHash (tp->name) % cs_UNITIDX_SIZE);
+		while (csUnitIdx [slot] != 0)
+		{
+			slot = (slot + 1) % cs_UNITIDX_SIZE;
+		}
+		csUnitIdx [slot] = (short)(ii + 1);
+		count += 1;
+	}
+	csUnitIdxOk = TRUE;
+}
+
 double EXP_LVL1 CS_unitlu (short type,Const char *name)
 {
 	extern double cs_Zero;
@@ -87,6 +126,8 @@ double EXP_LVL1 CS_unitlu (short type,Const char *name)
 
 	cs_Register struct cs_Unittab_ Huge *tp;
 
+	int slot;
+
 	Const char *ccp;
 	char *cp;
 	double usrValue;
@@ -129,8 +170,21 @@ double EXP_LVL1 CS_unitlu (short type,Const char *name)
 	}
 
 	/* Look for a match in the type and complete name portion
-	   of the table. */
+	   of the table; first in the index, then the hard way.  Entries
+	   are indexed in table order, so the first match found in the
+	   index is the first match in the table. */
 
+	if (!csUnitIdxOk) CSunitIdxBld ();
+	slot = (int)(CSkeyHash (my_name) % cs_UNITIDX_SIZE);
+	while (csUnitIdx [slot] != 0)
+	{
+		tp = &cs_Unittab [csUnitIdx [slot] - 1];
+		if (tp->type == type && !CS_stricmp (my_name,tp->name))
+		{
+			return (tp->factor);
+		}
+		slot = (slot + 1) % cs_UNITIDX_SIZE;
+	}
 	for (tp = cs_Unittab;tp->type != cs_UTYP_END;tp++)
 	{
 		if (tp->type == type &&
@@ -212,6 +266,7 @@ int EXP_LVL3 CS_unitAdd (struct cs_Unittab_ *unitPtr)
 				CS_stncp (tabPtr->abrv,unitPtr->abrv,sizeof (tabPtr->abrv));
 				tabPtr->system = unitPtr->system;
 				tabPtr->factor = unitPtr->factor;
+				csUnitIdxOk = FALSE;
 			}
 		}
 	}
@@ -245,6 +300,7 @@ int EXP_LVL3 CS_unitDel (short type,Const char *name)
 	{
 		/* Mark it as available.  This, essentially, also deletes it. */
 		tabPtr->type = cs_UTYP_OFF;
+		csUnitIdxOk = FALSE;
 	}
 	return status;
 }
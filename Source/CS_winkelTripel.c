@@ -288,6 +288,56 @@ int EXP_LVL9 CSwinklF (Const struct cs_Winkl_ *winkl,double xy [2],Const double
 	}
 	return rtn_val;	
 }
+/* Computes the partial derivatives of X and Y, as computed by CSwinklB,
+   with respect to delta longitude and latitude; i.e. the Jacobian of the
+   forward.  Used by the Newton iteration of the inverse. */
+static void CSwinklJ (Const struct cs_Winkl_ *winkl,double jacobian [2][2],double del_lng,double lat)
+{
+	extern double cs_Half;
+	extern double cs_One;
+	extern double cs_Two;
+	extern double cs_Third;
+
+	double sinHalfLng, cosHalfLng;
+	double sinLat, cosLat;
+	double uu, ss, dd;
+	double ff, dFdU;
+	double dUdLng, dUdLat;
+	double halfKa;
+
+	/* The Aitoff portion is written in terms of uu = cos (D) here:
+			X = 2 * F(uu) * cos (lat) * sin (del_lng / 2)
+			Y = F(uu) * sin (lat)
+	   where F(uu) = D / sin (D). */
+	sinHalfLng = sin (del_lng * cs_Half);
+	cosHalfLng = cos (del_lng * cs_Half);
+	sinLat = sin (lat);
+	cosLat = cos (lat);
+	uu = cosLat * cosHalfLng;
+	ss = cs_One - uu * uu;
+	if (ss < 1.0E-08)
+	{
+		/* Near the origin, use the limiting values. */
+		ff = cs_One;
+		dFdU = -cs_Third;
+	}
+	else
+	{
+		ss = sqrt (ss);
+		dd = acos (uu);
+		ff = dd / ss;
+		dFdU = (uu * ff - cs_One) / (ss * ss);
+	}
+	dUdLng = -cs_Half * cosLat * sinHalfLng;
+	dUdLat = -sinLat * cosHalfLng;
+
+	halfKa = cs_Half * winkl->ka;
+	jacobian [XX][0] = halfKa * (cs_Two * cosLat * (dFdU * dUdLng * sinHalfLng + ff * cs_Half * cosHalfLng) + winkl->cos_ref_lat);
+	jacobian [XX][1] = halfKa * (cs_Two * sinHalfLng * (dFdU * dUdLat * cosLat - ff * sinLat));
+	jacobian [YY][0] = halfKa * (dFdU * dUdLng * sinLat);
+	jacobian [YY][1] = halfKa * (dFdU * dUdLat * sinLat + ff * cosLat + cs_One);
+	return;
+}
 int EXP_LVL9 CSwinklI (Const struct cs_Winkl_ *winkl,double ll [2],Const double xy [2])
 {
 	extern double cs_One;
@@ -295,6 +345,8 @@ int EXP_LVL9 CSwinklI (Const struct cs_Winkl_ *winkl,double ll [2],Const double
 	extern double cs_AnglTest;
 	extern double cs_Mpi;
 	extern double cs_Pi;
+	extern double cs_Pi_o_2;
+	extern double cs_Mpi_o_2;
 
 	static double cnvrgK = 0.90;
 
@@ -311,6 +363,9 @@ int EXP_LVL9 CSwinklI (Const struct cs_Winkl_ *winkl,double ll [2],Const double
 	double newY;
 	double deltaX;
 	double deltaY;
+	double det;
+	double dLng, dLat;
+	double jacobian [2][2];
 
 	rtn_val = cs_CNVRT_NRML;
 
@@ -333,6 +388,9 @@ int EXP_LVL9 CSwinklI (Const struct cs_Winkl_ *winkl,double ll [2],Const double
 	if (del_lng < cs_Mpi) del_lng = cs_Mpi + cs_AnglTest;
 	else if (del_lng > cs_Pi) del_lng = cs_Pi - cs_AnglTest;
 
+	/* Newton's method, using the analytic Jacobian of the forward.  Should
+	   the Jacobian be degenerate (i.e. at the poles), or the step take us
+	   off of the map, we take the simple damped step used originally. */
 	itr_cnt = 0;
 	do
 	{
@@ -340,8 +398,24 @@ int EXP_LVL9 CSwinklI (Const struct cs_Winkl_ *winkl,double ll [2],Const double
 		deltaX = newX - xx;
 		deltaY = newY - yy;
 		dd = sqrt (deltaX * deltaX + deltaY * deltaY);
-		lat -= (deltaY / winkl->ka) * cnvrgK;
-		del_lng -= (deltaX / winkl->Rcos_ref_lat) * cnvrgK;
+		CSwinklJ (winkl,jacobian,del_lng,lat);
+		det = jacobian [XX][0] * jacobian [YY][1] - jacobian [XX][1] * jacobian [YY][0];
+		dLng = dLat = cs_Pi;
+		if (fabs (det) > (winkl->ka * winkl->ka * 1.0E-06))
+		{
+			dLng = (jacobian [YY][1] * deltaX - jacobian [XX][1] * deltaY) / det;
+			dLat = (jacobian [XX][0] * deltaY - jacobian [YY][0] * deltaX) / det;
+		}
+		if (fabs (del_lng - dLng) <= cs_Pi && (lat - dLat) >= cs_Mpi_o_2 && (lat - dLat) <= cs_Pi_o_2)
+		{
+			lat -= dLat;
+			del_lng -= dLng;
+		}
+		else
+		{
+			lat -= (deltaY / winkl->ka) * cnvrgK;
+			del_lng -= (deltaX / winkl->Rcos_ref_lat) * cnvrgK;
+		}
 		itr_cnt += 1;
 	} while (itr_cnt < 40 && dd > winkl->one_mm);
 	if (itr_cnt >= 40)
@@ -211,6 +211,13 @@ int cs_Errno = 0;
 int csErrlng = 0;
 int csErrlat = 0;
 unsigned short cs_ErrSup = 0;
+int cs_ErrMode = cs_ERRMODE_FORMAT;
+struct csErrRing_ csErrRing;				/* static zero initialization: empty, nothing pending */
+ulong32_t csErrCount [cs_ERROR_MAX + 2];	/* last element counts unknown codes */
+struct cs_Allocator_ csAllocHook = { NULL, NULL, NULL, NULL, NULL };	/* NULL malcFunc => system */
+struct cs_AllocStats_ csAllocStats;
+struct cs_Metrics_ csMetrics;
+struct cs_TraceHooks_ csTraceHooks = { NULL, NULL, NULL };	/* none installed */
 #if _RUN_TIME <= _rt_UNIXPCC
 ulong32_t cs_Doserr = 0;
 #endif
@@ -232,11 +239,14 @@ struct csCscach_ *csCscachP = NULL;
 int csCscachI = cs_CSCACH_MAX;
 struct csDtcach_ *csDtcachP = NULL;
 int csDtcachI = cs_DTCACH_MAX;
+struct csDtmcach_ *csDtmcachP = NULL;
+int csDtmcachI = cs_DTMCACH_MAX;
 
 char *cs_CsKeyNames = NULL;
 char *cs_DtKeyNames = NULL;
 char *cs_ElKeyNames = NULL;
 char *cs_CsLlEnum = NULL;
+struct csCsRngIdx_ *cs_CsRngIdx = NULL;
 struct cs_Csgrplst_ *cs_CsGrpList = NULL;
 
 /* Used for high level MGRS access. */
@@ -142,3 +142,59 @@ const char *CSsourceGridCell (struct csGridCell_* thisPtr)
 {
 	return thisPtr->sourceId;
 }
+
+/* Solves for the point which the shift cell maps to target.  On entry,
+   result carries the starting guess, usually the point at which the cell
+   was extracted.  Returns TRUE if the solution converged and lies within
+   the cell; i.e. the forward function evaluated at result would use this
+   same cell and reproduce target to within cnvrgValue.  Otherwise, result
+   still carries the best estimate available, which is a far better next
+   guess for the caller than the fixed point step. */
+int CSinvertShiftCell (Const struct csGridShiftCell_* thisPtr,double result [2],Const double target [2],double cnvrgValue)
+{
+	extern double cs_LlNoise;
+
+	int ii;
+	int converged;
+
+	double xx, yy;
+	double fLng, fLat;
+	double jLngX, jLngY;
+	double jLatX, jLatY;
+	double det;
+
+	converged = FALSE;
+	xx = yy = 0.0;
+	for (ii = 0;ii < 8;ii += 1)
+	{
+		xx = (result [LNG] - thisPtr->origin [LNG]) / thisPtr->delta [LNG];
+		yy = (result [LAT] - thisPtr->origin [LAT]) / thisPtr->delta [LAT];
+
+		/* The residual, forward at result less target. */
+		fLng = result [LNG] + thisPtr->lngCoef [0] + thisPtr->lngCoef [1] * xx +
+							  thisPtr->lngCoef [2] * yy + thisPtr->lngCoef [3] * xx * yy - target [LNG];
+		fLat = result [LAT] + thisPtr->latCoef [0] + thisPtr->latCoef [1] * xx +
+							  thisPtr->latCoef [2] * yy + thisPtr->latCoef [3] * xx * yy - target [LAT];
+
+		/* Iterations are cheap here, so we do not stop at cnvrgValue, but
+		   at what the arithmetic can deliver. */
+		converged = (fabs (fLng) <= cnvrgValue && fabs (fLat) <= cnvrgValue);
+		if (fabs (fLng) <= cs_LlNoise && fabs (fLat) <= cs_LlNoise) break;
+
+		/* The Jacobian of the forward; the identity plus the derivative of
+		   the bilinear shift.  Shifts are small relative to the cell size,
+		   so this is never far from the identity. */
+		jLngX = 1.0 + (thisPtr->lngCoef [1] + thisPtr->lngCoef [3] * yy) / thisPtr->delta [LNG];
+		jLngY =       (thisPtr->lngCoef [2] + thisPtr->lngCoef [3] * xx) / thisPtr->delta [LAT];
+		jLatX =       (thisPtr->latCoef [1] + thisPtr->latCoef [3] * yy) / thisPtr->delta [LNG];
+		jLatY = 1.0 + (thisPtr->latCoef [2] + thisPtr->latCoef [3] * xx) / thisPtr->delta [LAT];
+		det = jLngX * jLatY - jLngY * jLatX;
+		if (det < 0.5) break;
+		result [LNG] -= ( jLatY * fLng - jLngY * fLat) / det;
+		result [LAT] -= (-jLatX * fLng + jLngX * fLat) / det;
+	}
+	if (!converged) return FALSE;
+
+	/* The forward uses a cell which is inclusive on the south and west. */
+	return (xx >= 0.0 && yy >= 0.0 && xx < (1.0 - cs_LlNoise) && yy < (1.0 - cs_LlNoise));
+}
@@ -55,6 +55,30 @@ static double csTestcoords [10][3] =
 	{ 413649.0, 4294561.0, 0.0 }
 };
 
+/* The mixed workload below spreads conversions over many coordinate
+   system objects, as an application which caches hundreds of them
+   would.  This is sensitive to the layout of the cs_Csprm_ structure,
+   i.e. how many cache lines each conversion must touch. */
+#define cs_TEST_MIX_COUNT 1024
+static const char *csTestMixNames [] =
+{
+	"UTM27-13",
+	"CO83-C",
+	"LL84",
+	"UTM83-10",
+	"CA83-IV",
+	"TX83-CF",
+	"WORLD-ROBINSON",
+	"NY83-LI",
+	0
+};
+
+/* A minimal tracing hook, to measure the cost of the calls themselves. */
+static void CStest5Trace (void *context,int /*stage*/,Const char * /*name*/)
+{
+	*(long32_t *)context += 1L;
+}
+
 int CStest5 (bool verbose,long32_t duration)
 {
 	int ii;
@@ -69,6 +93,20 @@ int CStest5 (bool verbose,long32_t duration)
 	struct cs_Csprm_ *co83c;
 	struct cs_Dtcprm_ *dtcptr;
 
+	int mixIdx;
+	int mixNameCnt;
+	ulong32_t mixSeed;
+	struct cs_Csprm_ *mixCs [cs_TEST_MIX_COUNT];
+	static double mixLl [cs_TEST_MIX_COUNT][3];
+
+	int setupPass;
+	long32_t setupCnt;
+	struct cs_Csdef_ *setupDefs [16];
+	struct cs_Csprm_ *setupPrm;
+
+	long32_t traceCnt;
+	struct cs_TraceHooks_ traceHooks;
+
 	double elapsed;				/* In seconds. */
 	double dbls [3];
 
@@ -118,5 +156,128 @@ int CStest5 (bool verbose,long32_t duration)
 					cvt_cnt,elapsed);
 	printf ("Effective conversion rate = %ld conversions per second.\n",rate);
 
+	/* Now a mixed workload: the same number of round trips, each using
+	   a coordinate system chosen at random from a large collection. */
+	for (mixNameCnt = 0;csTestMixNames [mixNameCnt] != 0;mixNameCnt += 1);
+	for (ii = 0;ii < cs_TEST_MIX_COUNT;ii++)
+	{
+		mixCs [ii] = CS_csloc (csTestMixNames [ii % mixNameCnt]);
+		if (mixCs [ii] == NULL)
+		{
+			while (--ii >= 0) CS_free (mixCs [ii]);
+			return (1);
+		}
+		mixLl [ii][LNG] = mixCs [ii]->cent_mer + 0.5 * (mixCs [ii]->min_ll [LNG] + mixCs [ii]->max_ll [LNG]);
+		mixLl [ii][LAT] = 0.5 * (mixCs [ii]->min_ll [LAT] + mixCs [ii]->max_ll [LAT]);
+		mixLl [ii][HGT] = 0.0;
+	}
+
+	printf ("Measuring performance: %ld round trips over %d coordinate systems.\n",duration,cs_TEST_MIX_COUNT);
+
+	mixSeed = 1UL;
+	cvt_cnt = 0L;
+	start = clock ();
+	while (cvt_cnt < duration)
+	{
+		mixSeed = mixSeed * 1103515245UL + 12345UL;
+		mixIdx = (int)((mixSeed >> 8) % cs_TEST_MIX_COUNT);
+		CS_ll2cs (mixCs [mixIdx],dbls,mixLl [mixIdx]);
+		CS_cs2ll (mixCs [mixIdx],dbls,dbls);
+		cvt_cnt += 1L;
+	}
+	done = clock ();
+	for (ii = 0;ii < cs_TEST_MIX_COUNT;ii++)
+	{
+		CS_free (mixCs [ii]);
+	}
+
+	elapsed = (double)(done - start) / (double)CLOCKS_PER_SEC;
+	if (elapsed > 0.00001)
+	{
+		rate = (cvt_cnt > 0) ? (long32_t)((double)cvt_cnt / elapsed) : 0;
+	}
+	else
+	{
+		rate = 0;
+	}
+	printf ("Completed %ld mixed round trips in %6.2lf seconds.\n",cvt_cnt,elapsed);
+	printf ("Effective round trip rate = %ld per second.\n",rate);
+
+	/* Coordinate system setup from a definition already in memory.  The
+	   first pass drops the datum cache before each setup, the second
+	   lets it do its job. */
+	for (ii = 0;ii < mixNameCnt && ii < 16;ii++)
+	{
+		setupDefs [ii] = CS_csdef (csTestMixNames [ii]);
+		if (setupDefs [ii] == NULL)
+		{
+			while (--ii >= 0) CS_free (setupDefs [ii]);
+			return (1);
+		}
+	}
+	setupCnt = duration / 100;
+	for (setupPass = 0;setupPass < 2;setupPass++)
+	{
+		printf ("Measuring performance: %ld coordinate system setups, datum cache %s.\n",
+						setupCnt,(setupPass == 0) ? "disabled" : "enabled");
+		cvt_cnt = 0L;
+		start = clock ();
+		while (cvt_cnt < setupCnt)
+		{
+			if (setupPass == 0) CSdtlocRls ();
+			setupPrm = CScsloc1 (setupDefs [cvt_cnt % ii]);
+			if (setupPrm == NULL) break;
+			CS_free (setupPrm);
+			cvt_cnt += 1L;
+		}
+		done = clock ();
+		elapsed = (double)(done - start) / (double)CLOCKS_PER_SEC;
+		printf ("Completed %ld setups in %6.2lf seconds, %.2f microseconds each.\n",
+						cvt_cnt,elapsed,(cvt_cnt > 0) ? elapsed * 1.0E+06 / (double)cvt_cnt : 0.0);
+	}
+	while (--ii >= 0) CS_free (setupDefs [ii]);
+
+	/* Complete setup of a conversion, including opening the NADCON files,
+	   without and with (minimal) tracing hooks installed. */
+	traceCnt = 0L;
+	traceHooks.bgnFunc = CStest5Trace;
+	traceHooks.endFunc = NULL;
+	traceHooks.context = &traceCnt;
+	setupCnt = duration / 1000;
+	for (setupPass = 0;setupPass < 2;setupPass++)
+	{
+		printf ("Measuring performance: %ld UTM27-13 ==> CO83-C setups, tracing hooks %s.\n",
+						setupCnt,(setupPass == 0) ? "not installed" : "installed");
+		CS_setTraceHooks ((setupPass == 0) ? NULL : &traceHooks,NULL);
+		cvt_cnt = 0L;
+		start = clock ();
+		while (cvt_cnt < setupCnt)
+		{
+			utm13 = CS_csloc ("UTM27-13");
+			co83c = CS_csloc ("CO83-C");
+			dtcptr = NULL;
+			if (utm13 != NULL && co83c != NULL)
+			{
+				dtcptr = CS_dtcsu (utm13,co83c,cs_DTCFLG_DAT_F,cs_DTCFLG_BLK_F);
+			}
+			if (dtcptr == NULL)
+			{
+				if (utm13 != NULL) CS_free (utm13);
+				if (co83c != NULL) CS_free (co83c);
+				break;
+			}
+			CS_dtcls (dtcptr);
+			CS_free (utm13);
+			CS_free (co83c);
+			cvt_cnt += 1L;
+		}
+		done = clock ();
+		elapsed = (double)(done - start) / (double)CLOCKS_PER_SEC;
+		printf ("Completed %ld setups in %6.2lf seconds, %.2f microseconds each.\n",
+						cvt_cnt,elapsed,(cvt_cnt > 0) ? elapsed * 1.0E+06 / (double)cvt_cnt : 0.0);
+	}
+	CS_setTraceHooks (NULL,NULL);
+	if (setupCnt > 0L) printf ("%ld stages traced per setup.\n",traceCnt / setupCnt);
+
 	return (0);
 }
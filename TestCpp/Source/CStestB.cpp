@@ -66,6 +66,9 @@ int CStestB (bool verbose,long32_t duration)
 	double low_lng, hi_lng;
 	double ll [2];
 
+	double dstLl [1][3];
+	struct cs_Distortion_ dstRslt;
+
 	printf ("Checking scale and convergence for non-azimuthal projections.\n");
 
 	/* Loop through the group table and fetch a linked list
@@ -136,6 +139,27 @@ int CStestB (bool verbose,long32_t duration)
 					ll [LAT] = CStestRN (low_lat,hi_lat);
 				} while	(fabs (ll [LAT]) > 85.0);
 
+				/* The batch function must produce what the individual
+				   functions produce.  Only the Robinson convergence
+				   is computed differently, hence the tolerance. */
+
+				dstLl [0][LNG] = ll [LNG];
+				dstLl [0][LAT] = ll [LAT];
+				dstLl [0][HGT] = 0.0;
+				CS_csDistortion (csprm,dstLl,1,&dstRslt);
+				if (fabs (dstRslt.k - CS_cssck (csprm,ll)) > 1.0E-09 * fabs (dstRslt.k) ||
+					fabs (dstRslt.h - CS_cssch (csprm,ll)) > 1.0E-09 * fabs (dstRslt.h) ||
+					fabs (dstRslt.scale - CS_csscl (csprm,ll)) > 1.0E-09 * fabs (dstRslt.scale) ||
+					fabs (dstRslt.cnvrg - CS_cscnv (csprm,ll)) > 1.0E-07)
+				{
+					printf ("CS_csDistortion error, %s: lng = %11.6f, lat = %10.6f\n",
+									csprm->csdef.key_nm,
+									ll [LNG],
+									ll [LAT]);
+					err_cnt += 1;
+					brk_flg = TRUE;
+				}
+
 				/* For Azimuthal projections, K and H
 				   scale factors are often special, e.g.
 				   normal to the radial from the origin
@@ -125,6 +125,59 @@ int CStestF (bool verbose,long32_t duration)
 			err_cnt += 1;
 		}
 	}
+	printf ("Checking CS_ftoaArray and CS_atofArray against CS_ftoa and CS_atof.\n");
+	{
+		// The array forms must reproduce the single value forms exactly, byte
+		// for byte.  We use a mix of random values and values which sit right
+		// on the minutes/seconds round off boundaries.
+		const int arySize = 64;
+		int ii;
+		int fmtIdx;
+		long32_t frmtOne;
+		long32_t frmtAry [arySize];
+		long32_t flagAry [arySize];
+		double values [arySize];
+		double results [arySize];
+		const char* valuePtrs [arySize];
+		char aryBufr [arySize][32];
+
+		for (il = 0;il < (duration / arySize) + 1 && err_cnt < 4;il += 1)
+		{
+			fmtIdx = (int)(il % 7);
+			for (ii = 0;ii < arySize;ii += 1)
+			{
+				if ((ii % 8) == 0)
+				{
+					values [ii] = (double)((int)CStestRN (-179.0,179.0)) + (59.0 / 60.0) + (59.99999999 / 3600.0);
+				}
+				else
+				{
+					values [ii] = CStestRN (fTable [fmtIdx].min,fTable [fmtIdx].max);
+				}
+			}
+			CS_ftoaArray (&aryBufr [0][0],sizeof (aryBufr [0]),values,arySize,fTable [fmtIdx].format,frmtAry);
+			for (ii = 0;ii < arySize && err_cnt < 4;ii += 1)
+			{
+				frmtOne = CS_ftoa (bufr,sizeof (bufr),values [ii],fTable [fmtIdx].format);
+				if (strcmp (bufr,aryBufr [ii]) || frmtOne != frmtAry [ii])
+				{
+					printf ("CS_ftoaArray mismatch: %.12f -> '%s' vs '%s'\n",values [ii],bufr,aryBufr [ii]);
+					err_cnt += 1;
+				}
+				valuePtrs [ii] = aryBufr [ii];
+			}
+			CS_atofArray (results,valuePtrs,arySize,flagAry);
+			for (ii = 0;ii < arySize && err_cnt < 4;ii += 1)
+			{
+				frmtOne = CS_atof (&dbl2,valuePtrs [ii]);
+				if (dbl2 != results [ii] || frmtOne != flagAry [ii])
+				{
+					printf ("CS_atofArray mismatch: '%s' -> %.12f vs %.12f\n",valuePtrs [ii],dbl2,results [ii]);
+					err_cnt += 1;
+				}
+			}
+		}
+	}
 	if (localePtr != 0)
 	{
 		if (verbose)
@@ -27,6 +27,8 @@
 
 #include "csTestCpp.hpp"
 
+#include <sstream>
+
 extern "C"
 {
 	extern int cs_Error;
@@ -40,12 +42,22 @@ extern "C"
 	#endif
 	
 	extern double cs_Degree;
+	extern double cs_Pi;
+	extern double cs_Sec2Deg;
 	extern double cs_ParmTest;		/* .1 seconds of arc in degrees. */
+	extern char cs_Dir [];
+	extern char *cs_DirP;
+	extern char csErrnam [];
+	extern char csErrmsg [];
 
 	extern int (*CS_usrCsDefPtr)(struct cs_Csdef_ *ptr,Const char *keyName);
 	extern int (*CS_usrDtDefPtr)(struct cs_Dtdef_ *ptr,Const char *keyName);
 	extern int (*CS_usrElDefPtr)(struct cs_Eldef_ *ptr,Const char *keyName);
 	extern double (*CS_usrUnitPtr)(short type,Const char *unitName);
+	extern struct cs_Prjtab_ cs_Prjtab [];
+	extern struct cs_Unittab_ cs_Unittab [];
+	extern struct csDtmcach_ *csDtmcachP;
+	extern char cs_Dtname [];
 }
 
 struct _hTable1
@@ -211,6 +223,154 @@ double CSusrUnit (short type,Const char *unitName)
 	}
 	return 0.0;
 }
+/* The multiple regression polynomials as they were evaluated before
+   CSmulrgS compiled them: a double loop over all powers, consulting the
+   coefficient arrays directly.  Points must be in range. */
+static void CStestMulrgRef (Const struct csMulrg_ *mulrg,double trgLl [3],Const double srcLl [3])
+{
+	short ii;
+	short jj;
+	short idx;
+	double uu, vv;
+	double uuPwr, vvPwr;
+	double lngSum, latSum, hgtSum;
+
+	uu = (srcLl [LAT] + mulrg->uu_off) * mulrg->normalizationScale;
+	vv = (srcLl [LNG] + mulrg->vv_off) * mulrg->normalizationScale;
+	lngSum = latSum = hgtSum = 0.0;
+	uuPwr = 1.0;
+	for (ii = 0;ii <= mulrg->max_uu;ii++)
+	{
+		if (ii != 0) uuPwr *= uu;
+		vvPwr = 1.0;
+		for (jj = 0;jj <= mulrg->max_vv;jj++)
+		{
+			if (jj != 0) vvPwr *= vv;
+			idx = ii * 10 + jj;
+			if (mulrg->lambdaCoefs [idx] != 0.0) lngSum += mulrg->lambdaCoefs [idx] * uuPwr * vvPwr;
+			if (mulrg->phiCoefs [idx] != 0.0) latSum += mulrg->phiCoefs [idx] * uuPwr * vvPwr;
+			if (mulrg->heightCoefs [idx] != 0.0) hgtSum += mulrg->heightCoefs [idx] * uuPwr * vvPwr;
+		}
+	}
+	trgLl [LNG] = srcLl [LNG] + lngSum * cs_Sec2Deg;
+	trgLl [LAT] = srcLl [LAT] + latSum * cs_Sec2Deg;
+	trgLl [HGT] = srcLl [HGT] + hgtSum;
+}
+/* Tracing hooks which count the calls per stage and check that every
+   begin is matched by an end of the same stage, properly nested. */
+struct csTestTrace_
+{
+	int bgnCnt [cs_TRACE_BATCH + 1];
+	int endCnt [cs_TRACE_BATCH + 1];
+	int stack [16];
+	int depth;
+	int errors;
+	char dtcsuName [64];
+};
+static void CStestTraceBgn (void *context,int stage,Const char *name)
+{
+	struct csTestTrace_ *trace = (struct csTestTrace_ *)context;
+
+	if (stage < 1 || stage > cs_TRACE_BATCH || trace->depth >= 16 || name == NULL)
+	{
+		trace->errors += 1;
+		return;
+	}
+	trace->bgnCnt [stage] += 1;
+	trace->stack [trace->depth++] = stage;
+	if (stage == cs_TRACE_DTCSU) CS_stncp (trace->dtcsuName,name,sizeof (trace->dtcsuName));
+}
+static void CStestTraceEnd (void *context,int stage,Const char * /*name*/,int status)
+{
+	struct csTestTrace_ *trace = (struct csTestTrace_ *)context;
+
+	if (stage < 1 || stage > cs_TRACE_BATCH || trace->depth <= 0 || trace->stack [trace->depth - 1] != stage)
+	{
+		trace->errors += 1;
+		return;
+	}
+	trace->endCnt [stage] += 1;
+	trace->depth -= 1;
+	if (stage != cs_TRACE_DTCPH1 && stage != cs_TRACE_DTCPH2 &&
+		stage != cs_TRACE_DTCPH3 && stage != cs_TRACE_DTCPH4 && status < 0)
+	{
+		trace->errors += 1;
+	}
+}
+
+/* Reads all of csvText through the supplied reader, and through
+   csGetCsvRecord and csCsvFieldParse, and counts the differences in status,
+   fields and end of file indication. */
+static int CStestCsvReader (TcsCsvReader& csvReader,const wchar_t* csvText,const wchar_t* delimiters)
+{
+	int errCnt;
+	int recCnt;
+	short fldNbr;
+	EcsCsvStatus refStatus;
+	EcsCsvStatus rdrStatus;
+	std::wstring refRecord;
+	std::wstring rdrField;
+	std::vector<std::wstring> refFields;
+	std::wistringstream refStrm (csvText);
+
+	errCnt = 0;
+	for (recCnt = 0;recCnt < 100 && errCnt == 0;recCnt += 1)
+	{
+		refStatus = csGetCsvRecord (refRecord,refStrm,delimiters);
+		rdrStatus = csvReader.NextRecord ();
+		if (rdrStatus != refStatus)
+		{
+			errCnt += 1;
+			break;
+		}
+		if (refStatus == csvOk)
+		{
+			refStatus = csCsvFieldParse (refFields,refRecord,delimiters);
+			rdrStatus = csvReader.ParseFields ();
+			if (rdrStatus != refStatus)
+			{
+				errCnt += 1;
+			}
+			else if (refStatus == csvOk)
+			{
+				if (csvReader.FieldCount () != static_cast<short>(refFields.size ()))
+				{
+					errCnt += 1;
+				}
+				for (fldNbr = 0;fldNbr < csvReader.FieldCount () && errCnt == 0;fldNbr += 1)
+				{
+					if (!csvReader.GetField (rdrField,fldNbr) || rdrField != refFields [static_cast<size_t>(fldNbr)])
+					{
+						errCnt += 1;
+					}
+				}
+			}
+		}
+		if (csvReader.AtEof () != !refStrm.good ())
+		{
+			errCnt += 1;
+		}
+		if (!refStrm.good ()) break;
+	}
+	return errCnt;
+}
+/* Compares TcsCsvReader, reading from a stream in the smallest blocks, in
+   the default blocks, and from memory, with the original functions. */
+static int CStestCsv (const wchar_t* csvText,const wchar_t* delimiters)
+{
+	int errCnt;
+
+	std::wistringstream smlStrm (csvText);
+	std::wistringstream dfltStrm (csvText);
+	TcsCsvReader smlReader (smlStrm,delimiters,16);
+	TcsCsvReader dfltReader (dfltStrm,delimiters);
+	TcsCsvReader memReader (csvText,wcslen (csvText),delimiters);
+
+	errCnt  = CStestCsvReader (smlReader,csvText,delimiters);
+	errCnt += CStestCsvReader (dfltReader,csvText,delimiters);
+	errCnt += CStestCsvReader (memReader,csvText,delimiters);
+	return errCnt;
+}
 
 struct _mgrsTable
 {
@@ -304,6 +464,177 @@ int CStestH (bool verbose,long32_t duration)
 	double utmUps [2];
 	double delUtm [2];
 	char rsltMgrs [32];
+	int mgrsCnt;
+	int mgrsStatus [32];
+	Const char *mgrsStrings [32];
+	double mgrsLatLng [32][2];
+	double mgrsRslt [32][2];
+	char mgrsArray [32][16];
+
+	int geoIdx;
+	int geoCnt;
+	int geoFails;
+	clock_t geoStart;
+	double geoSingle;
+	double geoArray;
+	double geoDist;
+	double geoAz;
+	double geoLl [2];
+	static double geoFrom [1000][2];
+	static double geoTo [1000][2];
+	static double geoAzs [1000];
+	static double geoDists [1000];
+	static double geoRslt [1000][2];
+	static int geoStatus [1000];
+	static const double geoRefs [4][6] =
+	{
+		/* From longitude, latitude; to longitude, latitude; azimuth, distance. */
+		{   0.0, -30.12345, 179.98,   30.12344, 177.80428268687686, 20003893.428930447 },
+		{   0.0,   0.0,     179.5,     0.5,      25.67187284110006,  19936288.578908417 },
+		{   0.0,   0.0,     179.5,     0.0,      55.96649496117499,  19980861.908868734 },
+		{   0.0,   0.0,     180.0,     0.0,       0.0,                20003931.458554536 }
+	};
+
+	int rngIdx;
+	int rngCnt;
+	int crypt;
+	csFILE *csStrm;
+	double rngLl [2];
+	char rngName [32];
+	int enumCursor;
+	int enumCnt;
+	char enumName [32];
+	struct cs_Csenum_ *enumArray;
+	int jgdIdx;
+	int jgdSt1;
+	int jgdSt2;
+	FILE *jgdStrm;
+	ulong32_t jgdMesh;
+	double jgdLl [2];
+	double jgdRslt1 [2];
+	double jgdRslt2 [2];
+	char jgdPath [MAXPATH];
+	struct cs_Japan_ *jgdDisk;
+	struct cs_Japan_ *jgdHash;
+	int errNum;
+	int errMode;
+	ulong32_t errCount;
+	char errMsg1 [256];
+	char errMsg2 [256];
+	int chkIdx;
+	int chkBad;
+	int chkCnt;
+	struct cs_Csprm_ *chkPrm;
+	static double chkPnts [500][3];
+	static unsigned char chkStat [500];
+	int extSt;
+	int extIdx;
+	void *arenaForeign;
+	struct cs_Arena_ *arenaPtr;
+	struct cs_Csprm_ *arenaCs;
+	struct cs_Allocator_ arenaAlloc;
+	struct cs_Allocator_ arenaPrev;
+	struct cs_AllocStats_ arenaStats;
+	void *arenaBlks [24];
+	void *arenaBlk;
+	int arenaIdx;
+	int shiftOk;
+	struct csGridShiftCell_ shiftCell;
+	double shiftSrc [2];
+	double shiftTrg [2];
+	double shiftRslt [2];
+	double shiftXx, shiftYy;
+	double shiftLl [3];
+	int helmIdx;
+	struct cs_GeodeticTransform_ *helmDef;
+	struct cs_GxXform_ *helmXfrm;
+	double helmSrc [3];
+	double helmTrg [3];
+	double helmBack [3];
+	static short helmMethods [3] = {cs_DTCMTH_BURSA,cs_DTCMTH_FRAME,cs_DTCMTH_7PARM};
+	int itrIdx;
+	struct cs_Csdef_ *itrDef;
+	struct cs_Csprm_ *itrPrm;
+	double itrLl [3];
+	double itrXy [3];
+	double itrBack [3];
+	static const char *itrNames [4] = {"WGS84.Winkel","CzechJTSK/5b.Krovak","WORLD-ROBINSON","WORLD-ROBINSON"};
+	static double itrTol [4] = {1.0E-08,1.0E-11,1.0E-06,1.0E-10};
+	static double itrRng [4][4] = {{-179.9,179.9,-89.9,89.9},
+								   {  12.0, 19.0, 48.5,51.1},
+								   {-179.9,179.9,-89.9,89.9},
+								   {-179.9,179.9,-89.9,89.9}};
+	int setupIdx;
+	struct cs_Prjtab_ *setupPrj;
+	struct cs_Prjtab_ *setupLin;
+	struct cs_Unittab_ *setupUnit;
+	struct cs_Unittab_ *setupUnitLin;
+	struct cs_Dtdef_ *setupDtDef;
+	struct cs_Datum_ *setupDt1;
+	struct cs_Datum_ *setupDt2;
+	struct cs_Datum_ *setupDt3;
+	char *setupCp;
+	char setupName [32];
+	char setupPath [MAXPATH];
+	static const char *setupDtNames [] = { "NAD27", "NAD83", "WGS84", "ETRF89", "OSGB", 0 };
+	int tileIdx;
+	int tileRow;
+	int tileCol;
+	double tileSpan;
+	double tileXy [3];
+	static double tileExact [64 * 64][2];
+	static double tileInterp [64 * 64][2];
+	static const char *tileSrc [3] = { "UTM83-13", "LL27", "CO83-C" };
+	static double tileTol [3] = { 0.01, 1.0E-07, 0.01 };
+	int mulrgNbr;
+	int mulrgIdx;
+	int mulrgStat;
+	double mulrgRng;
+	double mulrgRef [3];
+	double mulrgSrc [37][3];
+	double mulrgOne [37][3];
+	struct cs_GxXform_ *mulrgXfrm;
+	struct csMulrg_ *mulrg;
+	static const char *mulrgNames [3] = { "ADINDAN_to_WGS84", "NAD27-48_to_WGS84", "OSGB_to_WGS84" };
+	int metricsLen;
+	size_t metricsItr;
+	double metricsXy [3];
+	struct cs_Metrics_ metrics;
+	static char metricsBufr [8192];
+	int csvIdx;
+	static const wchar_t *csvTexts [] =
+	{
+		L"Name,\"Key, with a separator\",Value\n\"A much longer quoted field\",\"\",12.5\n",
+		L"\"He said \"\"Hello\"\"\",\"\"\"\"\",x\n\"\"\"Quoted at both ends\"\"\",y\n",
+		L"\"First line\nsecond line\",z\r\n\"Carriage\r\nreturn\",w\r\nlast,record\r\n",
+		L"a,b\n\nc,\"no new line at the end\"",
+		L"a,\"unterminated\nb,c\n",
+		0
+	};
+	double traceXy [3];
+	double traceLine [3][3];
+	double (*tracePnts)[3];
+	int traceAlloc;
+	int traceCnt;
+	struct csTestTrace_ trace;
+	struct cs_TraceHooks_ traceHooks;
+	struct cs_TraceHooks_ tracePrev;
+	int lineIdx;
+	int lineAlloc;
+	int lineCnt;
+	int lineAllocPrev;
+	double (*linePnts)[3];
+	double lineSrc [3][3];
+	double ringSrc [5][3];
+	double extMin [2];
+	double extMax [2];
+	double extSrcMin [2];
+	double extSrcMax [2];
+	double extBrtMin [2];
+	double extBrtMax [2];
+	double extXy [3];
+	static const char *chkNames [] = { "UTM27-13", "LL84", "WORLD-ROBINSON", "CO83-C", "WORLD-MERCATOR", "NZTM", "CZ-S-JTSK", 0 };
+	struct cs_Csdef_ rngDef;
 
 	printf ("Testing miscellaneous functions\n");
 	err_cnt = 0;
@@ -598,8 +929,1102 @@ int CStestH (bool verbose,long32_t duration)
 			err_cnt += 1;
 		}
 	}
+
+	/* The array functions must produce the same results as the single
+	   point functions. */
+	mgrsCnt = 0;
+	for (tblPtr = mgrsTable;tblPtr->mgrs [0] != '\0' && mgrsCnt < 32;tblPtr += 1)
+	{
+		CS_atof (&mgrsLatLng [mgrsCnt][0],tblPtr->lng);
+		CS_atof (&mgrsLatLng [mgrsCnt][1],tblPtr->lat);
+		mgrsStrings [mgrsCnt] = tblPtr->mgrs;
+		mgrsCnt += 1;
+	}
+	iStat = CScalcMgrsFromLlArray (mgrsPtr,&mgrsArray [0][0],sizeof (mgrsArray [0]),mgrsLatLng,mgrsCnt,5,mgrsStatus);
+	for (idx = 0;idx < mgrsCnt;idx += 1)
+	{
+		status = CScalcMgrsFromLl (mgrsPtr,rsltMgrs,sizeof (rsltMgrs),mgrsLatLng [idx],5);
+		if (iStat != 0 || status != mgrsStatus [idx] || strcmp (rsltMgrs,mgrsArray [idx]))
+		{
+			printf ("CScalcMgrsFromLlArray failure at index %d.\n",idx);
+			err_cnt += 1;
+		}
+	}
+	iStat = CScalcLlFromMgrsArray (mgrsPtr,mgrsRslt,mgrsStrings,mgrsCnt,cs_MGRS_GRDSQR_CENTER,mgrsStatus);
+	for (idx = 0;idx < mgrsCnt;idx += 1)
+	{
+		status = CScalcLlFromMgrs (mgrsPtr,rsltLatLng,mgrsStrings [idx]);
+		if (iStat != 0 || status != mgrsStatus [idx] ||
+			rsltLatLng [0] != mgrsRslt [idx][0] || rsltLatLng [1] != mgrsRslt [idx][1])
+		{
+			printf ("CScalcLlFromMgrsArray failure at index %d.\n",idx);
+			err_cnt += 1;
+		}
+	}
+
+	/* Dynamic UTM/UPS zone array: random points all over the globe,
+	   plus one in the Norway exception and one invalid point. */
+	for (idx = 0;idx < 32;idx += 1)
+	{
+		mgrsLatLng [idx][0] = CStestRN (-180.0,180.0);
+		mgrsLatLng [idx][1] = CStestRN (-90.0,90.0);
+	}
+	mgrsLatLng [30][0] = 5.0;
+	mgrsLatLng [30][1] = 60.0;
+	mgrsLatLng [31][1] = 91.0;
+	iStat = CScalcUtmUpsArray (mgrsPtr,mgrsRslt,mgrsLatLng,32,mgrsStatus);
+	for (idx = 0;idx < 32;idx += 1)
+	{
+		status = CScalcUtmUps (mgrsPtr,utmUps,mgrsLatLng [idx]);
+		if (iStat != 1 || status != mgrsStatus [idx] ||
+			(status != 0 && (utmUps [0] != mgrsRslt [idx][0] || utmUps [1] != mgrsRslt [idx][1])))
+		{
+			printf ("CScalcUtmUpsArray failure at index %d.\n",idx);
+			err_cnt += 1;
+		}
+	}
+	if (mgrsStatus [30] != 32 || mgrsStatus [31] != 0)
+	{
+		printf ("CScalcUtmUpsArray zone selection failure.\n");
+		err_cnt += 1;
+	}
 	CS_free (mgrsPtr);
 
+	/* Test the array geodesic functions.  These use a series solution
+	   rather than the Vincenty iteration of the single point functions,
+	   so results must agree within a tenth of a millimeter wherever
+	   Vincenty is well behaved (i.e. short of nearly antipodal), and the
+	   direct must return the inverse's end point.  The nearly antipodal
+	   reference values were computed with GeographicLib.  We also time
+	   both inverse solutions as a benchmark. */
+	for (geoIdx = 0;geoIdx < 4;geoIdx += 1)
+	{
+		geoFrom [geoIdx][0] = geoRefs [geoIdx][0];
+		geoFrom [geoIdx][1] = geoRefs [geoIdx][1];
+		geoTo [geoIdx][0] = geoRefs [geoIdx][2];
+		geoTo [geoIdx][1] = geoRefs [geoIdx][3];
+	}
+	CS_llazddArray (6378137.0,0.00669438000426089,geoFrom,geoTo,4,geoAzs,geoDists);
+	for (geoIdx = 0;geoIdx < 4;geoIdx += 1)
+	{
+		if (fabs (geoAzs [geoIdx] - geoRefs [geoIdx][4]) > 1.0E-08 ||
+			fabs (geoDists [geoIdx] - geoRefs [geoIdx][5]) > 1.0E-06)
+		{
+			printf ("CS_llazddArray antipodal failure at index %d.\n",geoIdx);
+			err_cnt += 1;
+		}
+	}
+	geoCnt = sizeof (geoAzs) / sizeof (double);
+	geoSingle = geoArray = 0.0;
+	for (idx = 0;idx < duration && err_cnt < 10;idx += geoCnt)
+	{
+		for (geoIdx = 0;geoIdx < geoCnt;geoIdx += 1)
+		{
+			geoFrom [geoIdx][0] = CStestRN (-180.0,180.0);
+			geoFrom [geoIdx][1] = CStestRN (-89.0,89.0);
+			geoTo [geoIdx][0] = CStestRN (-180.0,180.0);
+			geoTo [geoIdx][1] = CStestRN (-89.0,89.0);
+		}
+		geoStart = clock ();
+		CS_llazddArray (6378137.0,0.00669438000426089,geoFrom,geoTo,geoCnt,geoAzs,geoDists);
+		geoArray += (double)(clock () - geoStart) / (double)CLOCKS_PER_SEC;
+		geoStart = clock ();
+		for (geoIdx = 0;geoIdx < geoCnt;geoIdx += 1)
+		{
+			geoAz = CS_llazdd (6378137.0,0.00669438000426089,geoFrom [geoIdx],geoTo [geoIdx],&geoDist);
+			if (geoDist > 19500000.0) continue;
+			if (fabs (geoAz - geoAzs [geoIdx]) > 1.0E-07 || fabs (geoDist - geoDists [geoIdx]) > 1.0E-04)
+			{
+				printf ("CS_llazddArray failure at index %d.\n",geoIdx);
+				err_cnt += 1;
+			}
+		}
+		geoSingle += (double)(clock () - geoStart) / (double)CLOCKS_PER_SEC;
+		geoFails = CS_azddllArray (6378137.0,0.00669438000426089,geoFrom,geoAzs,geoDists,geoCnt,geoRslt,geoStatus);
+		for (geoIdx = 0;geoIdx < geoCnt;geoIdx += 1)
+		{
+			if (geoStatus [geoIdx] != 0)
+			{
+				printf ("CS_azddllArray status failure at index %d.\n",geoIdx);
+				err_cnt += 1;
+			}
+			geoLl [0] = fabs (geoRslt [geoIdx][0] - geoTo [geoIdx][0]);
+			if (geoLl [0] > 180.0) geoLl [0] = 360.0 - geoLl [0];
+			geoLl [1] = fabs (geoRslt [geoIdx][1] - geoTo [geoIdx][1]);
+			if (geoLl [0] > 1.0E-09 || geoLl [1] > 1.0E-09)
+			{
+				printf ("CS_azddllArray failure at index %d.\n",geoIdx);
+				err_cnt += 1;
+			}
+		}
+		if (geoFails != 0)
+		{
+			printf ("CS_azddllArray reported %d failures.\n",geoFails);
+			err_cnt += 1;
+		}
+	}
+
+	/* Points with an invalid latitude must be reported individually. */
+	geoFrom [0][1] = 91.0;
+	geoFrom [1][1] = -90.5;
+	geoFrom [2][1] = 45.0;
+	geoFails = CS_azddllArray (6378137.0,0.00669438000426089,geoFrom,geoAzs,geoDists,3,geoRslt,geoStatus);
+	if (geoFails != 2 || geoStatus [0] != -1 || geoStatus [1] != -1 || geoStatus [2] != 0)
+	{
+		printf ("CS_azddllArray failed to report invalid input.\n");
+		err_cnt += 1;
+	}
+	if (verbose)
+	{
+		printf ("Geodesic inverse: CS_llazdd %6.3f seconds, CS_llazddArray %6.3f seconds.\n",geoSingle,geoArray);
+	}
+
+	/* The useful range enumeration must select exactly the systems a
+	   straight pass through the dictionary does, in the same order. */
+	for (idx = 0;idx < 40 && err_cnt < 10;idx += 1)
+	{
+		rngLl [0] = (idx == 0) ? 0.0 : CStestRN (-180.0,180.0);
+		rngLl [1] = (idx == 0) ? 0.0 : CStestRN (-90.0,90.0);
+		rngCnt = CS_csRangeEnumSetup (rngLl [0],rngLl [1]);
+		csStrm = CS_csopn (_STRM_BINRD);
+		if (rngCnt < 0 || csStrm == NULL)
+		{
+			printf ("CS_csRangeEnumSetup failure.\n");
+			err_cnt += 1;
+			if (csStrm != NULL) CS_csDictCls (csStrm);
+			break;
+		}
+		rngIdx = 0;
+		while (CS_csrd (csStrm,&rngDef,&crypt) > 0)
+		{
+			if (rngLl [0] >= rngDef.ll_min [0] && rngLl [1] >= rngDef.ll_min [1] &&
+				rngLl [0] <= rngDef.ll_max [0] && rngLl [1] <= rngDef.ll_max [1])
+			{
+				if (CS_csRangeEnum (rngIdx,rngName,sizeof (rngName)) <= 0 || strcmp (rngName,rngDef.key_nm))
+				{
+					printf ("CS_csRangeEnum failure at %f:%f (%s).\n",rngLl [0],rngLl [1],rngDef.key_nm);
+					err_cnt += 1;
+					break;
+				}
+				rngIdx += 1;
+			}
+		}
+		CS_csDictCls (csStrm);
+		if (rngIdx != rngCnt)
+		{
+			printf ("CS_csRangeEnumSetup count failure at %f:%f.\n",rngLl [0],rngLl [1]);
+			err_cnt += 1;
+		}
+	}
+
+	/* Group and datum filters. */
+	rngLl [0] = -105.0;
+	rngLl [1] = 39.5;
+	rngCnt = CS_csRangeEnumSetupEx (rngLl,rngLl,"UTM",NULL);
+	for (idx = 0;idx < rngCnt;idx += 1)
+	{
+		CS_csRangeEnum (idx,rngName,sizeof (rngName));
+		csPtr = CS_csdef (rngName);
+		if (csPtr == NULL || CS_stricmp (csPtr->group,"UTM"))
+		{
+			printf ("CS_csRangeEnumSetupEx group filter failure (%s).\n",rngName);
+			err_cnt += 1;
+		}
+		if (csPtr != NULL) CS_free (csPtr);
+	}
+	rngCnt = CS_csRangeEnumSetupEx (rngLl,rngLl,NULL,"NAD83");
+	for (idx = 0;idx < rngCnt;idx += 1)
+	{
+		CS_csRangeEnum (idx,rngName,sizeof (rngName));
+		csPtr = CS_csdef (rngName);
+		if (csPtr == NULL || CS_stricmp (csPtr->dat_knm,"NAD83"))
+		{
+			printf ("CS_csRangeEnumSetupEx datum filter failure (%s).\n",rngName);
+			err_cnt += 1;
+		}
+		if (csPtr != NULL) CS_free (csPtr);
+	}
+	if (rngCnt <= 0)
+	{
+		printf ("CS_csRangeEnumSetupEx datum filter found nothing.\n");
+		err_cnt += 1;
+	}
+
+	/* The cursor and bulk enumerators must agree with CS_csEnum. */
+	enumCursor = 0;
+	enumCnt = CS_csEnumAll (&enumArray);
+	if (enumCnt <= 0 || enumArray == NULL)
+	{
+		printf ("CS_csEnumAll failure.\n");
+		err_cnt += 1;
+	}
+	else
+	{
+		for (idx = 0;CS_csEnumNext (&enumCursor,enumName,sizeof (enumName)) > 0;idx += 1)
+		{
+			CS_csEnum (idx,rngName,sizeof (rngName));
+			if (enumCursor != idx + 1 || strcmp (enumName,rngName) ||
+				idx >= enumCnt || strcmp (enumName,enumArray [idx].key_nm))
+			{
+				printf ("CS_csEnumNext/CS_csEnumAll failure at index %d.\n",idx);
+				err_cnt += 1;
+				break;
+			}
+		}
+		if (idx != enumCnt || CS_csEnum (idx,rngName,sizeof (rngName)) != 0)
+		{
+			printf ("CS_csEnumNext/CS_csEnumAll count failure.\n");
+			err_cnt += 1;
+		}
+		CS_free (enumArray);
+	}
+
+	/* The JGD2000 grid file object must produce the same results whether
+	   it searches the binary file or loads it into a hash table.  We
+	   manufacture a small .par file with a hole in it for this purpose. */
+	CS_stcpy (cs_DirP,"CStestH.par");
+	CS_stncp (jgdPath,cs_Dir,sizeof (jgdPath));
+	*cs_DirP = '\0';
+	jgdStrm = fopen (jgdPath,"w");
+	if (jgdStrm != NULL)
+	{
+		fprintf (jgdStrm,"JGD2000 test file\nMeshCode   dB(sec)   dL(sec)\n");
+		for (jgdIdx = 0;jgdIdx < 100;jgdIdx += 1)
+		{
+			if (jgdIdx == 44) continue;
+			jgdLl [0] = 139.0 + (double)(jgdIdx % 10) * (45.0 / 3600.0) + 1.0E-08;
+			jgdLl [1] =  35.0 + (double)(jgdIdx / 10) * (30.0 / 3600.0) + 1.0E-08;
+			jgdMesh = CSjpnLlToMeshCode (jgdLl);
+			fprintf (jgdStrm,"%lu %9.5f %9.5f\n",(unsigned long)jgdMesh,
+											  11.5 + 0.01 * (double)(jgdIdx % 7),
+											  -9.5 + 0.02 * (double)(jgdIdx % 5));
+		}
+		fclose (jgdStrm);
+	}
+	jgdDisk = CSnewJgd2kGridFile (jgdPath,0L,0UL,0.0);
+	jgdHash = CSnewJgd2kGridFile (jgdPath,0x7FFFFFFFL,0UL,0.0);
+	if (jgdStrm == NULL || jgdDisk == NULL || jgdHash == NULL)
+	{
+		printf ("CSnewJgd2kGridFile failure.\n");
+		err_cnt += 1;
+	}
+	else
+	{
+		for (jgdIdx = 0;jgdIdx < 2000;jgdIdx += 1)
+		{
+			jgdLl [0] = CStestRN (139.0,139.0 + (10.0 * 45.0 / 3600.0));
+			jgdLl [1] = CStestRN ( 35.0, 35.0 + (10.0 * 30.0 / 3600.0));
+			jgdSt1 = CScalcJgd2kGridFile (jgdDisk,jgdRslt1,jgdLl);
+			jgdSt2 = CScalcJgd2kGridFile (jgdHash,jgdRslt2,jgdLl);
+			if (jgdSt1 != jgdSt2 || jgdRslt1 [0] != jgdRslt2 [0] || jgdRslt1 [1] != jgdRslt2 [1])
+			{
+				printf ("JGD2000 mesh hash failure at %f:%f.\n",jgdLl [0],jgdLl [1]);
+				err_cnt += 1;
+				break;
+			}
+		}
+		if (jgdHash->meshHash == NULL || jgdDisk->meshHash != NULL ||
+			jgdHash->cellMisses == 0UL || (jgdHash->cellHits + jgdHash->cellMisses) != 2000UL)
+		{
+			printf ("JGD2000 mesh hash was not used as expected.\n");
+			err_cnt += 1;
+		}
+		if (verbose)
+		{
+			printf ("JGD2000 cell cache: %lu hits, %lu misses.\n",(unsigned long)jgdHash->cellHits,
+																  (unsigned long)jgdHash->cellMisses);
+		}
+		CS_remove (jgdHash->binaryPath);
+	}
+	CSdeleteJgd2kGridFile (jgdDisk);
+	CSdeleteJgd2kGridFile (jgdHash);
+	CS_remove (jgdPath);
+
+	/* Lazy error reporting must produce the same message text as the
+	   immediate formatting mode does, the recent error ring must hold the
+	   errors in order, and the counters only mode must not touch the
+	   message text. */
+	errMode = CS_errorMode (cs_ERRMODE_FORMAT);
+	CS_stncp (csErrnam,"CStestH-1",MAXPATH);
+	CS_erpt (cs_CS_NOT_FND);
+	CS_errmsg (errMsg1,sizeof (errMsg1));
+	CS_errorMode (cs_ERRMODE_LAZY);
+	CS_stncp (csErrnam,"CStestH-2",MAXPATH);
+	CS_erpt (cs_DT_NOT_FND);
+	CS_stncp (csErrnam,"CStestH-1",MAXPATH);
+	CS_erpt (cs_CS_NOT_FND);
+	CS_stncp (csErrnam,"<?>",MAXPATH);
+	CS_errmsg (errMsg2,sizeof (errMsg2));
+	if (cs_Error != cs_CS_NOT_FND || strcmp (errMsg1,errMsg2))
+	{
+		printf ("Lazy CS_erpt/CS_errmsg failure.\n");
+		err_cnt += 1;
+	}
+	if (!CS_errorRecent (1,&errNum,errMsg2,sizeof (errMsg2)) || errNum != cs_DT_NOT_FND ||
+		strstr (errMsg2,"CStestH-2") == NULL)
+	{
+		printf ("CS_errorRecent failure.\n");
+		err_cnt += 1;
+	}
+	CS_errorMode (cs_ERRMODE_COUNT);
+	errCount = CS_errorCount (cs_DTC_RNG_W);
+	CS_stncp (csErrmsg,"CStestH",cs_ERRMSG_SIZE);
+	for (idx = 0;idx < 1000;idx += 1)
+	{
+		CS_erpt (cs_DTC_RNG_W);
+	}
+	if (cs_Error != cs_DTC_RNG_W || strcmp (csErrmsg,"CStestH") ||
+		CS_errorCount (cs_DTC_RNG_W) != (errCount + 1000UL) || CS_errorCount (0) < 1000UL)
+	{
+		printf ("Counters only CS_erpt failure.\n");
+		err_cnt += 1;
+	}
+	CS_errorMode (errMode);
+
+	/* The array domain checkers must agree, point for point, with
+	   CS_llchk and CS_xychk. */
+	for (chkIdx = 0;chkNames [chkIdx] != 0;chkIdx += 1)
+	{
+		chkPrm = CS_csloc (chkNames [chkIdx]);
+		if (chkPrm == NULL)
+		{
+			printf ("CS_csloc failed on %s.\n",chkNames [chkIdx]);
+			err_cnt += 1;
+			continue;
+		}
+		for (idx = 0;idx < 500;idx += 1)
+		{
+			chkPnts [idx][0] = CStestRN (-200.0,200.0);
+			chkPnts [idx][1] = CStestRN (-95.0,95.0);
+			chkPnts [idx][2] = 0.0;
+		}
+		chkBad = CS_llchkArray (chkPrm,500,chkPnts,chkStat);
+		chkCnt = 0;
+		for (idx = 0;idx < 500;idx += 1)
+		{
+			if (chkStat [idx] != CS_llchk (chkPrm,1,&chkPnts [idx]))
+			{
+				printf ("CS_llchkArray failure on %s at index %d.\n",chkNames [chkIdx],idx);
+				err_cnt += 1;
+				break;
+			}
+			if (chkStat [idx] != cs_CNVRT_OK) chkCnt += 1;
+		}
+		if (chkBad != chkCnt)
+		{
+			printf ("CS_llchkArray count failure on %s.\n",chkNames [chkIdx]);
+			err_cnt += 1;
+		}
+		for (idx = 0;idx < 500;idx += 1)
+		{
+			chkPnts [idx][0] = CStestRN (chkPrm->min_xy [0] * 1.5 - 1.0E+05,chkPrm->max_xy [0] * 1.5 + 1.0E+05);
+			chkPnts [idx][1] = CStestRN (chkPrm->min_xy [1] * 1.5 - 1.0E+05,chkPrm->max_xy [1] * 1.5 + 1.0E+05);
+		}
+		chkBad = CS_xychkArray (chkPrm,500,chkPnts,chkStat);
+		chkCnt = 0;
+		for (idx = 0;idx < 500;idx += 1)
+		{
+			if (chkStat [idx] != CS_xychk (chkPrm,1,&chkPnts [idx]))
+			{
+				printf ("CS_xychkArray failure on %s at index %d.\n",chkNames [chkIdx],idx);
+				err_cnt += 1;
+				break;
+			}
+			if (chkStat [idx] != cs_CNVRT_OK) chkCnt += 1;
+		}
+		if (chkBad != chkCnt)
+		{
+			printf ("CS_xychkArray count failure on %s.\n",chkNames [chkIdx]);
+			err_cnt += 1;
+		}
+		CS_free (chkPrm);
+	}
+
+	/* The adaptively densified extent must match a brute force dense
+	   sampling of the boundary. */
+	extSrcMin [0] = 200000.0;
+	extSrcMin [1] = 3500000.0;
+	extSrcMax [0] = 800000.0;
+	extSrcMax [1] = 5000000.0;
+	extSt = CS_cnvrtExtent ("UTM27-13","LL27",extSrcMin,extSrcMax,1.0E-07,extMin,extMax);
+	extBrtMin [0] = extBrtMin [1] =  1.0E+30;
+	extBrtMax [0] = extBrtMax [1] = -1.0E+30;
+	for (idx = 0;idx < 4 * 4000;idx += 1)
+	{
+		extIdx = idx % 4000;
+		switch (idx / 4000) {
+		case 0:  extXy [0] = extSrcMin [0] + (extSrcMax [0] - extSrcMin [0]) * extIdx / 4000.0; extXy [1] = extSrcMin [1]; break;
+		case 1:  extXy [0] = extSrcMax [0]; extXy [1] = extSrcMin [1] + (extSrcMax [1] - extSrcMin [1]) * extIdx / 4000.0; break;
+		case 2:  extXy [0] = extSrcMax [0] - (extSrcMax [0] - extSrcMin [0]) * extIdx / 4000.0; extXy [1] = extSrcMax [1]; break;
+		default: extXy [0] = extSrcMin [0]; extXy [1] = extSrcMax [1] - (extSrcMax [1] - extSrcMin [1]) * extIdx / 4000.0; break;
+		}
+		extXy [2] = 0.0;
+		CS_cnvrt ("UTM27-13","LL27",extXy);
+		if (extXy [0] < extBrtMin [0]) extBrtMin [0] = extXy [0];
+		if (extXy [1] < extBrtMin [1]) extBrtMin [1] = extXy [1];
+		if (extXy [0] > extBrtMax [0]) extBrtMax [0] = extXy [0];
+		if (extXy [1] > extBrtMax [1]) extBrtMax [1] = extXy [1];
+	}
+	if (extSt != 0 || fabs (extMin [0] - extBrtMin [0]) > 1.0E-06 || fabs (extMin [1] - extBrtMin [1]) > 1.0E-06 ||
+					  fabs (extMax [0] - extBrtMax [0]) > 1.0E-06 || fabs (extMax [1] - extBrtMax [1]) > 1.0E-06)
+	{
+		printf ("CS_cnvrtExtent failure (UTM27-13).\n");
+		err_cnt += 1;
+	}
+
+	/* Across the antimeridian, the longitudes must stay continuous. */
+	extSrcMin [0] = 175.0;
+	extSrcMin [1] = -40.0;
+	extSrcMax [0] = 185.0;
+	extSrcMax [1] = -30.0;
+	extSt = CS_cnvrtExtent ("LL84","LL84",extSrcMin,extSrcMax,0.0,extMin,extMax);
+	if (extSt < 0 || fabs (extMin [0] - 175.0) > 1.0E-09 || fabs (extMax [0] - 185.0) > 1.0E-09)
+	{
+		printf ("CS_cnvrtExtent failure (antimeridian).\n");
+		err_cnt += 1;
+	}
+
+	/* A rectangle around the pole covers all longitudes up to the pole. */
+	extSrcMin [0] = 1000000.0;
+	extSrcMin [1] = 1000000.0;
+	extSrcMax [0] = 3000000.0;
+	extSrcMax [1] = 3000000.0;
+	extSt = CS_cnvrtExtent ("UPS-N","LL84",extSrcMin,extSrcMax,0.0,extMin,extMax);
+	if (extSt < 0 || extMax [1] != 90.0 || (extMax [0] - extMin [0]) != 360.0)
+	{
+		printf ("CS_cnvrtExtent failure (pole).\n");
+		err_cnt += 1;
+	}
+
+	/* CS_cnvrtLine must return each source vertex exactly as CS_cnvrt
+	   does, in order, with intermediate points only where needed, and
+	   a closed ring must end where it began. */
+	linePnts = NULL;
+	lineAlloc = 0;
+	lineSrc [0][0] = 200000.0; lineSrc [0][1] = 3500000.0; lineSrc [0][2] = 1.0;
+	lineSrc [1][0] = 800000.0; lineSrc [1][1] = 3500000.0; lineSrc [1][2] = 2.0;
+	lineSrc [2][0] = 800000.0; lineSrc [2][1] = 5000000.0; lineSrc [2][2] = 3.0;
+	extSt = CS_cnvrtLine ("UTM27-13","LL27",3,lineSrc,FALSE,1.0E-06,&linePnts,&lineAlloc,&lineCnt);
+	if (extSt != 0 || lineCnt <= 3 || lineCnt > lineAlloc)
+	{
+		printf ("CS_cnvrtLine failure (count).\n");
+		err_cnt += 1;
+	}
+	else
+	{
+		lineIdx = 0;
+		for (idx = 0;idx < 3;idx += 1)
+		{
+			extXy [0] = lineSrc [idx][0];
+			extXy [1] = lineSrc [idx][1];
+			extXy [2] = lineSrc [idx][2];
+			CS_cnvrt ("UTM27-13","LL27",extXy);
+			while (lineIdx < lineCnt && (linePnts [lineIdx][0] != extXy [0] || linePnts [lineIdx][1] != extXy [1]))
+			{
+				lineIdx += 1;
+			}
+			if (lineIdx >= lineCnt || linePnts [lineIdx][2] != lineSrc [idx][2])
+			{
+				printf ("CS_cnvrtLine failure (vertex %d).\n",idx);
+				err_cnt += 1;
+				break;
+			}
+		}
+		if (lineIdx != lineCnt - 1)
+		{
+			printf ("CS_cnvrtLine failure (last vertex).\n");
+			err_cnt += 1;
+		}
+	}
+	lineAllocPrev = lineAlloc;
+	extSt = CS_cnvrtLine ("UTM27-13","LL27",3,lineSrc,TRUE,1.0E-06,&linePnts,&lineAlloc,&lineCnt);
+	if (extSt != 0 || lineCnt < 4 || lineAlloc < lineAllocPrev ||
+		linePnts [lineCnt - 1][0] != linePnts [0][0] || linePnts [lineCnt - 1][1] != linePnts [0][1])
+	{
+		printf ("CS_cnvrtLine failure (closed ring).\n");
+		err_cnt += 1;
+	}
+
+	/* A tolerance of zero would densify every segment to the maximum
+	   depth, and is rejected. */
+	extSt = CS_cnvrtLine ("UTM27-13","LL27",3,lineSrc,FALSE,0.0,&linePnts,&lineAlloc,&lineCnt);
+	if (extSt >= 0 || lineCnt != 0)
+	{
+		printf ("CS_cnvrtLine failure (zero tolerance accepted).\n");
+		err_cnt += 1;
+	}
+
+	/* Rings with a geographic target which cross the antimeridian.  The
+	   first, in UTM zone 60, must keep its longitudes continuous.  The
+	   second surrounds the pole, so unwrapping carries the longitude a
+	   full period; the closing vertex must repeat the first a period
+	   away, with no jump back along the way.  Both are tried with and
+	   without the first vertex repeated. */
+	ringSrc [0][0] = 500000.0; ringSrc [0][1] = 5500000.0; ringSrc [0][2] = 0.0;
+	ringSrc [1][0] = 800000.0; ringSrc [1][1] = 5500000.0; ringSrc [1][2] = 0.0;
+	ringSrc [2][0] = 800000.0; ringSrc [2][1] = 5600000.0; ringSrc [2][2] = 0.0;
+	ringSrc [3][0] = 500000.0; ringSrc [3][1] = 5600000.0; ringSrc [3][2] = 0.0;
+	ringSrc [4][0] = 500000.0; ringSrc [4][1] = 5500000.0; ringSrc [4][2] = 0.0;
+	for (idx = 4;idx <= 5;idx += 1)
+	{
+		extSt = CS_cnvrtLine ("UTM84-60N","LL84",idx,ringSrc,TRUE,1.0E-06,&linePnts,&lineAlloc,&lineCnt);
+		if (extSt != 0 || lineCnt < 5 ||
+			linePnts [lineCnt - 1][0] != linePnts [0][0] || linePnts [lineCnt - 1][1] != linePnts [0][1])
+		{
+			printf ("CS_cnvrtLine failure (antimeridian ring, %d vertices).\n",idx);
+			err_cnt += 1;
+		}
+		for (lineIdx = 0;lineIdx < lineCnt;lineIdx += 1)
+		{
+			if (linePnts [lineIdx][0] < 176.0 || linePnts [lineIdx][0] > 183.0)
+			{
+				printf ("CS_cnvrtLine failure (antimeridian ring continuity).\n");
+				err_cnt += 1;
+				break;
+			}
+		}
+	}
+	ringSrc [0][0] = 1000000.0; ringSrc [0][1] = 1000000.0;
+	ringSrc [1][0] = 3000000.0; ringSrc [1][1] = 1000000.0;
+	ringSrc [2][0] = 3000000.0; ringSrc [2][1] = 3000000.0;
+	ringSrc [3][0] = 1000000.0; ringSrc [3][1] = 3000000.0;
+	ringSrc [4][0] = 1000000.0; ringSrc [4][1] = 1000000.0;
+	for (idx = 4;idx <= 5;idx += 1)
+	{
+		extSt = CS_cnvrtLine ("UPS-N","LL84",idx,ringSrc,TRUE,1.0E-06,&linePnts,&lineAlloc,&lineCnt);
+		if (extSt < 0 || lineCnt < 5 ||
+			fabs (linePnts [lineCnt - 1][0] - linePnts [0][0]) != 360.0 || linePnts [lineCnt - 1][1] != linePnts [0][1])
+		{
+			printf ("CS_cnvrtLine failure (polar ring, %d vertices).\n",idx);
+			err_cnt += 1;
+			continue;
+		}
+		for (lineIdx = 1;lineIdx < lineCnt;lineIdx += 1)
+		{
+			if (fabs (linePnts [lineIdx][0] - linePnts [lineIdx - 1][0]) > 10.0)
+			{
+				printf ("CS_cnvrtLine failure (polar ring continuity, %d vertices).\n",idx);
+				err_cnt += 1;
+				break;
+			}
+		}
+	}
+	CS_free (linePnts);
+
+	/* Allocator hooks and the arena allocator.  Everything CS_csloc
+	   allocates under the arena must be accounted for and released, and
+	   a block allocated before the arena was installed must find its
+	   way back to the system heap.  The caches are released on both
+	   sides so that only what is built under the arena is counted. */
+	CS_recvr ();
+	arenaForeign = CS_malc (100);
+	arenaPtr = CS_arenaNew (0);
+	CS_arenaAllocator (arenaPtr,&arenaAlloc);
+	CS_setAllocator (&arenaAlloc,&arenaPrev);
+	CS_allocStatsReset ();
+	for (idx = 0;idx < 4;idx += 1)
+	{
+		arenaCs = CS_csloc ("UTM27-13");
+		if (arenaCs == NULL)
+		{
+			printf ("CS_csloc failed under the arena allocator.\n");
+			err_cnt += 1;
+			break;
+		}
+		CS_free (arenaCs);
+	}
+	arenaForeign = CS_ralc (arenaForeign,200);
+	CS_free (arenaForeign);
+	CS_recvr ();
+	CS_allocStats (&arenaStats);
+	CS_setAllocator (&arenaPrev,NULL);
+	CS_arenaDelete (arenaPtr);
+	if (arenaStats.malcCount == 0 || arenaStats.malcCount + 1 != arenaStats.freeCount ||
+		arenaStats.ralcCount != 1 || arenaStats.liveBytes != 0 ||
+		arenaStats.peakBytes < sizeof (struct cs_Csprm_))
+	{
+		printf ("Allocation statistics failure under the arena allocator.\n");
+		err_cnt += 1;
+	}
+
+	/* More distinct block sizes than the arena has pools; the blocks
+	   which do not fit in a pool must be reused just the same. */
+	arenaPtr = CS_arenaNew (0);
+	CS_arenaAllocator (arenaPtr,&arenaAlloc);
+	CS_setAllocator (&arenaAlloc,&arenaPrev);
+	for (idx = 0;idx < 24;idx += 1) arenaBlks [idx] = CS_malc ((size_t)(32 * (idx + 1)));
+	for (idx = 0;idx < 24;idx += 1) CS_free (arenaBlks [idx]);
+	for (idx = 0;idx < 24;idx += 1)
+	{
+		arenaBlk = CS_malc ((size_t)(32 * (idx + 1)));
+		arenaIdx = 0;
+		while (arenaIdx < 24 && arenaBlks [arenaIdx] != arenaBlk) arenaIdx += 1;
+		if (arenaIdx >= 24)
+		{
+			printf ("Arena failed to reuse a released block of %d bytes.\n",32 * (idx + 1));
+			err_cnt += 1;
+			break;
+		}
+	}
+	CS_setAllocator (&arenaPrev,NULL);
+	CS_arenaDelete (arenaPtr);
+
+	/* An arena deleted while its allocator is still installed must
+	   reinstate its parent. */
+	arenaPtr = CS_arenaNew (0);
+	CS_arenaAllocator (arenaPtr,&arenaAlloc);
+	CS_setAllocator (&arenaAlloc,&arenaPrev);
+	CS_arenaDelete (arenaPtr);
+	CS_setAllocator (&arenaPrev,&arenaAlloc);
+	if (arenaAlloc.malcFunc != arenaPrev.malcFunc || arenaAlloc.context != arenaPrev.context)
+	{
+		printf ("CS_arenaDelete failed to reinstate the parent allocator.\n");
+		err_cnt += 1;
+	}
+
+	/* Newton inverse of a grid shift cell.  The first cell is referenced
+	   to its southeast corner as is the case for NTv2, and has a shift
+	   large enough to require a few iterations. */
+	shiftCell.origin [LNG] = -100.0;
+	shiftCell.origin [LAT] = 40.0;
+	shiftCell.delta [LNG] = -0.25;
+	shiftCell.delta [LAT] = 0.25;
+	shiftCell.lngCoef [0] = 0.020;
+	shiftCell.lngCoef [1] = -0.015;
+	shiftCell.lngCoef [2] = 0.010;
+	shiftCell.lngCoef [3] = 0.030;
+	shiftCell.latCoef [0] = -0.010;
+	shiftCell.latCoef [1] = 0.025;
+	shiftCell.latCoef [2] = -0.020;
+	shiftCell.latCoef [3] = 0.015;
+	for (idx = 0;idx < 2;idx += 1)
+	{
+		shiftSrc [LNG] = -100.1;
+		shiftSrc [LAT] = 40.2;
+		shiftXx = (shiftSrc [LNG] - shiftCell.origin [LNG]) / shiftCell.delta [LNG];
+		shiftYy = (shiftSrc [LAT] - shiftCell.origin [LAT]) / shiftCell.delta [LAT];
+		shiftTrg [LNG] = shiftSrc [LNG] + shiftCell.lngCoef [0] + shiftCell.lngCoef [1] * shiftXx +
+						 shiftCell.lngCoef [2] * shiftYy + shiftCell.lngCoef [3] * shiftXx * shiftYy;
+		shiftTrg [LAT] = shiftSrc [LAT] + shiftCell.latCoef [0] + shiftCell.latCoef [1] * shiftXx +
+						 shiftCell.latCoef [2] * shiftYy + shiftCell.latCoef [3] * shiftXx * shiftYy;
+		shiftRslt [LNG] = shiftTrg [LNG];
+		shiftRslt [LAT] = shiftTrg [LAT];
+		shiftOk = CSinvertShiftCell (&shiftCell,shiftRslt,shiftTrg,1.0E-12);
+		if ((idx == 0) != (shiftOk != 0) ||
+			fabs (shiftRslt [LNG] - shiftSrc [LNG]) > 1.0E-11 ||
+			fabs (shiftRslt [LAT] - shiftSrc [LAT]) > 1.0E-11)
+		{
+			printf ("CSinvertShiftCell failed (%d) at %d.\n",idx,__LINE__);
+			err_cnt += 1;
+		}
+
+		/* The same solution, but now outside of the cell.  The estimate
+		   must be just as good, but the function must report that the
+		   forward would not have used this cell. */
+		shiftCell.origin [LNG] = -99.5;
+	}
+
+	/* The NADCON inverse now relies on the above; a round trip must
+	   return to where it started. */
+	shiftLl [LNG] = -105.123456789;
+	shiftLl [LAT] = 39.123456789;
+	shiftLl [HGT] = 0.0;
+	status = CS_cnvrt ("LL27","LL83",shiftLl);
+	if (status == 0)
+	{
+		status = CS_cnvrt ("LL83","LL27",shiftLl);
+	}
+	if (status != 0 || fabs (shiftLl [LNG] + 105.123456789) > 1.0E-9 ||
+					   fabs (shiftLl [LAT] - 39.123456789) > 1.0E-9)
+	{
+		printf ("NAD27 round trip failed at %d.\n",__LINE__);
+		err_cnt += 1;
+	}
+
+	/* The two dimensional inverses of the Helmert family of geocentric
+	   transformations are closed form, and thus precise to well beyond
+	   the convergence value the iterative technique used to deliver.  The
+	   same parameters are exercised with each of the rotation conventions. */
+	helmDef = CS_gxdef ("AMERFORT-BW_to_WGS84");
+	if (helmDef == NULL)
+	{
+		printf ("CS_gxdef failed at %d.\n",__LINE__);
+		err_cnt += 1;
+	}
+	for (idx = 0;helmDef != NULL && idx < 3;idx += 1)
+	{
+		helmDef->methodCode = helmMethods [idx];
+		helmXfrm = CS_gxloc1 (helmDef,cs_DTCDIR_FWD);
+		if (helmXfrm == NULL)
+		{
+			printf ("CS_gxloc1 failed (%d) at %d.\n",idx,__LINE__);
+			err_cnt += 1;
+			continue;
+		}
+		for (helmIdx = 0;helmIdx < 16;helmIdx += 1)
+		{
+			helmSrc [LNG] = 3.0 + 0.25 * (double)helmIdx;
+			helmSrc [LAT] = 50.5 + 0.2 * (double)helmIdx;
+			helmSrc [HGT] = 0.0;
+			status  = CS_gxFrwrd2D (helmXfrm,helmTrg,helmSrc);
+			status |= CS_gxInvrs2D (helmXfrm,helmBack,helmTrg);
+			if (status != 0 || fabs (helmBack [LNG] - helmSrc [LNG]) > 1.0E-11 ||
+							   fabs (helmBack [LAT] - helmSrc [LAT]) > 1.0E-11)
+			{
+				printf ("Geocentric 2D inverse failed (%d:%d) at %d.\n",idx,helmIdx,__LINE__);
+				err_cnt += 1;
+				break;
+			}
+		}
+		(*helmXfrm->destroy)(&helmXfrm->xforms);
+		CS_free (helmXfrm);
+	}
+	CS_free (helmDef);
+
+	/* Projections with iterative inverse (or, in the case of Mollweide,
+	   forward) calculations now start from much better estimates, and
+	   Winkel-Tripel uses Newton's method.  The round trips must be at
+	   least as good as before.  The last entry is Mollweide, constructed
+	   from the Robinson definition. */
+	for (itrIdx = 0;itrIdx < 4;itrIdx += 1)
+	{
+		itrDef = CS_csdef (itrNames [itrIdx]);
+		if (itrDef == NULL)
+		{
+			printf ("CS_csdef failed on %s at %d.\n",itrNames [itrIdx],__LINE__);
+			err_cnt += 1;
+			continue;
+		}
+		if (itrIdx == 3)
+		{
+			CS_stncp (itrDef->prj_knm,"MOLLWEID",sizeof (itrDef->prj_knm));
+		}
+		itrPrm = CScsloc1 (itrDef);
+		CS_free (itrDef);
+		if (itrPrm == NULL)
+		{
+			printf ("CScsloc1 failed on %s at %d.\n",itrNames [itrIdx],__LINE__);
+			err_cnt += 1;
+			continue;
+		}
+		for (idx = 0;idx < 500;idx += 1)
+		{
+			itrLl [LNG] = CStestRN (itrRng [itrIdx][0],itrRng [itrIdx][1]);
+			itrLl [LAT] = CStestRN (itrRng [itrIdx][2],itrRng [itrIdx][3]);
+			itrLl [HGT] = 0.0;
+			status = CS_ll2cs (itrPrm,itrXy,itrLl);
+			if (status == 0)
+			{
+				status = CS_cs2ll (itrPrm,itrBack,itrXy);
+			}
+			if (status != 0 || fabs (itrBack [LNG] - itrLl [LNG]) > itrTol [itrIdx] ||
+							   fabs (itrBack [LAT] - itrLl [LAT]) > itrTol [itrIdx])
+			{
+				printf ("Iterative projection round trip failed on %s (%d) at %d.\n",itrNames [itrIdx],idx,__LINE__);
+				err_cnt += 1;
+				break;
+			}
+		}
+		CS_free (itrPrm);
+	}
+
+	/* The hashed projection table lookup must return exactly what a
+	   linear search of the table returns, regardless of case, and the
+	   terminating entry for a name which is not there. */
+	for (setupPrj = cs_Prjtab;setupPrj->key_nm [0] != '\0';setupPrj += 1)
+	{
+		CS_stncp (setupName,setupPrj->key_nm,sizeof (setupName));
+		for (setupCp = setupName;*setupCp != '\0';setupCp += 1)
+		{
+			*setupCp = (char)CS_tolower (*setupCp);
+		}
+		for (setupLin = cs_Prjtab;setupLin->key_nm [0] != '\0';setupLin += 1)
+		{
+			if (!CS_stricmp (setupLin->key_nm,setupName)) break;
+		}
+		if (CSprjtabLu (setupName) != setupLin || CSprjtabLu (setupPrj->key_nm) != setupLin)
+		{
+			printf ("CSprjtabLu failed on %s at %d.\n",setupPrj->key_nm,__LINE__);
+			err_cnt += 1;
+		}
+	}
+	setupLin = CSprjtabLu ("NOT-A-PROJECTION");
+	if (setupLin->key_nm [0] != '\0' || setupLin->setup != NULL)
+	{
+		printf ("CSprjtabLu located a non-existent projection at %d.\n",__LINE__);
+		err_cnt += 1;
+	}
+
+	/* Same for the unit table: every name must produce the factor of the
+	   first entry of the same type with that name or abbreviation. */
+	for (setupUnit = cs_Unittab;setupUnit->type != cs_UTYP_END;setupUnit += 1)
+	{
+		if (setupUnit->type != cs_UTYP_LEN && setupUnit->type != cs_UTYP_ANG) continue;
+		for (setupUnitLin = cs_Unittab;setupUnitLin->type != cs_UTYP_END;setupUnitLin += 1)
+		{
+			if (setupUnitLin->type == setupUnit->type && !CS_stricmp (setupUnitLin->name,setupUnit->name)) break;
+		}
+		if (CS_unitlu (setupUnit->type,setupUnit->name) != setupUnitLin->factor)
+		{
+			printf ("CS_unitlu failed on %s at %d.\n",setupUnit->name,__LINE__);
+			err_cnt += 1;
+		}
+		for (setupUnitLin = cs_Unittab;setupUnitLin->type != cs_UTYP_END;setupUnitLin += 1)
+		{
+			if (setupUnitLin->type == setupUnit->type && !CS_stricmp (setupUnitLin->name,setupUnit->abrv)) break;
+		}
+		if (setupUnitLin->type == cs_UTYP_END)
+		{
+			for (setupUnitLin = cs_Unittab;setupUnitLin->type != cs_UTYP_END;setupUnitLin += 1)
+			{
+				if (setupUnitLin->type == setupUnit->type && !CS_stricmp (setupUnitLin->abrv,setupUnit->abrv)) break;
+			}
+		}
+		if (CS_unitlu (setupUnit->type,setupUnit->abrv) != setupUnitLin->factor)
+		{
+			printf ("CS_unitlu failed on %s at %d.\n",setupUnit->abrv,__LINE__);
+			err_cnt += 1;
+		}
+	}
+
+	/* CS_dtloc caches the datums it locates.  A datum returned from the
+	   cache must be identical to one composed from the dictionaries, and
+	   the cache must be dropped when the dictionaries change.  The character
+	   arrays are compared as strings; what follows the terminating null
+	   is whatever the allocator left there. */
+	CSdtlocRls ();
+	for (setupIdx = 0;setupDtNames [setupIdx] != 0;setupIdx += 1)
+	{
+		setupDt1 = CS_dtloc (setupDtNames [setupIdx]);
+		setupDt2 = CS_dtloc (setupDtNames [setupIdx]);
+		setupDtDef = CS_dtdef (setupDtNames [setupIdx]);
+		setupDt3 = (setupDtDef == NULL) ? NULL : CSdtloc1 (setupDtDef);
+		if (setupDt1 == NULL || setupDt2 == NULL || setupDt3 == NULL || setupDt1 == setupDt2 ||
+			memcmp (setupDt1,setupDt2,sizeof (*setupDt1)) ||
+			strcmp (setupDt1->key_nm,setupDt3->key_nm) ||
+			strcmp (setupDt1->ell_knm,setupDt3->ell_knm) ||
+			strcmp (setupDt1->dt_name,setupDt3->dt_name) ||
+			strcmp (setupDt1->el_name,setupDt3->el_name) ||
+			memcmp (&setupDt1->e_rad,&setupDt3->e_rad,(size_t)((char *)&setupDt1->to84_via - (char *)&setupDt1->e_rad)) ||
+			setupDt1->to84_via != setupDt3->to84_via)
+		{
+			printf ("Cached CS_dtloc failed on %s at %d.\n",setupDtNames [setupIdx],__LINE__);
+			err_cnt += 1;
+		}
+		CS_free (setupDt1);
+		CS_free (setupDt2);
+		CS_free (setupDt3);
+		CS_free (setupDtDef);
+	}
+	if (csDtmcachP == NULL)
+	{
+		printf ("CS_dtloc did not cache anything at %d.\n",__LINE__);
+		err_cnt += 1;
+	}
+	CS_stncp (setupPath,cs_Dtname,sizeof (setupPath));
+	CS_dtfnm (setupPath);
+	if (csDtmcachP != NULL)
+	{
+		printf ("Datum cache survived a dictionary change at %d.\n",__LINE__);
+		err_cnt += 1;
+	}
+	setupDt1 = CS_dtloc ("NOT-A-DATUM");
+	if (setupDt1 != NULL)
+	{
+		printf ("CS_dtloc located a non-existent datum at %d.\n",__LINE__);
+		err_cnt += 1;
+		CS_free (setupDt1);
+	}
+
+	/* A tile grid must hold what CS_cnvrt produces for the center of
+	   each pixel; interpolated grids must be within the tolerance. */
+	for (tileIdx = 0;tileIdx < 3;tileIdx += 1)
+	{
+		status = CS_cnvrtTile ("WGS84.PseudoMercator",tileSrc [tileIdx],10,212L,388L,64,0.0,tileExact);
+		if (status != 0)
+		{
+			printf ("CS_cnvrtTile failed on %s (%d) at %d.\n",tileSrc [tileIdx],status,__LINE__);
+			err_cnt += 1;
+			continue;
+		}
+		tileSpan = (cs_Pi * 2.0 * 6378137.0) / 1024.0;
+		for (idx = 0;idx < 64 * 64;idx += 1)
+		{
+			tileRow = idx / 64;
+			tileCol = idx % 64;
+			tileXy [XX] = -cs_Pi * 6378137.0 + (212.0 + ((double)tileCol + 0.5) / 64.0) * tileSpan;
+			tileXy [YY] =  cs_Pi * 6378137.0 - (388.0 + ((double)tileRow + 0.5) / 64.0) * tileSpan;
+			tileXy [2] = 0.0;
+			CS_cnvrt ("WGS84.PseudoMercator",tileSrc [tileIdx],tileXy);
+			if (fabs (tileXy [XX] - tileExact [idx][XX]) > 1.0E-06 ||
+				fabs (tileXy [YY] - tileExact [idx][YY]) > 1.0E-06)
+			{
+				printf ("CS_cnvrtTile pixel %d on %s differs from CS_cnvrt at %d.\n",idx,tileSrc [tileIdx],__LINE__);
+				err_cnt += 1;
+				break;
+			}
+		}
+		status = CS_cnvrtTile ("WGS84.PseudoMercator",tileSrc [tileIdx],10,212L,388L,64,tileTol [tileIdx],tileInterp);
+		for (idx = 0;status == 0 && idx < 64 * 64;idx += 1)
+		{
+			if (fabs (tileInterp [idx][XX] - tileExact [idx][XX]) > tileTol [tileIdx] ||
+				fabs (tileInterp [idx][YY] - tileExact [idx][YY]) > tileTol [tileIdx])
+			{
+				printf ("Interpolated CS_cnvrtTile pixel %d on %s out of tolerance at %d.\n",idx,tileSrc [tileIdx],__LINE__);
+				err_cnt += 1;
+				break;
+			}
+		}
+	}
+	if (CS_cnvrtTile ("WGS84.PseudoMercator","LL84",31,0L,0L,64,0.0,tileExact) >= 0 ||
+		CS_cnvrtTile ("WGS84.PseudoMercator","LL84",2,4L,0L,64,0.0,tileExact) >= 0 ||
+		CS_cnvrtTile ("UTM83-13","LL84",2,0L,0L,64,0.0,tileExact) >= 0)
+	{
+		printf ("CS_cnvrtTile accepted an invalid argument at %d.\n",__LINE__);
+		err_cnt += 1;
+	}
+
+	/* The compiled multiple regression polynomials must produce exactly,
+	   bit for bit, what the original evaluation produced.  Every seventh
+	   point is outside the useful range. */
+	for (mulrgNbr = 0;mulrgNbr < 3;mulrgNbr += 1)
+	{
+		mulrgXfrm = CS_gxloc (mulrgNames [mulrgNbr],cs_DTCDIR_FWD);
+		if (mulrgXfrm == NULL)
+		{
+			printf ("CS_gxloc failed on %s at %d.\n",mulrgNames [mulrgNbr],__LINE__);
+			err_cnt += 1;
+			continue;
+		}
+		mulrg = &mulrgXfrm->xforms.mulrg;
+		mulrgRng = mulrg->validation / mulrg->normalizationScale;
+		for (mulrgIdx = 0;mulrgIdx < 37;mulrgIdx += 1)
+		{
+			mulrgSrc [mulrgIdx][LNG] = CStestRN (-mulrg->vv_off - mulrgRng,-mulrg->vv_off + mulrgRng);
+			mulrgSrc [mulrgIdx][LAT] = CStestRN (-mulrg->uu_off - mulrgRng,-mulrg->uu_off + mulrgRng);
+			mulrgSrc [mulrgIdx][HGT] = CStestRN (-100.0,1000.0);
+			if ((mulrgIdx % 7) == 3)
+			{
+				mulrgSrc [mulrgIdx][LAT] = -mulrg->uu_off + 1.5 * mulrgRng;
+			}
+			mulrgStat = CSmulrgF3 (mulrg,mulrgOne [mulrgIdx],mulrgSrc [mulrgIdx]);
+			if ((mulrgIdx % 7) == 3)
+			{
+				if (mulrgStat == 0)
+				{
+					printf ("CSmulrgF3 accepted an out of range point on %s at %d.\n",mulrgNames [mulrgNbr],__LINE__);
+					err_cnt += 1;
+				}
+				continue;
+			}
+			CStestMulrgRef (mulrg,mulrgRef,mulrgSrc [mulrgIdx]);
+			if (mulrgStat != 0 || memcmp (mulrgRef,mulrgOne [mulrgIdx],sizeof (mulrgRef)))
+			{
+				printf ("CSmulrgF3 differs from the original evaluation on %s (%d) at %d.\n",mulrgNames [mulrgNbr],mulrgIdx,__LINE__);
+				err_cnt += 1;
+			}
+		}
+		(*mulrgXfrm->destroy)(&mulrgXfrm->xforms);
+		CS_free (mulrgXfrm);
+	}
+
+	/* Conversion metrics.  100 NAD27 to NAD83 conversions go through the
+	   NADCON grid interpolation, the inverse of which is iterative. */
+	CS_resetMetrics ();
+	for (idx = 0;idx < 100;idx += 1)
+	{
+		metricsXy [XX] = 500000.0 + 10.0 * (double)idx;
+		metricsXy [YY] = 4300000.0;
+		metricsXy [2] = 0.0;
+		CS_cnvrt ((idx & 1) ? "UTM27-13" : "UTM83-13",(idx & 1) ? "UTM83-13" : "UTM27-13",metricsXy);
+	}
+	CS_getMetrics (&metrics);
+	metricsItr = metrics.itrLimit;
+	for (idx = 0;idx < cs_METRICS_ITRBKT;idx += 1)
+	{
+		metricsItr += metrics.itrHist [idx];
+	}
+	if (metrics.cs2llPnts != 100 || metrics.ll2csPnts != 100 || metrics.dtcvtPnts != 100 ||
+		metrics.xfrmPnts [cs_METRICS_SLOT (cs_DTCMTH_GFILE)] != 100 || metricsItr != 50 ||
+		metrics.csCacheHits + metrics.csCacheMisses != 200 ||
+		metrics.dtcCacheHits + metrics.dtcCacheMisses != 100 ||
+		metrics.gridLookups == 0 || metrics.gridLookups < metrics.gridMisses)
+	{
+		printf ("Conversion metrics are not what they should be at %d.\n",__LINE__);
+		err_cnt += 1;
+	}
+	metricsLen = CS_metricsExport (metricsBufr,sizeof (metricsBufr),cs_METRICS_JSON);
+	if (metricsLen <= 0 || metricsLen != (int)strlen (metricsBufr) || metricsBufr [0] != '{' ||
+		strstr (metricsBufr,"\"dtcvt\":100}") == NULL || strstr (metricsBufr,"\"GRID_INTERP\":100") == NULL)
+	{
+		printf ("CS_metricsExport JSON format failure at %d.\n",__LINE__);
+		err_cnt += 1;
+	}
+	if (CS_metricsExport (metricsBufr,64,cs_METRICS_TEXT) <= 63 || strlen (metricsBufr) >= 64 ||
+		strstr (metricsBufr,"csmap_points_total{stage=\"cs2ll\"} 100\n") != metricsBufr)
+	{
+		printf ("CS_metricsExport text format failure at %d.\n",__LINE__);
+		err_cnt += 1;
+	}
+	CS_resetMetrics ();
+	CS_getMetrics (&metrics);
+	if (metrics.cs2llPnts != 0 || metrics.gridLookups != 0)
+	{
+		printf ("CS_resetMetrics failure at %d.\n",__LINE__);
+		err_cnt += 1;
+	}
+
+	/* TcsCsvReader must produce exactly what csGetCsvRecord and
+	   csCsvFieldParse produce: quoted fields, doubled quotes, new lines in
+	   quoted fields, and a last record without a new line. */
+	for (csvIdx = 0;csvTexts [csvIdx] != 0;csvIdx += 1)
+	{
+		if (CStestCsv (csvTexts [csvIdx],0) != 0 || CStestCsv (csvTexts [csvIdx],L",\"\"#") != 0)
+		{
+			printf ("TcsCsvReader differs from csGetCsvRecord/csCsvFieldParse on text %d at %d.\n",csvIdx,__LINE__);
+			err_cnt += 1;
+		}
+	}
+
+	/* Tracing hooks.  With the caches emptied, a NAD27 to NAD83 conversion
+	   locates both coordinate systems, sets up the datum conversion, which
+	   opens the NADCON files, and reads grid data. */
+	memset (&trace,0,sizeof (trace));
+	traceHooks.bgnFunc = CStestTraceBgn;
+	traceHooks.endFunc = CStestTraceEnd;
+	traceHooks.context = &trace;
+	CS_recvr ();
+	CS_setTraceHooks (&traceHooks,NULL);
+	traceXy [XX] = 500000.0;
+	traceXy [YY] = 4300000.0;
+	traceXy [2] = 0.0;
+	CS_cnvrt ("UTM27-13","UTM83-13",traceXy);
+	for (idx = 0;idx < 3;idx += 1)
+	{
+		traceLine [idx][XX] = 500000.0 + 10000.0 * (double)idx;
+		traceLine [idx][YY] = 4300000.0 + 10000.0 * (double)(idx & 1);
+		traceLine [idx][2] = 0.0;
+	}
+	tracePnts = NULL;
+	traceAlloc = traceCnt = 0;
+	CS_cnvrtLine ("UTM27-13","UTM83-13",3,traceLine,0,1.0,&tracePnts,&traceAlloc,&traceCnt);
+	CS_free (tracePnts);
+	CS_setTraceHooks (NULL,&tracePrev);
+	CS_cnvrt ("UTM27-13","UTM83-13",traceXy);
+	for (idx = 1;idx <= cs_TRACE_BATCH;idx += 1)
+	{
+		if (trace.bgnCnt [idx] != trace.endCnt [idx]) trace.errors += 1;
+	}
+	if (trace.errors != 0 || trace.depth != 0 || tracePrev.context != &trace ||
+		trace.bgnCnt [cs_TRACE_CSLOC] != 2 || trace.bgnCnt [cs_TRACE_DTCSU] != 1 ||
+		trace.bgnCnt [cs_TRACE_DTCPH1] < 1 || trace.bgnCnt [cs_TRACE_GRIDOPEN] < 2 ||
+		trace.bgnCnt [cs_TRACE_GRIDREAD] < 2 || trace.bgnCnt [cs_TRACE_BATCH] != 1 ||
+		strcmp (trace.dtcsuName,"NAD27->NAD83"))
+	{
+		printf ("Tracing hooks were not called as they should have been at %d.\n",__LINE__);
+		err_cnt += 1;
+	}
+
 #ifdef __SKIP__
 	/* Test the Geoid height functions. */
 	testLatLng [0] = -105.123456789;